@@ -66,6 +66,11 @@ int entry(int argc, char **argv)
   arser.add_argument("--data").required(false).default_value("").help("Path to the test data");
   arser.add_argument("--data_format").required(false).help("Test data format (default: h5)");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("Number of threads used to evaluate the dataset (default: 1)");
+
   arser.add_argument("--qerror_ratio")
     .type(arser::DataType::FLOAT)
     .default_value(0.5f)
@@ -179,6 +184,13 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  int32_t num_threads = arser.get<int32_t>("--num_threads");
+  if (num_threads < 1)
+  {
+    std::cerr << "ERROR: the number of threads must be greater than zero" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   if (arser[bisection_str] && arser[patterns_str])
   {
     // only one solver can be used for now
@@ -220,6 +232,7 @@ int entry(int argc, char **argv)
     auto input_data =
       std::make_unique<mpqsolver::core::H5FileDataProvider>(data_path, input_model_path);
     bi_solver->setInputData(std::move(input_data));
+    bi_solver->setNumThreads(static_cast<uint32_t>(num_threads));
 
     {
       auto value = arser.get<std::string>(bisection_str);
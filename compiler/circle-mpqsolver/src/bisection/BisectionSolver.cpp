@@ -100,6 +100,14 @@ void BisectionSolver::algorithm(Algorithm algorithm) { _algorithm = algorithm; }
 
 void BisectionSolver::setVisqPath(const std::string &visq_path) { _visq_data_path = visq_path; }
 
+void BisectionSolver::setNumThreads(uint32_t num_threads)
+{
+  if (num_threads == 0)
+    throw std::runtime_error("The number of threads must be greater than zero");
+
+  _num_threads = num_threads;
+}
+
 void BisectionSolver::setInputData(std::unique_ptr<mpqsolver::core::DataProvider> &&data)
 {
   _input_data = std::move(data);
@@ -127,7 +135,7 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
   {
     throw std::runtime_error("no input data");
   }
-  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get());
+  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get(), _num_threads);
 
   core::LayerParams layer_params;
   float int16_qerror =
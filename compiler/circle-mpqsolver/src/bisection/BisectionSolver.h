@@ -76,6 +76,11 @@ public:
    */
   void setVisqPath(const std::string &visq_path);
 
+  /**
+   * @brief set the number of threads used to evaluate the dataset
+   */
+  void setNumThreads(uint32_t num_threads);
+
 private:
   float evaluate(const core::DatasetEvaluator &evaluator, const std::string &module_path,
                  const std::string &def_quant, core::LayerParams &layers);
@@ -86,6 +91,7 @@ private:
   Algorithm _algorithm = Algorithm::ForceQ16Front;
   std::string _visq_data_path;
   std::unique_ptr<mpqsolver::core::DataProvider> _input_data;
+  uint32_t _num_threads = 1;
 };
 
 } // namespace bisection
@@ -24,6 +24,12 @@
 
 #include <dio_hdf5/HDF5Importer.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace mpqsolver::core;
 
 using Shape = std::vector<loco::Dimension>;
@@ -41,7 +47,8 @@ template <typename NodeT> size_t get_tensor_size(const NodeT *node)
   return tensor_size;
 }
 
-WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider)
+WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider,
+                            uint32_t num_threads)
 {
   if (data_provider == nullptr)
   {
@@ -52,42 +59,94 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
   if (num_records == 0)
     throw std::runtime_error("The input data file does not contain any record.");
   const auto input_nodes = loco::input_nodes(module->graph());
+  const auto output_nodes = loco::output_nodes(module->graph());
   const auto num_inputs = input_nodes.size();
 
-  WholeOutput dataset_output;
-
-  // Create interpreter.
-  luci_interpreter::Interpreter interpreter(module);
-  for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
-  {
-    if (num_inputs != data_provider->numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
-    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
-    {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
+  WholeOutput dataset_output(num_records);
 
-      InputData input_data(get_tensor_size(input_node));
-      data_provider->getSampleInput(record_idx, input_idx, input_data);
+  // Records are assigned to threads one by one, so that threads are busy until the end.
+  // Each thread reads only the record it interprets, so the dataset is not kept in memory.
+  std::atomic<size_t> next_record{0};
+  // DataProvider (e.g. HDF5) may not be read concurrently
+  std::mutex read_mutex;
 
-      interpreter.writeInputTensor(input_node, input_data.data().data(), input_data.data().size());
+  auto interpret_records = [&]() {
+    // Create interpreter.
+    luci_interpreter::Interpreter interpreter(module);
+    for (auto record_idx = next_record++; record_idx < num_records; record_idx = next_record++)
+    {
+      std::vector<InputData> record;
+      {
+        std::lock_guard<std::mutex> lock(read_mutex);
+        if (num_inputs != data_provider->numInputs(record_idx))
+          throw std::runtime_error("Wrong number of inputs.");
+        for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+        {
+          const auto *input_node =
+            loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          assert(input_node->index() == input_idx);
+
+          record.emplace_back(get_tensor_size(input_node));
+          data_provider->getSampleInput(record_idx, input_idx, record.back());
+        }
+      }
+
+      for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+      {
+        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        const auto &input_data = record[input_idx].data();
+        interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
+      }
+
+      interpreter.interpret();
+
+      Output nn_output;
+
+      // Get output.
+      for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
+      {
+        const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+        Buffer output_data(get_tensor_size(output_node));
+        interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
+        // output
+        nn_output.push_back(output_data);
+      }
+      dataset_output[record_idx] = std::move(nn_output);
     }
+  };
 
-    interpreter.interpret();
+  const auto run_threads = std::min<size_t>(num_threads, num_records);
+  if (run_threads <= 1)
+  {
+    interpret_records();
+    return dataset_output;
+  }
 
-    Output nn_output;
+  std::vector<std::exception_ptr> errors(run_threads);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < run_threads; ++t)
+  {
+    threads.emplace_back([&, t]() {
+      try
+      {
+        interpret_records();
+      }
+      catch (...)
+      {
+        errors[t] = std::current_exception();
+        // Let other threads finish early
+        next_record = num_records;
+      }
+    });
+  }
 
-    // Get output.
-    const auto output_nodes = loco::output_nodes(module->graph());
-    for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
-    {
-      const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
-      Buffer output_data(get_tensor_size(output_node));
-      interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
-      // output
-      nn_output.push_back(output_data);
-    }
-    dataset_output.push_back(nn_output);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &error : errors)
+  {
+    if (error != nullptr)
+      std::rethrow_exception(error);
   }
 
   return dataset_output;
@@ -96,10 +155,16 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
 } // namespace
 
 DatasetEvaluator::DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                                   const ErrorMetric &metric)
-  : _ref_module(ref_module), _provider(&provider), _metric(&metric)
+                                   const ErrorMetric &metric, uint32_t num_threads)
+  : _ref_module(ref_module), _provider(&provider), _metric(&metric), _num_threads(num_threads)
 {
-  _ref_output = compute_outputs(_ref_module, _provider);
+  if (_num_threads == 0)
+    throw std::runtime_error("The number of threads must be greater than zero");
+
+  if (_ref_module == nullptr)
+    throw std::runtime_error("Invalid reference module");
+
+  _ref_output = compute_outputs(_ref_module, _provider, _num_threads);
 }
 
 void DatasetEvaluator::validate(const luci::Module *trgt_fq_module) const
@@ -124,7 +189,7 @@ float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module) const
 
   validate(trgt_fq_module);
 
-  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider);
+  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider, _num_threads);
   float error = _metric->compute(_ref_output, cur_output);
   return error;
 }
@@ -37,9 +37,11 @@ class DatasetEvaluator final
 public:
   /**
    * @brief create Evaluator for comparing output of ref_module on provider
+   * @note  records are read from provider record by record for every evaluation,
+   *        and interpreted by num_threads interpreters in parallel
    */
   DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                   const ErrorMetric &metric);
+                   const ErrorMetric &metric, uint32_t num_threads = 1);
   DatasetEvaluator() = delete;
   ~DatasetEvaluator() = default;
 
@@ -60,6 +62,7 @@ private:
   const DataProvider *_provider = nullptr;
   WholeOutput _ref_output;
   const ErrorMetric *_metric = nullptr;
+  uint32_t _num_threads = 1;
 };
 
 } // namespace core
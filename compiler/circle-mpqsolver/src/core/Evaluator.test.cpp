@@ -42,3 +42,43 @@ TEST(CircleMPQSolverEvaluatorTest, empty_path_NEG)
   EXPECT_ANY_THROW(mpqsolver::core::H5FileDataProvider data("", "");
                    mpqsolver::core::DatasetEvaluator evaluator(nullptr, data, metric));
 }
+
+TEST(CircleMPQSolverEvaluatorTest, multiple_threads)
+{
+  // create nn module
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+
+  // target module adds one more than the reference module
+  auto trgt = luci::make_module();
+  mpqsolver::test::models::AddGraph trgt_g;
+  trgt_g.init();
+  for (uint32_t i = 0; i < trgt_g._beta->size<loco::DataType::FLOAT32>(); ++i)
+    trgt_g._beta->at<loco::DataType::FLOAT32>(i) = 1.f;
+  trgt_g.transfer_to(trgt.get());
+
+  // more records than threads
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getSequentialDataProvider(10);
+  mpqsolver::core::DatasetEvaluator single(m.get(), *data.get(), metric, 1);
+  mpqsolver::core::DatasetEvaluator multiple(m.get(), *data.get(), metric, 4);
+
+  const float single_value = single.evaluate(trgt.get());
+  EXPECT_FLOAT_EQ(single_value, 1.f);
+  EXPECT_FLOAT_EQ(multiple.evaluate(trgt.get()), single_value);
+  EXPECT_FLOAT_EQ(multiple.evaluate(m.get()), 0.f);
+}
+
+TEST(CircleMPQSolverEvaluatorTest, zero_threads_NEG)
+{
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  EXPECT_ANY_THROW(mpqsolver::core::DatasetEvaluator evaluator(m.get(), *data.get(), metric, 0));
+}
@@ -138,6 +138,12 @@ namespace data_utils
 
 std::unique_ptr<mpqsolver::core::DataProvider> getAllZeroSingleDataProvider();
 
+/**
+ * @brief create provider of num_samples float records, where all values of a record are
+ *        its index
+ */
+std::unique_ptr<mpqsolver::core::DataProvider> getSequentialDataProvider(uint32_t num_samples);
+
 } // namespace data_utils
 
 } // namespace test
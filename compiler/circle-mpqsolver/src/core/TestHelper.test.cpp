@@ -234,6 +234,31 @@ std::unique_ptr<mpqsolver::core::DataProvider> getAllZeroSingleDataProvider()
   return std::make_unique<SingleDataProvider>();
 }
 
+class SequentialDataProvider final : public core::DataProvider
+{
+public:
+  SequentialDataProvider(uint32_t num_samples) : _num_samples(num_samples) {}
+  size_t numSamples() const override { return _num_samples; }
+  uint32_t numInputs(uint32_t) const override { return 1; }
+  void getSampleInput(uint32_t sample, uint32_t, core::InputData &data) const
+  {
+    size_t size = data.data().size() / sizeof(float);
+    auto floats = reinterpret_cast<float *>(data.data().data());
+    for (uint32_t idx = 0; idx < size; idx++)
+    {
+      floats[idx] = static_cast<float>(sample);
+    }
+  }
+
+private:
+  uint32_t _num_samples = 0;
+};
+
+std::unique_ptr<mpqsolver::core::DataProvider> getSequentialDataProvider(uint32_t num_samples)
+{
+  return std::make_unique<SequentialDataProvider>(num_samples);
+}
+
 } // namespace data_utils
 
 } // namespace test
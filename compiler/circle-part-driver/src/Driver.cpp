@@ -24,11 +24,12 @@ int entry(int argc, char **argv)
 {
   LOGGER(l);
 
-  if (argc != 5)
+  if (argc < 5 || argc > 7)
   {
     std::cerr
       << "Usage: " << argv[0]
-      << " <path/to/partition/config> <num_inputs> <path/to/input/prefix> <path/to/output/file>\n";
+      << " <path/to/partition/config> <num_inputs> <path/to/input/prefix> <path/to/output/file>"
+         " [num_records] [num_threads]\n";
     return EXIT_FAILURE;
   }
   // NOTE: about input/output data file name
@@ -36,11 +37,25 @@ int entry(int argc, char **argv)
   // NOTE: about output shape
   // - file name with filename.ext0.shape, filename.ext1.shape, ...
   //   having one line text content of CSV format(like H,W or N,C,H,W)
+  // NOTE: about records
+  // - with num_records, I/O file name has record index like filename.ext0.0, filename.ext0.1, ...
 
   const char *config_filename = argv[1];
   const int32_t num_inputs = atoi(argv[2]);
   const char *input_prefix = argv[3];
   const char *output_file = argv[4];
+  const int32_t num_records = argc > 5 ? atoi(argv[5]) : 0;
+  const int32_t num_threads = argc > 6 ? atoi(argv[6]) : 0;
+  if (argc > 5 && num_records <= 0)
+  {
+    std::cerr << "ERROR: num_records should be positive" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (num_threads < 0)
+  {
+    std::cerr << "ERROR: num_threads should not be negative" << std::endl;
+    return EXIT_FAILURE;
+  }
 
   prunner::PModelsRunner pmrunner;
 
@@ -49,14 +64,14 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
 
   INFO(l) << "Read input file: " << input_prefix << ", #inputs: " << num_inputs << std::endl;
-  pmrunner.load_inputs(input_prefix, num_inputs);
+  pmrunner.set_inputs(input_prefix, num_inputs, num_records);
+
+  INFO(l) << "Save output file: " << output_file << std::endl;
+  pmrunner.set_outputs(output_file);
 
   INFO(l) << "Run all partitioned models..." << std::endl;
-  if (!pmrunner.run())
+  if (!pmrunner.run(num_threads))
     return EXIT_FAILURE;
 
-  INFO(l) << "Save output file: " << output_file << std::endl;
-  pmrunner.save_outputs(output_file);
-
   return EXIT_SUCCESS;
 }
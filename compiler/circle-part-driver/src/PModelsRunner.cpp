@@ -26,8 +26,10 @@
 #include <foder/FileLoader.h>
 #include <crew/PConfig.h>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <thread>
 #include <vector>
 #include <string>
 #include <stdexcept>
@@ -99,152 +101,374 @@ bool PModelsRunner::load_config(const std::string &filename)
 
   for (auto &part : _pconfig.parts)
   {
-    _models_to_run.push_back(part.model_file);
+    auto model = std::make_unique<PModel>();
+    model->part = part;
+    _models.push_back(std::move(model));
+
+    for (auto &input : part.inputs)
+      _consumers[input]++;
   }
+  // outputs of source model are consumed by saving them
+  for (auto &output : _pconfig.source.outputs)
+    _consumers[output]++;
   return true;
 }
 
-void PModelsRunner::load_inputs(const std::string &input_prefix, int32_t num_inputs)
+void PModelsRunner::set_inputs(const std::string &input_prefix, int32_t num_inputs,
+                               uint32_t num_records)
+{
+  _input_prefix = input_prefix;
+  _num_inputs = num_inputs;
+  _num_records = num_records;
+}
+
+void PModelsRunner::set_outputs(const std::string &output_file) { _output_file = output_file; }
+
+void PModelsRunner::load_models(void)
+{
+  LOGGER(l);
+
+  // Interpreter of each model is made once and reused for all records
+  for (auto &model : _models)
+  {
+    if (model->interpreter)
+      continue;
+
+    INFO(l) << "Load model: " << model->part.model_file << std::endl;
+    model->module = import_circle(model->part.model_file);
+    model->interpreter = std::make_unique<luci_interpreter::Interpreter>(model->module.get());
+  }
+
+  // load source model as we need to get both shape and node name of outputs
+  // TODO check for unknown shape
+  if (!_source)
+  {
+    INFO(l) << "Load source model: " << _pconfig.source.model_file << std::endl;
+    _source = import_circle(_pconfig.source.model_file);
+  }
+}
+
+std::string PModelsRunner::record_filename(const std::string &prefix, uint32_t index,
+                                           uint32_t record) const
+{
+  auto filename = prefix + std::to_string(index);
+  if (_num_records > 0)
+    filename += "." + std::to_string(record);
+  return filename;
+}
+
+/**
+ * @brief store data of a tensor to the record, unless nothing consumes it
+ */
+void PModelsRunner::store(PRecord &record, const std::string &name, Buffer &&data)
+{
+  auto it = _consumers.find(name);
+  if (it == _consumers.end())
+    return;
+
+  // There should not exist same output names
+  // TODO check with multiple virtual outputs
+  assert(record.data.find(name) == record.data.end());
+  record.data[name] = std::move(data);
+  record.uses[name] = it->second;
+}
+
+PRecord PModelsRunner::load_record(uint32_t record)
 {
   LOGGER(l);
 
+  PRecord data;
   auto its = _pconfig.source.inputs.begin();
-  for (int32_t i = 0; i < num_inputs; ++i, ++its)
+  for (int32_t i = 0; i < _num_inputs; ++i, ++its)
   {
-    std::string filename = input_prefix + std::to_string(i);
+    std::string filename = record_filename(_input_prefix, i, record);
 
     INFO(l) << "Load input data: " << filename << std::endl;
     foder::FileLoader file_loader{filename};
 
     std::string input_name = *its;
-    _data_stage[input_name] = file_loader.load();
+    store(data, input_name, file_loader.load());
+  }
+  return data;
+}
+
+void PModelsRunner::save_record(uint32_t record, PRecord &data)
+{
+  LOGGER(l);
+
+  const auto output_nodes = loco::output_nodes(_source->graph());
+  for (uint32_t i = 0; i < _source->graph()->outputs()->size(); i++)
+  {
+    const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+
+    auto output_name = output_node->name();
+    INFO(l) << "Save output node: " << output_name << " #" << record << std::endl;
+    auto it = data.data.find(output_name);
+    if (it == data.data.end())
+      throw std::runtime_error("Output '" + output_name + "' is not found");
+
+    auto &tensor_data = it->second;
+    auto output_filename = record_filename(_output_file, i, record);
 
-    INFO(l) << "Input: [" << input_name << "], size " << _data_stage[input_name].size()
-            << std::endl;
+    write_file(output_filename, tensor_data.data(), tensor_data.size());
+    save_shape(output_filename + ".shape", output_node);
   }
 }
 
 /**
- * @brief return true if all inputs of the model is ready in _data_storage
+ * @brief return true if all inputs of the model is ready in data_stage
  */
-bool PModelsRunner::is_input_ready(const RunModel &model)
+bool PModelsRunner::is_input_ready(const PModel &model, const Buffers &data_stage)
 {
-  for (auto &part : _pconfig.parts)
+  for (auto &input : model.part.inputs)
+  {
+    auto it = data_stage.find(input);
+    if (it == data_stage.end())
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief queue models whose inputs of next record are ready, should be called with _mutex
+ */
+void PModelsRunner::schedule(void)
+{
+  LOGGER(l);
+
+  if (_failed)
+    return;
+
+  const auto num_records = std::max(_num_records, 1u);
+  for (auto &model : _models)
   {
-    if (part.model_file != model)
+    // a model runs records in order, one at a time
+    if (model->busy || model->records_done == num_records)
       continue;
 
-    for (auto &input : part.inputs)
+    // next record may not be loaded yet
+    const auto record = model->records_done;
+    auto it = _records.find(record);
+    if (it == _records.end())
+      continue;
+
+    INFO(l) << "Check model input ready: " << model->part.model_file << " #" << record << std::endl;
+    if (is_input_ready(*model, it->second.data))
     {
-      auto it = _data_stage.find(input);
-      if (it == _data_stage.end())
-        return false;
+      model->busy = true;
+      _ready.emplace_back(model.get(), record);
+    }
+  }
+
+  if (_ready.empty() && _running == 0)
+  {
+    bool all_done = std::all_of(_models.begin(), _models.end(), [&](const auto &model) {
+      return model->records_done == num_records;
+    });
+    if (all_done)
+      _finished = true;
+    else
+    {
+      std::cerr << "ERROR: model partition or configuration has problems" << std::endl;
+      _failed = true;
     }
   }
-  return true;
 }
 
-bool PModelsRunner::run(void)
+void PModelsRunner::worker(void)
 {
-  LOGGER(l);
-
-  // for each partitioned model, if the inputs of the model are ready, run the model
-  do
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true)
   {
-    bool found_model = false;
+    _cv.wait(lock, [&] { return !_ready.empty() || _finished || _failed; });
+    if (_finished || _failed)
+      break;
+
+    auto [model, record] = _ready.front();
+    _ready.pop_front();
+    _running++;
 
-    for (auto it = _models_to_run.begin(); it != _models_to_run.end(); ++it)
+    lock.unlock();
+    bool success = true;
+    try
+    {
+      run_model(*model, record);
+      finish_model(*model, record);
+    }
+    catch (const std::exception &e)
     {
-      auto model_fname = *it;
+      std::cerr << "ERROR: failed to run " << model->part.model_file << ": " << e.what()
+                << std::endl;
+      success = false;
+    }
+    lock.lock();
 
-      INFO(l) << "Check model input ready: " << model_fname << std::endl;
-      if (is_input_ready(model_fname))
-      {
-        found_model = true;
+    _running--;
+    if (!success)
+      _failed = true;
+    schedule();
+    _cv.notify_all();
+  }
+}
+
+void PModelsRunner::run_model(PModel &model, uint32_t record)
+{
+  LOGGER(l);
 
-        INFO(l) << "Run model: " << model_fname << std::endl;
-        auto module = import_circle(model_fname);
+  auto &module = model.module;
+  auto &interpreter = model.interpreter;
 
-        luci_interpreter::Interpreter interpreter(module.get());
+  // Find inputs: elements of std::map are not moved by insertion of others, and inputs are
+  // not freed until this model is done with the record
+  std::vector<const Buffer *> inputs;
+  const auto input_nodes = loco::input_nodes(module->graph());
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
 
-        // Set input
-        const auto input_nodes = loco::input_nodes(module->graph());
-        int32_t num_inputs = static_cast<int32_t>(input_nodes.size());
-        for (int32_t i = 0; i < num_inputs; i++)
-        {
-          const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+    INFO(l) << "Run model: " << model.part.model_file << " #" << record << std::endl;
 
-          auto input_name = input_node->name();
-          assert(_data_stage.find(input_name) != _data_stage.end());
+    auto &data_stage = _records.at(record).data;
+    for (auto node : input_nodes)
+    {
+      const auto *input_node = loco::must_cast<const luci::CircleInput *>(node);
+      auto it = data_stage.find(input_node->name());
+      if (it == data_stage.end())
+        throw std::runtime_error("Input '" + input_node->name() + "' is not ready");
+      inputs.push_back(&it->second);
+    }
+  }
 
-          auto input_data = _data_stage[input_name];
+  // Set input
+  for (size_t i = 0; i < input_nodes.size(); i++)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+    interpreter->writeInputTensor(input_node, inputs[i]->data(), inputs[i]->size());
+  }
 
-          interpreter.writeInputTensor(input_node, input_data.data(), input_data.size());
-        }
+  // Run interpreter
+  interpreter->interpret();
 
-        // Run interpreter
-        interpreter.interpret();
-        INFO(l) << "Run model: " << model_fname << " done" << std::endl;
+  // Get output.
+  Buffers outputs;
+  const auto output_nodes = loco::output_nodes(module->graph());
+  for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+  {
+    const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
 
-        // Get output.
-        const auto output_nodes = loco::output_nodes(module->graph());
-        for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
-        {
-          const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
-          auto output_name = output_node->name();
+    Buffer output_data(tensor_size(output_node));
+    interpreter->readOutputTensor(output_node, output_data.data(), output_data.size());
+    outputs[output_node->name()] = std::move(output_data);
+  }
 
-          Buffer output_data(tensor_size(output_node));
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto &data = _records.at(record);
+    for (auto &output : outputs)
+      store(data, output.first, std::move(output.second));
+
+    INFO(l) << "Run model: " << model.part.model_file << " #" << record << " done" << std::endl;
+  }
+}
 
-          interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
+/**
+ * @brief free inputs of the model no longer used, and once all models are done with the record
+ *        save its outputs and load the next record into the window
+ */
+void PModelsRunner::finish_model(PModel &model, uint32_t record)
+{
+  PRecord done;
+  bool load_next = false;
+  uint32_t next = 0;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
 
-          // There should not exist same output names
-          // TODO check with multiple virtual outputs
-          assert(_data_stage.find(output_name) == _data_stage.end());
-          _data_stage[output_name] = output_data;
-        }
+    model.busy = false;
+    model.records_done++;
 
-        // We've ran this model, remove from the model list
-        _models_to_run.erase(it);
-        break;
+    auto &data = _records.at(record);
+    for (auto &input : model.part.inputs)
+    {
+      if (--data.uses.at(input) == 0)
+      {
+        data.data.erase(input);
+        data.uses.erase(input);
       }
     }
+    if (++data.models_done < _models.size())
+      return;
 
-    if (not found_model)
+    done = std::move(data);
+    _records.erase(record);
+    if (_records_loaded < std::max(_num_records, 1u))
     {
-      std::cerr << "ERROR: model partition or configuration has problems" << std::endl;
-      return false;
+      next = _records_loaded++;
+      load_next = true;
     }
-  } while (not _models_to_run.empty());
+  }
 
-  return true;
+  // file I/O runs outside the lock, while this task is still counted as running
+  save_record(record, done);
+  if (load_next)
+  {
+    auto data = load_record(next);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _records.emplace(next, std::move(data));
+  }
 }
 
-void PModelsRunner::save_outputs(const std::string &output_file)
+bool PModelsRunner::run(uint32_t num_threads)
 {
   LOGGER(l);
 
-  // load source model as we need to get both shape and node name
-  // TODO check for unknown shape
-  auto source_fname = _pconfig.source.model_file;
+  const auto num_records = std::max(_num_records, 1u);
+  // a model runs one record at a time, so one more record than models keeps every model busy
+  const auto window = std::min(num_records, static_cast<uint32_t>(_models.size()) + 1);
 
-  INFO(l) << "save_outputs() loading file: " << source_fname << std::endl;
-  auto module = import_circle(source_fname);
+  try
+  {
+    load_models();
 
-  const auto output_nodes = loco::output_nodes(module->graph());
-  for (uint32_t i = 0; i < module->graph()->outputs()->size(); i++)
+    _records.clear();
+    for (_records_loaded = 0; _records_loaded < window; ++_records_loaded)
+      _records.emplace(_records_loaded, load_record(_records_loaded));
+  }
+  catch (const std::exception &e)
   {
-    const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+    std::cerr << "ERROR: " << e.what() << std::endl;
+    return false;
+  }
 
-    auto output_name = output_node->name();
-    INFO(l) << "save_outputs() save output node: " << output_name << std::endl;
-    assert(_data_stage.find(output_name) != _data_stage.end());
+  // more threads than models are idle, as a model runs one record at a time
+  if (num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  num_threads = std::min<uint32_t>(num_threads, std::max<size_t>(_models.size(), 1));
 
-    auto tensor_data = _data_stage[output_name];
-    auto output_filename = output_file + std::to_string(i);
+  INFO(l) << "Run " << _models.size() << " models, " << num_records << " records in window of "
+          << window << " with " << num_threads << " threads" << std::endl;
 
-    write_file(output_filename, tensor_data.data(), tensor_data.size());
-    save_shape(output_filename + ".shape", output_node);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished = false;
+    _failed = false;
+    _ready.clear();
+    _running = 0;
+    for (auto &model : _models)
+    {
+      model->busy = false;
+      model->records_done = 0;
+    }
+    schedule();
   }
+
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < num_threads; ++t)
+    workers.emplace_back(&PModelsRunner::worker, this);
+  for (auto &worker : workers)
+    worker.join();
+
+  return !_failed;
 }
 
 } // namespace prunner
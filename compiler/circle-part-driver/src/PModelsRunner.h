@@ -18,8 +18,14 @@
 #define __CIRCLE_PRUNNER_PMODELS_RUNNER_H__
 
 #include <crew/PConfig.h>
+#include <luci/IR/Module.h>
+#include <luci_interpreter/Interpreter.h>
 
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -35,8 +41,41 @@ using RunModel = std::string;
 using RunModels = std::vector<RunModel>;
 
 /**
- * @brief PModelsRunner runs partitioned models from input data file and stores
- *        output data to a file
+ * @brief Partitioned model with its own interpreter, which is kept while running records
+ */
+struct PModel
+{
+  crew::Part part;
+  std::unique_ptr<luci::Module> module;
+  std::unique_ptr<luci_interpreter::Interpreter> interpreter;
+
+  // true while running a record, as an interpreter runs one record at a time
+  bool busy = false;
+  // number of records done, which is also the index of the next record to run
+  uint32_t records_done = 0;
+};
+
+/**
+ * @brief Tensors of a record, each of which is freed after its last consumer has run
+ */
+struct PRecord
+{
+  Buffers data;
+  // number of consumers left for each tensor of data, including saving source outputs
+  std::map<std::string, uint32_t> uses;
+  // number of models done with this record
+  uint32_t models_done = 0;
+};
+
+/**
+ * @brief PModelsRunner runs partitioned models from input data files and stores
+ *        output data to files
+ *
+ * Partitioned models run as dataflow: every model whose inputs are ready runs in parallel
+ * on worker threads. With multiple records, records stream through models in order so that
+ * different models can work on different records at the same time. Only a window of records
+ * is kept in memory; inputs are loaded when a record enters the window and outputs are saved
+ * when all models are done with it.
  */
 class PModelsRunner
 {
@@ -45,17 +84,57 @@ public:
 
 public:
   bool load_config(const std::string &filename);
-  void load_inputs(const std::string &input_prefix, int32_t num_inputs);
-  bool run(void);
-  void save_outputs(const std::string &output_file);
+  /**
+   * @brief Set input data files named input_prefix + input index, with "." + record index
+   *        appended if num_records is given, which are loaded while running
+   */
+  void set_inputs(const std::string &input_prefix, int32_t num_inputs, uint32_t num_records = 0);
+  /**
+   * @brief Set output data files named like input data files, which are saved while running
+   */
+  void set_outputs(const std::string &output_file);
+  /**
+   * @brief Run with num_threads worker threads, hardware concurrency if 0
+   */
+  bool run(uint32_t num_threads = 0);
 
 private:
-  bool is_input_ready(const RunModel &model);
+  void load_models(void);
+  std::string record_filename(const std::string &prefix, uint32_t index, uint32_t record) const;
+  void store(PRecord &record, const std::string &name, Buffer &&data);
+  PRecord load_record(uint32_t record);
+  void save_record(uint32_t record, PRecord &data);
+  bool is_input_ready(const PModel &model, const Buffers &data_stage);
+  void schedule(void);
+  void worker(void);
+  void run_model(PModel &model, uint32_t record);
+  void finish_model(PModel &model, uint32_t record);
 
 private:
   crew::PConfig _pconfig;
-  RunModels _models_to_run;
-  Buffers _data_stage;
+  std::vector<std::unique_ptr<PModel>> _models;
+  // source model to get names and shapes of outputs
+  std::unique_ptr<luci::Module> _source;
+
+  std::string _input_prefix;
+  int32_t _num_inputs = 0;
+  // 0 if records are not indexed in file names, which runs one record
+  uint32_t _num_records = 0;
+  std::string _output_file;
+
+  // number of models consuming each tensor
+  std::map<std::string, uint32_t> _consumers;
+
+  // scheduling of (model, record) tasks to workers
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  // records in the window, erased after outputs are saved
+  std::map<uint32_t, PRecord> _records;
+  uint32_t _records_loaded = 0;
+  std::deque<std::pair<PModel *, uint32_t>> _ready;
+  uint32_t _running = 0;
+  bool _finished = false;
+  bool _failed = false;
 };
 
 } // namespace prunner
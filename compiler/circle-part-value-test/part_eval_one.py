@@ -26,6 +26,7 @@ circle_model = args.name + ".circle"
 partition_conn_ini = args.name + ".conn.ini"
 partition_conn_json = args.name + ".conn.json"
 expected_count = args.name + ".excnt"
+records_file = args.name + ".records"
 
 # Check expected count of models from partitioning
 try:
@@ -65,38 +66,69 @@ if full_signatures != None:
         for index, (key, value) in enumerate(signature_outputs.items()):
             full_signatures_outputs_remap.append(value)
 
-# Generate random input data.
+# Read number of records and threads to run circle-part-driver with, if given
+num_records = 0
+num_threads = 0
+try:
+    with open(records_file, "r") as records:
+        num_records, num_threads = [int(v) for v in records.readline().split()]
+    print("Run with records, threads: ", num_records, num_threads)
+except FileNotFoundError:
+    pass
+
+
+def record_suffix(record):
+    # record index is appended to I/O file names with records
+    return "." + str(record) if num_records > 0 else ""
+
+
 num_inputs = len(interpreter.get_input_details())
-for i in range(num_inputs):
-    input_details = interpreter.get_input_details()[i]
-    input_details_dtype = input_details["dtype"]
-    input_details_shape = input_details["shape"]
-    if input_details_dtype == np.float32:
-        input_data = np.array(np.random.random_sample(input_details_shape),
-                              input_details_dtype)
-    elif input_details_dtype == np.int16:
-        input_data = np.array(np.random.randint(0, 100, size=input_details_shape),
-                              input_details_dtype)
-    elif input_details_dtype == np.uint8:
-        input_data = np.array(np.random.randint(0, 256, size=input_details_shape),
-                              input_details_dtype)
-    elif input_details_dtype == np.bool_:
-        input_data = np.array(np.random.choice(a=[True, False], size=input_details_shape),
-                              input_details_dtype)
-    else:
-        raise SystemExit("Unsupported input dtype")
+inpt_output_details = interpreter.get_output_details()
+intp_outputs = []
+for record in range(max(num_records, 1)):
+    # Generate random input data.
+    for i in range(num_inputs):
+        input_details = interpreter.get_input_details()[i]
+        input_details_dtype = input_details["dtype"]
+        input_details_shape = input_details["shape"]
+        if input_details_dtype == np.float32:
+            input_data = np.array(np.random.random_sample(input_details_shape),
+                                  input_details_dtype)
+        elif input_details_dtype == np.int16:
+            input_data = np.array(np.random.randint(0, 100, size=input_details_shape),
+                                  input_details_dtype)
+        elif input_details_dtype == np.uint8:
+            input_data = np.array(np.random.randint(0, 256, size=input_details_shape),
+                                  input_details_dtype)
+        elif input_details_dtype == np.bool_:
+            input_data = np.array(
+                np.random.choice(a=[True, False], size=input_details_shape),
+                input_details_dtype)
+        else:
+            raise SystemExit("Unsupported input dtype")
+
+        interpreter.set_tensor(input_details["index"], input_data)
+        input_data.tofile(circle_model + ".input" + str(i) + record_suffix(record))
 
-    interpreter.set_tensor(input_details["index"], input_data)
-    input_data.tofile(circle_model + ".input" + str(i))
+    # Do inference
+    interpreter.invoke()
 
-# Do inference
-interpreter.invoke()
+    # Keep results of TFLite interpreter to compare
+    record_outputs = []
+    for idx in range(len(inpt_output_details)):
+        output_tensor = inpt_output_details[idx]["index"]
+        if full_signatures_outputs_remap != None:
+            output_tensor = full_signatures_outputs_remap[idx]
+        record_outputs.append(interpreter.get_tensor(output_tensor))
+    intp_outputs.append(record_outputs)
 
 # Execute circle-part-driver.
 partition_command = [
     driver, partition_conn_ini,
     str(num_inputs), circle_model + ".input", circle_model + ".output"
 ]
+if num_records > 0:
+    partition_command += [str(num_records), str(num_threads)]
 print("Run: ")
 for arg in partition_command:
     print("    ", arg, "\\")
@@ -105,44 +137,46 @@ print("", flush=True)
 subprocess.run(partition_command, check=True)
 
 # Compare the results.
-inpt_output_details = interpreter.get_output_details()
-for idx in range(len(inpt_output_details)):
-    output_details = inpt_output_details[idx]
-    output_dtype = output_details["dtype"]
-    output_data = np.fromfile(circle_model + ".output" + str(idx), output_dtype)
-    shape_file = open(circle_model + ".output" + str(idx) + ".shape", 'r')
-    output_shape = [int(i) for i in shape_file.read().split(',')]
-    luci_output_data = np.reshape(output_data, output_shape)
-    output_tensor = output_details["index"]
-    if full_signatures_outputs_remap != None:
-        output_tensor = full_signatures_outputs_remap[idx]
-    intp_output_data = interpreter.get_tensor(output_tensor)
-    try:
-        if output_dtype == np.uint8:
-            if np.allclose(luci_output_data, intp_output_data, rtol=0, atol=0) == False:
-                raise SystemExit("Execution result of " + tflite_model +
-                                 " does not match with " + circle_model)
-        elif output_dtype == np.float32:
-            if np.allclose(luci_output_data, intp_output_data, rtol=1.e-5,
-                           atol=1.e-5) == False:
-                raise SystemExit("Execution result of " + tflite_model +
-                                 " does not match with " + circle_model)
-        elif output_dtype == np.int64:
-            if np.allclose(luci_output_data, intp_output_data, rtol=0, atol=0) == False:
-                raise SystemExit("Execution result of " + tflite_model +
-                                 " does not match with " + circle_model)
-        elif output_dtype == np.int32:
-            if np.allclose(luci_output_data, intp_output_data, rtol=0, atol=0) == False:
-                raise SystemExit("Execution result of " + tflite_model +
-                                 " does not match with " + circle_model)
-        elif output_dtype == np.int16:
-            if np.allclose(luci_output_data, intp_output_data, rtol=0, atol=0) == False:
-                raise SystemExit("Execution result of " + tflite_model +
-                                 " does not match with " + circle_model)
-        else:
-            raise SystemExit("Unsupported data type: ", output_dtype)
-    except:
-        print(traceback.format_exc())
-        quit(255)
+for record in range(max(num_records, 1)):
+    for idx in range(len(inpt_output_details)):
+        output_details = inpt_output_details[idx]
+        output_dtype = output_details["dtype"]
+        output_file = circle_model + ".output" + str(idx) + record_suffix(record)
+        output_data = np.fromfile(output_file, output_dtype)
+        shape_file = open(output_file + ".shape", 'r')
+        output_shape = [int(i) for i in shape_file.read().split(',')]
+        luci_output_data = np.reshape(output_data, output_shape)
+        intp_output_data = intp_outputs[record][idx]
+        try:
+            if output_dtype == np.uint8:
+                if np.allclose(luci_output_data, intp_output_data, rtol=0,
+                               atol=0) == False:
+                    raise SystemExit("Execution result of " + tflite_model +
+                                     " does not match with " + circle_model)
+            elif output_dtype == np.float32:
+                if np.allclose(luci_output_data, intp_output_data, rtol=1.e-5,
+                               atol=1.e-5) == False:
+                    raise SystemExit("Execution result of " + tflite_model +
+                                     " does not match with " + circle_model)
+            elif output_dtype == np.int64:
+                if np.allclose(luci_output_data, intp_output_data, rtol=0,
+                               atol=0) == False:
+                    raise SystemExit("Execution result of " + tflite_model +
+                                     " does not match with " + circle_model)
+            elif output_dtype == np.int32:
+                if np.allclose(luci_output_data, intp_output_data, rtol=0,
+                               atol=0) == False:
+                    raise SystemExit("Execution result of " + tflite_model +
+                                     " does not match with " + circle_model)
+            elif output_dtype == np.int16:
+                if np.allclose(luci_output_data, intp_output_data, rtol=0,
+                               atol=0) == False:
+                    raise SystemExit("Execution result of " + tflite_model +
+                                     " does not match with " + circle_model)
+            else:
+                raise SystemExit("Unsupported data type: ", output_dtype)
+        except:
+            print(traceback.format_exc())
+            quit(255)
 
 quit(0)
@@ -2,5 +2,6 @@ require("crew")
 require("pepper-csv2vec")
 require("safemain")
 require("luci")
+require("luci-interpreter")
 require("arser")
 require("vconone")
@@ -15,6 +15,7 @@
  */
 
 #include "PartitionRead.h"
+#include "PartitionCost.h"
 #include "PartitionExport.h"
 #include "HelperPath.h"
 
@@ -23,6 +24,7 @@
 #include <luci/CircleExporter.h>
 #include <luci/CircleFileExpContract.h>
 #include <luci/CircleOptimizer.h>
+#include <luci/PartitionAuto.h>
 #include <luci/PartitionDump.h>
 #include <luci/PartitionValidate.h>
 #include <luci/Log.h>
@@ -42,6 +44,11 @@ const char *opt_def = "--default";
 const char *opt_part_file = "--part_file";
 const char *opt_input_file = "--input_file";
 const char *opt_work_path = "--work_path";
+const char *opt_auto = "--auto";
+const char *opt_auto_cost_file = "--auto_cost_file";
+const char *opt_auto_profile = "--auto_profile";
+const char *opt_auto_transfer_cost = "--auto_transfer_cost";
+const char *opt_auto_tolerance = "--auto_tolerance";
 
 void print_version(void)
 {
@@ -63,6 +70,26 @@ void build_arser(arser::Arser &arser)
   arser.add_argument(opt_input_file).required(true).help("Input circle model filename");
   arser.add_argument(opt_work_path)
     .help("Work folder of partition, input files exist and output files are produced");
+
+  arser.add_argument(opt_auto)
+    .nargs(0)
+    .default_value(false)
+    .help("Assign ops to backends in order as balanced pipeline stages by cost, "
+          "instead of OPCODE/OPNAME of partition file");
+  arser.add_argument(opt_auto_cost_file)
+    .help("CSV file of 'opname,cost' lines for measured cost of ops in auto partition");
+  arser.add_argument(opt_auto_profile)
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help("Number of luci-interpreter runs to measure cost of ops in auto partition");
+  arser.add_argument(opt_auto_transfer_cost)
+    .type(arser::DataType::FLOAT)
+    .default_value(0.0f)
+    .help("Cost to transfer a byte of tensor between partitions in auto partition");
+  arser.add_argument(opt_auto_tolerance)
+    .type(arser::DataType::FLOAT)
+    .default_value(0.1f)
+    .help("Allowed ratio over minimal stage cost to reduce transfer in auto partition");
 }
 
 std::unique_ptr<luci::Module> load_model(const std::string &input_path)
@@ -125,9 +152,11 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  const bool auto_partition = arser.get<bool>(opt_auto);
+
   // Read partition information
   INFO(l) << "--- Read PartitionConfig-----------------------" << std::endl;
-  auto partition = partee::read(partition_path);
+  auto partition = partee::read(partition_path, !auto_partition);
   INFO(l) << partition << std::endl;
 
   // override with command line arguments
@@ -148,6 +177,40 @@ int entry(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  if (auto_partition)
+  {
+    INFO(l) << "--- Auto Partition-----------------------------" << std::endl;
+    luci::PartitionCost cost;
+    cost.transfer_per_byte = arser.get<float>(opt_auto_transfer_cost);
+    cost.balance_tolerance = arser.get<float>(opt_auto_tolerance);
+    try
+    {
+      auto profile_runs = arser.get<int32_t>(opt_auto_profile);
+      if (profile_runs > 0)
+        partee::profile_cost(module.get(), static_cast<uint32_t>(profile_runs), cost);
+      // measured cost from file overrides profiled one
+      if (arser[opt_auto_cost_file])
+        partee::read_cost(work_folder + "/" + arser.get<std::string>(opt_auto_cost_file), cost);
+
+      auto stats = luci::auto_partition(module.get(), partition, cost);
+      for (size_t s = 0; s < stats.stage_costs.size(); ++s)
+      {
+        std::cout << "Stage " << partition.groups.at(s) << ": cost " << stats.stage_costs.at(s)
+                  << ", input bytes from previous stages " << stats.stage_inbytes.at(s)
+                  << std::endl;
+      }
+
+      auto auto_part_path = partee::make_path(work_folder, input_path, "auto.part");
+      partee::write(auto_part_path, partition);
+      INFO(l) << "--- Auto partition file: " << auto_part_path << std::endl;
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "ERROR: Failed to partition automatically: " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   INFO(l) << "--- PartitionConfig final----------------------" << std::endl;
   INFO(l) << partition << std::endl;
 
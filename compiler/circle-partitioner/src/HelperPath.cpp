@@ -66,4 +66,12 @@ std::string make_path(const std::string &base, const std::string &input, uint32_
   return base + "/" + filename + "." + seq_fmt + "_" + backend + "." + ext;
 }
 
+std::string make_path(const std::string &base, const std::string &input, const std::string &ext)
+{
+  auto filename_ext = get_filename_ext(input);
+  auto filename = filename_ext.substr(0, filename_ext.find_last_of("."));
+
+  return base + "/" + filename + "." + ext;
+}
+
 } // namespace partee
@@ -39,6 +39,11 @@ std::string get_filename_ext(const std::string &base);
 std::string make_path(const std::string &base, const std::string &input, uint32_t idx,
                       const std::string &backend);
 
+/**
+ * @brief Make file path from base and input with extension replaced by ext
+ */
+std::string make_path(const std::string &base, const std::string &input, const std::string &ext);
+
 } // namespace partee
 
 #endif // __CIRCLE_HELPER_PATH_H__
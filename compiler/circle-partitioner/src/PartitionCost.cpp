@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+
+#include <crew/PConfigIni.h>
+#include <luci_interpreter/Interpreter.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/DataTypeHelper.h>
+#include <luci/Log.h>
+#include <loco.h>
+
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+class CostObserver final : public luci_interpreter::ExecutionObserver
+{
+public:
+  explicit CostObserver(const loco::Graph *graph) : _graph{graph} {}
+
+public:
+  void preOperatorExecute(const luci::CircleNode *) override
+  {
+    _begins.push_back(std::chrono::steady_clock::now());
+  }
+
+  void postOperatorExecute(const luci::CircleNode *node) override
+  {
+    // NOTE Ops of subgraphs run inside their owner op like IF, so begins works as a stack
+    std::chrono::duration<double, std::micro> elapsed =
+      std::chrono::steady_clock::now() - _begins.back();
+    _begins.pop_back();
+
+    // only ops of main graph are partitioned
+    if (node->graph() == _graph)
+      _run_costs[node->name()] += elapsed.count();
+  }
+
+  // keep minimum cost of each op over runs
+  void end_run(void)
+  {
+    for (auto &[name, run_cost] : _run_costs)
+    {
+      auto it = _costs.find(name);
+      if (it == _costs.end() || run_cost < it->second)
+        _costs[name] = run_cost;
+    }
+    _run_costs.clear();
+  }
+
+  const std::unordered_map<std::string, double> &costs(void) const { return _costs; }
+
+private:
+  const loco::Graph *_graph;
+  std::vector<std::chrono::steady_clock::time_point> _begins;
+  std::unordered_map<std::string, double> _run_costs;
+  std::unordered_map<std::string, double> _costs;
+};
+
+size_t tensor_size(const luci::CircleNode *node)
+{
+  size_t tensor_size = luci::size(node->dtype());
+  for (uint32_t i = 0; i < node->rank(); ++i)
+    tensor_size *= node->dim(i).known() ? node->dim(i).value() : 1;
+  return tensor_size;
+}
+
+} // namespace
+
+namespace partee
+{
+
+void read_cost(const std::string &path, luci::PartitionCost &cost)
+{
+  LOGGER(l);
+
+  std::ifstream file(path);
+  if (!file.is_open())
+    throw std::runtime_error("Failed to open cost file: " + path);
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    auto comma = line.rfind(',');
+    if (comma == std::string::npos)
+      continue;
+
+    std::istringstream value(line.substr(comma + 1));
+    double op_cost = 0.0;
+    if (!(value >> op_cost))
+    {
+      INFO(l) << "Skip cost line: " << line << std::endl;
+      continue;
+    }
+    cost.byopnames[line.substr(0, comma)] = op_cost;
+  }
+}
+
+void profile_cost(const luci::Module *module, uint32_t runs, luci::PartitionCost &cost)
+{
+  LOGGER(l);
+
+  luci_interpreter::Interpreter interpreter(module);
+  CostObserver observer(module->graph());
+  interpreter.attachObserver(&observer);
+
+  for (auto node : loco::input_nodes(module->graph()))
+  {
+    auto input_node = loco::must_cast<const luci::CircleInput *>(node);
+    std::vector<char> zeros(tensor_size(input_node), 0);
+    interpreter.writeInputTensor(input_node, zeros.data(), zeros.size());
+  }
+
+  for (uint32_t r = 0; r < runs; ++r)
+  {
+    interpreter.interpret();
+    observer.end_run();
+  }
+
+  for (auto &[name, op_cost] : observer.costs())
+  {
+    INFO(l) << "Profiled cost: " << name << " " << op_cost << " us" << std::endl;
+    cost.byopnames[name] = op_cost;
+  }
+}
+
+void write(const std::string &path, const luci::PartitionTable &partition)
+{
+  crew::Section section_partition;
+  section_partition.name = "partition";
+  std::string backends;
+  for (auto &group : partition.groups)
+    backends += (backends.empty() ? "" : ",") + group;
+  section_partition.items["backends"] = backends;
+  section_partition.items["default"] = partition.default_group;
+  section_partition.items["comply"] = "opname";
+
+  crew::Section section_opname;
+  section_opname.name = "OPNAME";
+  for (auto &[opname, group] : partition.byopnames)
+    section_opname.items[opname] = group;
+
+  crew::write_ini(path, {section_partition, section_opname});
+}
+
+} // namespace partee
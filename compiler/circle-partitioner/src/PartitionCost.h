@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CIRCLE_PARTITION_COST_H__
+#define __CIRCLE_PARTITION_COST_H__
+
+#include <luci/IR/Module.h>
+#include <luci/Partition.h>
+#include <luci/PartitionAuto.h>
+
+#include <string>
+
+namespace partee
+{
+
+/**
+ * @brief Reads measured cost of ops from CSV file with "opname,cost" lines
+ * @note  Lines starting with '#' and lines without numeric cost like header are skipped
+ */
+void read_cost(const std::string &path, luci::PartitionCost &cost);
+
+/**
+ * @brief Measures cost of ops in us by running module with luci-interpreter
+ * @note  Minimum time of runs is used for each op. Inputs are filled with zero.
+ */
+void profile_cost(const luci::Module *module, uint32_t runs, luci::PartitionCost &cost);
+
+/**
+ * @brief Writes PartitionTable as partition file to reuse result of automatic partitioning
+ */
+void write(const std::string &path, const luci::PartitionTable &partition);
+
+} // namespace partee
+
+#endif // __CIRCLE_PARTITION_COST_H__
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionCost.h"
+#include "PartitionRead.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+class TempFile
+{
+public:
+  TempFile()
+  {
+    char name[] = "/tmp/partee.cost.XXXXXX";
+    int fd = mkstemp(name);
+    if (fd == -1)
+      throw std::runtime_error{"mkstemp failed"};
+    close(fd);
+    _path = name;
+  }
+
+  ~TempFile() { std::remove(_path.c_str()); }
+
+public:
+  const std::string &path(void) const { return _path; }
+
+  void write(const std::string &content)
+  {
+    std::ofstream file(_path);
+    file << content;
+  }
+
+private:
+  std::string _path;
+};
+
+class SqrtGraphlet
+{
+public:
+  SqrtGraphlet() = default;
+
+public:
+  void init(loco::Graph *g, const ShapeU32 input_shape)
+  {
+    _sqrt = g->nodes()->create<luci::CircleSqrt>();
+    _sqrt->dtype(loco::DataType::FLOAT32);
+    _sqrt->shape(input_shape);
+    _sqrt->shape_status(luci::ShapeStatus::VALID);
+    _sqrt->name("sqrt");
+  }
+
+protected:
+  luci::CircleSqrt *_sqrt = nullptr;
+};
+
+class SqrtGraph : public TestIOGraph, public SqrtGraphlet
+{
+public:
+  SqrtGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+    SqrtGraphlet::init(g(), shape);
+
+    _sqrt->x(input());
+    output()->from(_sqrt);
+  }
+};
+
+} // namespace
+
+TEST(PartitionCostTest, read_cost)
+{
+  TempFile file;
+  file.write("# measured on target\n"
+             "opname,cost\n"
+             "conv,120.5\n"
+             "add,3\n"
+             "\n"
+             "name,with,comma,7\n");
+
+  luci::PartitionCost cost;
+  cost.byopnames["add"] = 10.0;
+  partee::read_cost(file.path(), cost);
+
+  ASSERT_EQ(3, cost.byopnames.size());
+  ASSERT_DOUBLE_EQ(120.5, cost.byopnames.at("conv"));
+  ASSERT_DOUBLE_EQ(3.0, cost.byopnames.at("add"));
+  ASSERT_DOUBLE_EQ(7.0, cost.byopnames.at("name,with,comma"));
+}
+
+TEST(PartitionCostTest, read_cost_no_file_NEG)
+{
+  luci::PartitionCost cost;
+
+  EXPECT_THROW(partee::read_cost("/tmp/partee.cost.not.exist", cost), std::runtime_error);
+}
+
+TEST(PartitionCostTest, profile_cost)
+{
+  luci::Module module;
+
+  SqrtGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+  partee::profile_cost(&module, 2, cost);
+
+  ASSERT_EQ(1, cost.byopnames.size());
+  ASSERT_LE(0.0, cost.byopnames.at("sqrt"));
+}
+
+TEST(PartitionCostTest, profile_cost_no_run)
+{
+  luci::Module module;
+
+  SqrtGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionCost cost;
+  partee::profile_cost(&module, 0, cost);
+
+  ASSERT_TRUE(cost.byopnames.empty());
+}
+
+TEST(PartitionCostTest, write)
+{
+  luci::PartitionTable table;
+  table.groups = {"cpu", "acl_cl"};
+  table.default_group = "cpu";
+  table.comply = luci::PartitionTable::COMPLY::OPNAME;
+  table.byopnames["conv"] = "cpu";
+  table.byopnames["add"] = "acl_cl";
+
+  TempFile file;
+  partee::write(file.path(), table);
+
+  // written file can be used as partition file
+  auto read_table = partee::read(file.path());
+
+  ASSERT_EQ(table.groups, read_table.groups);
+  ASSERT_EQ("cpu", read_table.default_group);
+  ASSERT_EQ(luci::PartitionTable::COMPLY::OPNAME, read_table.comply);
+  ASSERT_EQ(2, read_table.byopnames.size());
+  ASSERT_EQ("cpu", read_table.byopnames.at("conv"));
+  ASSERT_EQ("acl_cl", read_table.byopnames.at("add"));
+}
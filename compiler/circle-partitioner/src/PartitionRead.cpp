@@ -40,7 +40,7 @@ const char *_key_default = "default";
 const char *_key_comply = "comply";
 const char *_key_underscore = "_";
 
-luci::PartitionTable parse_table(const crew::Sections &sections)
+luci::PartitionTable parse_table(const crew::Sections &sections, bool comply_required)
 {
   luci::PartitionTable table;
 
@@ -65,6 +65,14 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
       table.groups = pepper::csv_to_vector<std::string>(items.at(_key_backends));
       table.default_group = items.at(_key_default);
 
+      if (items.find(_key_comply) == items.end())
+      {
+        // NOTE automatic partitioning assigns ops by OPNAME itself
+        if (!comply_required)
+          continue;
+        throw std::invalid_argument("'comply' is required");
+      }
+
       auto comply = items.at(_key_comply);
 
       // check valid comply types
@@ -129,7 +137,7 @@ luci::PartitionTable parse_table(const crew::Sections &sections)
 namespace partee
 {
 
-luci::PartitionTable read(const std::string &path)
+luci::PartitionTable read(const std::string &path, bool comply_required)
 {
   LOGGER(l);
 
@@ -139,7 +147,7 @@ luci::PartitionTable read(const std::string &path)
 
   INFO(l) << partition_config << std::endl;
 
-  auto partition_table = parse_table(partition_config);
+  auto partition_table = parse_table(partition_config, comply_required);
 
   return partition_table;
 }
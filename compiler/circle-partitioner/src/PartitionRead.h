@@ -29,8 +29,9 @@ namespace partee
 
 /**
  * @brief Reads and parse file and return PartitionTable
+ * @note  'comply' may be omitted when comply_required is false, e.g. for automatic partitioning
  */
-luci::PartitionTable read(const std::string &path);
+luci::PartitionTable read(const std::string &path, bool comply_required = true);
 
 } // namespace partee
 
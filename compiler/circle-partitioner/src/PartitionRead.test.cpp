@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionRead.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+namespace
+{
+
+class PartFile
+{
+public:
+  explicit PartFile(const std::string &content)
+  {
+    char name[] = "/tmp/partee.read.XXXXXX";
+    int fd = mkstemp(name);
+    if (fd == -1)
+      throw std::runtime_error{"mkstemp failed"};
+    close(fd);
+    _path = name;
+
+    std::ofstream file(_path);
+    file << content;
+  }
+
+  ~PartFile() { std::remove(_path.c_str()); }
+
+public:
+  const std::string &path(void) const { return _path; }
+
+private:
+  std::string _path;
+};
+
+} // namespace
+
+TEST(PartitionReadTest, opcode)
+{
+  PartFile part("[partition]\n"
+                "backends=cpu,acl_cl\n"
+                "default=cpu\n"
+                "comply=opcode\n"
+                "\n"
+                "[OPCODE]\n"
+                "DIV=acl_cl\n");
+
+  auto table = partee::read(part.path());
+
+  ASSERT_EQ(2, table.groups.size());
+  ASSERT_EQ("cpu", table.groups[0]);
+  ASSERT_EQ("acl_cl", table.groups[1]);
+  ASSERT_EQ("cpu", table.default_group);
+  ASSERT_EQ(luci::PartitionTable::COMPLY::OPCODE, table.comply);
+  ASSERT_EQ("acl_cl", table.byopcodes.at("DIV"));
+}
+
+TEST(PartitionReadTest, no_comply_not_required)
+{
+  PartFile part("[partition]\n"
+                "backends=cpu,acl_cl\n"
+                "default=cpu\n");
+
+  auto table = partee::read(part.path(), false);
+
+  ASSERT_EQ(2, table.groups.size());
+  ASSERT_EQ("cpu", table.default_group);
+}
+
+TEST(PartitionReadTest, no_comply_NEG)
+{
+  PartFile part("[partition]\n"
+                "backends=cpu,acl_cl\n"
+                "default=cpu\n");
+
+  EXPECT_THROW(partee::read(part.path()), std::invalid_argument);
+}
+
+TEST(PartitionReadTest, invalid_comply_NEG)
+{
+  PartFile part("[partition]\n"
+                "backends=cpu,acl_cl\n"
+                "default=cpu\n"
+                "comply=opkind\n");
+
+  EXPECT_THROW(partee::read(part.path(), false), std::runtime_error);
+}
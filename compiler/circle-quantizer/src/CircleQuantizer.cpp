@@ -175,6 +175,7 @@ int entry(int argc, char **argv)
   const std::string cq = "--copy_quantparam";
   const std::string fake_quant = "--fake_quantize";
   const std::string qw = "--quantize_weights";
+  const std::string group_size = "--group_size";
   const std::string cfg = "--config";
 
   const std::string tf_maxpool = "--TF-style_maxpool";
@@ -249,7 +250,13 @@ int entry(int argc, char **argv)
     .type(arser::DataType::STR_VEC)
     .help("Quantize weights values only"
           "Three arguments required: input_model_dtype(float32) "
-          "output_model_dtype(int8, int16) granularity(channel)");
+          "output_model_dtype(int4, int8, int16) granularity(channel, group). "
+          "'group' emits block quantized weights (GGML_Q4_0 for int4, GGML_Q8_0 for int8)");
+
+  arser.add_argument(group_size)
+    .type(arser::DataType::INT32)
+    .help("Number of elements in a group for group-wise weights quantization. Only 32 is "
+          "supported (default: 32)");
 
   arser.add_argument("--input_type")
     .help("Input type of quantized model (uint8, int16, int32, int64, float32, or bool). For "
@@ -478,6 +485,19 @@ int entry(int argc, char **argv)
     options->param(AlgorithmParameters::Quantize_input_model_dtype, values.at(0));
     options->param(AlgorithmParameters::Quantize_output_model_dtype, values.at(1));
     options->param(AlgorithmParameters::Quantize_granularity, values.at(2));
+
+    if (arser[group_size])
+    {
+      // Blocks of GGML_Q4_0 and GGML_Q8_0 have 32 elements
+      const auto value = arser.get<int32_t>(group_size);
+      if (value != 32)
+      {
+        std::cerr << "ERROR: Unsupported group_size " << value << ". Only 32 is supported"
+                  << std::endl;
+        return 255;
+      }
+      options->param(AlgorithmParameters::Quantize_group_size, std::to_string(value));
+    }
   }
 
   std::string input_path = arser.get<std::string>("input");
@@ -53,6 +53,11 @@ enum class DataType
   // Microscaling data type
   MXFP4,
   MXINT8,
+
+  // Block quantized data type (GGML)
+  // Each block has 32 quantized values with fp16 scale
+  GGML_Q4_0,
+  GGML_Q8_0,
 };
 
 } // namespace loco
@@ -121,6 +121,19 @@ template <> struct DataTypeImpl<DataType::BOOL>
   using Type = uint8_t;
 };
 
+// NOTE Block quantized types are handled as bytes of blocks
+template <> struct DataTypeImpl<DataType::GGML_Q4_0>
+{
+  // Use C++ uint8_t type for a byte of Q4_0 blocks
+  using Type = uint8_t;
+};
+
+template <> struct DataTypeImpl<DataType::GGML_Q8_0>
+{
+  // Use C++ uint8_t type for a byte of Q8_0 blocks
+  using Type = uint8_t;
+};
+
 template <> struct DataTypeImpl<DataType::STRING>
 {
   // Use C++ std::string type for STRING
@@ -163,6 +176,9 @@ inline uint32_t size(DataType data_type)
       return sizeof(DataTypeImpl<DataType::FLOAT64>::Type);
     case DataType::BOOL:
       return sizeof(DataTypeImpl<DataType::BOOL>::Type);
+    case DataType::GGML_Q4_0:
+    case DataType::GGML_Q8_0:
+      throw std::runtime_error("Block quantized type is not supported by loco::size");
     case DataType::STRING:
       // STRING is variable length. Cannot decide size by type
       throw std::runtime_error("Invalid size call with STRING type");
@@ -21,6 +21,7 @@
 // TODO Include "Node.h" instead
 #include "loco/IR/Nodes.h"
 #include "loco/IR/NodePool.h"
+#include "loco/IR/GraphObserver.h"
 #include "loco/IR/GraphInputIndex.h"
 #include "loco/IR/GraphOutputIndex.h"
 
@@ -212,7 +213,11 @@ public:
   Graph(const Graph &) = delete;
   Graph(Graph &&) = delete;
 
-  ~Graph() = default;
+  ~Graph()
+  {
+    // Nodes are destroyed without notification
+    _observer = nullptr;
+  }
 
 public:
   NodeContext *nodes(void) { return &_node_ctx; }
@@ -222,7 +227,17 @@ public:
   OutputContext *outputs(void) { return &_output_ctx; }
   const OutputContext *outputs(void) const { return &_output_ctx; }
 
+public:
+  /**
+   * @brief Observer to be notified of node edits, nullptr to detach
+   * @note  Graph does not own the observer
+   */
+  GraphObserver *observer(void) const { return _observer; }
+  void observer(GraphObserver *observer) { _observer = observer; }
+
 private:
+  // NOTE _observer is declared before _node_ctx to outlive nodes
+  GraphObserver *_observer = nullptr;
   NodeContext _node_ctx;
   InputContext _input_ctx;
   OutputContext _output_ctx;
@@ -276,6 +291,13 @@ std::vector<Node *> output_nodes(Graph *);
  */
 std::set<Node *> all_nodes(Graph *);
 
+/**
+ * @brief Notify the observer of the graph that node is changed except its arguments
+ *
+ * NOTE Call this after changing properties of a node (e.g., shape) that loco cannot see
+ */
+void notify_update(Node *node);
+
 std::unique_ptr<Graph> make_graph(void);
 
 } // namespace loco
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LOCO_IR_GRAPH_OBSERVER_H__
+#define __LOCO_IR_GRAPH_OBSERVER_H__
+
+#include "loco/IR/Node.forward.h"
+
+namespace loco
+{
+
+/**
+ * @brief Interface to be notified of node edits in a Graph
+ *
+ * @note  Creation, destruction and argument changes are notified by loco itself.
+ *        Changes of other properties (e.g., shape or attributes of a dialect) are notified
+ *        only when the code making the change calls loco::notify_update().
+ */
+struct GraphObserver
+{
+  virtual ~GraphObserver() = default;
+
+  /// @brief Called after a node is created
+  virtual void onCreate(Node *node) = 0;
+
+  /// @brief Called before a node is destroyed
+  virtual void onDestroy(Node *node) = 0;
+
+  /// @brief Called after an argument of 'user' is changed from 'prev' to 'curr' (may be nullptr)
+  virtual void onArgChange(Node *user, Node *prev, Node *curr) = 0;
+
+  /// @brief Called by loco::notify_update() for the changes not visible to loco
+  virtual void onUpdate(Node *node) = 0;
+};
+
+} // namespace loco
+
+#endif // __LOCO_IR_GRAPH_OBSERVER_H__
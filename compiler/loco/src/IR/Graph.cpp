@@ -56,6 +56,13 @@ GraphOutput *Graph::OutputContext::create(void)
   return take(std::make_unique<GraphOutput>(size()));
 }
 
+void notify_update(Node *node)
+{
+  auto g = node->graph();
+  if (g != nullptr && g->observer() != nullptr)
+    g->observer()->onUpdate(node);
+}
+
 std::set<loco::Node *> all_nodes(loco::Graph *g)
 {
   std::set<loco::Node *> res;
@@ -16,6 +16,8 @@
 
 #include "loco/IR/Graph.h"
 
+#include "MockupNode.h"
+
 #include <gtest/gtest.h>
 
 namespace
@@ -227,3 +229,64 @@ TEST(GraphTest, graph_name_nullptr_NEG)
 
   EXPECT_ANY_THROW(g->name(nullptr));
 }
+
+namespace
+{
+
+struct CountingObserver final : public loco::GraphObserver
+{
+  void onCreate(loco::Node *) final { ++created; }
+  void onDestroy(loco::Node *) final { ++destroyed; }
+  void onArgChange(loco::Node *, loco::Node *, loco::Node *) final { ++arg_changed; }
+  void onUpdate(loco::Node *) final { ++updated; }
+
+  uint32_t created = 0;
+  uint32_t destroyed = 0;
+  uint32_t arg_changed = 0;
+  uint32_t updated = 0;
+};
+
+} // namespace
+
+TEST(GraphTest, observer)
+{
+  auto g = loco::make_graph();
+
+  CountingObserver observer;
+  g->observer(&observer);
+  ASSERT_EQ(&observer, g->observer());
+
+  auto n1 = g->nodes()->create<MockupNode>();
+  auto n2 = g->nodes()->create<MockupNode>();
+  ASSERT_EQ(2, observer.created);
+
+  n2->in(n1);
+  n2->in(n1);
+  ASSERT_EQ(1, observer.arg_changed);
+
+  loco::notify_update(n1);
+  ASSERT_EQ(1, observer.updated);
+
+  // Dropping arguments of the node being destroyed is not notified
+  g->nodes()->destroy(n2);
+  ASSERT_EQ(1, observer.destroyed);
+  ASSERT_EQ(1, observer.arg_changed);
+
+  g->observer(nullptr);
+  g->nodes()->create<MockupNode>();
+  ASSERT_EQ(2, observer.created);
+}
+
+TEST(GraphTest, observer_destroy_other_graph_NEG)
+{
+  auto g1 = loco::make_graph();
+  auto g2 = loco::make_graph();
+
+  CountingObserver observer;
+  g1->observer(&observer);
+
+  auto node = g2->nodes()->create<MockupNode>();
+
+  EXPECT_ANY_THROW(g1->nodes()->destroy(node));
+  ASSERT_EQ(0, observer.destroyed);
+}
@@ -15,6 +15,9 @@
  */
 
 #include "loco/IR/NodePool.h"
+#include "loco/IR/Graph.h"
+
+#include <stdexcept>
 
 namespace loco
 {
@@ -28,4 +31,30 @@ NodePool::~NodePool()
   }
 }
 
+void NodePool::created(Node *node)
+{
+  if (_graph != nullptr && _graph->observer() != nullptr)
+    _graph->observer()->onCreate(node);
+}
+
+void NodePool::destroy(Node *node)
+{
+  if (node->graph() != _graph)
+  {
+    throw std::invalid_argument{"node"};
+  }
+
+  if (_graph != nullptr && _graph->observer() != nullptr)
+    _graph->observer()->onDestroy(node);
+
+  // Detach node from the graph not to notify argument changes while destroying it
+  node->graph(nullptr);
+
+  if (!ObjectPool<Node>::erase(node))
+  {
+    node->graph(_graph);
+    throw std::invalid_argument{"node"};
+  }
+}
+
 } // namespace loco
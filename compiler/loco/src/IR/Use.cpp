@@ -16,6 +16,7 @@
 
 #include "loco/IR/Use.h"
 #include "loco/IR/Node.h"
+#include "loco/IR/Graph.h"
 
 #include <cassert>
 
@@ -24,6 +25,8 @@ namespace loco
 
 void Use::node(Node *node)
 {
+  Node *prev = _node;
+
   if (_node != nullptr)
   {
     assert(_node->_uses.find(this) != _node->_uses.end());
@@ -40,6 +43,12 @@ void Use::node(Node *node)
   }
 
   assert(_node == node);
+
+  if (prev != node && _user != nullptr && _user->graph() != nullptr)
+  {
+    if (auto observer = _user->graph()->observer())
+      observer->onArgChange(_user, prev, node);
+  }
 }
 
 } // namespace loco
@@ -22,6 +22,8 @@
 #include <loco.h>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace luci
 {
@@ -44,6 +46,11 @@ public:
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls store_blocks instead of store when the model is serialized in several
+    // blocks (e.g. with extended buffers), which should be stored in order.
+    // Default implementation concatenates blocks and calls store.
+    virtual bool store_blocks(const std::vector<std::pair<const char *, size_t>> &blocks) const;
   };
 
 public:
@@ -25,6 +25,8 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace luci
 {
@@ -48,12 +50,19 @@ public:
     if (!ptr)
       INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
 
-    std::ofstream fs(_filepath, std::ofstream::binary);
-    fs.write(ptr, size);
-
-    return fs.good();
+    return store_blocks({{ptr, size}});
   }
 
+  /**
+   * @brief Write blocks one by one without concatenating them
+   *
+   * @note  Blocks are written to a temporary file in the same directory, which then replaces the
+   *        target file, as constants of the module may refer the mapped input file, which can be
+   *        the same as the output file. A symbolic link is kept by replacing the file it points
+   *        to, and the permissions (and ownership if allowed) of the existing file are kept.
+   */
+  bool store_blocks(const std::vector<std::pair<const char *, size_t>> &blocks) const final;
+
 private:
   luci::Module *_module;
   const std::string _filepath;
@@ -20,12 +20,28 @@
 
 #include <oops/InternalExn.h>
 
+#include <cassert>
 #include <fstream>
 #include <memory>
 
 namespace luci
 {
 
+bool CircleExporter::Contract::store_blocks(
+  const std::vector<std::pair<const char *, size_t>> &blocks) const
+{
+  size_t total_size = 0;
+  for (const auto &block : blocks)
+    total_size += block.second;
+
+  std::vector<char> data;
+  data.reserve(total_size);
+  for (const auto &block : blocks)
+    data.insert(data.end(), block.first, block.first + block.second);
+
+  return store(data.data(), data.size());
+}
+
 CircleExporter::CircleExporter()
 {
   // NOTHING TO DO
@@ -38,11 +54,14 @@ bool CircleExporter::invoke(Contract *contract) const
   {
     CircleExporterImpl impl(module);
 
-    const char *ptr = impl.getBufferPointer();
-    const size_t size = impl.getBufferSize();
+    const auto &blocks = impl.blocks();
+    assert(blocks.size() > 0);
 
     // we just send one time
-    return contract->store(ptr, size);
+    if (blocks.size() == 1)
+      return contract->store(blocks.at(0).first, blocks.at(0).second);
+
+    return contract->store_blocks(blocks);
   }
 
   // NOTE some unit tests calls with nullptr module, cannot add assert here
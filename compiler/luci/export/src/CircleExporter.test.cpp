@@ -138,3 +138,19 @@ TEST(CircleExport, export_execution_plan_nosetting_NEG)
   ASSERT_NE(model.get(), nullptr);
   ASSERT_EQ(model->metadata.size(), 0);
 }
+
+TEST(CircleExport, store_blocks)
+{
+  SampleGraphContract contract;
+
+  std::string first = "circle";
+  std::string second = "model";
+  std::vector<std::pair<const char *, size_t>> blocks;
+  blocks.emplace_back(first.data(), first.size());
+  blocks.emplace_back(second.data(), second.size());
+
+  ASSERT_TRUE(contract.store_blocks(blocks));
+
+  const auto &buffer = contract.get_buffer();
+  EXPECT_EQ("circlemodel", std::string(buffer.begin(), buffer.end()));
+}
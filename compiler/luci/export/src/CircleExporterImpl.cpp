@@ -125,6 +125,25 @@ void optimize(loco::Graph *g)
   phase_runner.run(phase);
 }
 
+// Return true if constants of the module cannot be held in the flatbuffers area
+bool require_ext_buffer(luci::Module *module)
+{
+  uint64_t total_size = 0;
+  for (size_t g = 0; g < module->size(); ++g)
+  {
+    for (auto node : loco::all_nodes(module->graph(g)))
+    {
+      auto const_node = dynamic_cast<luci::CircleConst *>(node);
+      if (const_node == nullptr || const_node->dtype() == loco::DataType::STRING)
+        continue;
+
+      total_size += const_node->raw_size();
+    }
+  }
+
+  return total_size > FLATBUFFERS_SIZE_MAX;
+}
+
 } // namespace
 
 namespace luci
@@ -150,7 +169,10 @@ CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
 void CircleExporterImpl::exportModule(Module *module)
 {
   assert(module->size() > 0);
+
   // do graph optimization
+  for (size_t g = 0; g < module->size(); ++g)
+    optimize(module->graph(g));
 
   SerializedModelData md;
 
@@ -161,7 +183,11 @@ void CircleExporterImpl::exportModule(Module *module)
 
   // if source is extended buffer mode, force export to use extended buffer
   md._ext_buffer = module->ext_buffer();
+  // use extended buffer from the beginning, not to export twice, if constants are too large
+  if (!md._ext_buffer)
+    md._ext_buffer = require_ext_buffer(module);
 
+  // NOTE export may still fail with the size limit as other data are not counted above
   if (!exportModuleData(module, md) && md._require_ext_buffer)
   {
     assert(md._ext_buffer == false);
@@ -191,8 +217,6 @@ bool CircleExporterImpl::exportModuleData(Module *module, SerializedModelData &m
   {
     auto graph = module->graph(g);
 
-    optimize(graph);
-
     SerializedGraphData gd;
 
     // set Subgraph name
@@ -249,77 +273,46 @@ bool CircleExporterImpl::exportModuleData(Module *module, SerializedModelData &m
 
 void CircleExporterImpl::finalizeWithExtendedBuffer(SerializedModelData &md)
 {
-  _ext_buffer = md._ext_buffer;
-  if (!_ext_buffer)
-    return;
-
-  _fb_data_with_ext.clear();
-
-  auto align16 = [](size_t &v) {
-    while (v % 16 != 0)
-      v++;
-  };
+  _blocks.clear();
+  _blocks.emplace_back(reinterpret_cast<const char *>(_builder.GetBufferPointer()),
+                       _builder.GetSize());
 
-  // get total memory for flatbuffer + all buffer_data
-  size_t result_size = _builder.GetSize();
-  align16(result_size);
-  for (auto &it : md._buffer_data_map)
-  {
-    SerializedModelData::BufferData &buffer_data = it.second;
-    result_size += buffer_data.size();
-    align16(result_size);
-  }
-  align16(result_size);
-  result_size += 16; // for safety
+  if (!md._ext_buffer)
+    return;
 
-  std::string result;
-  const char *buff_ptr = reinterpret_cast<const char *>(_builder.GetBufferPointer());
+  // NOTE buffer data are not copied here but stored after flatbuffers area
+  //      by the contract, in the order of blocks
+  static const char zeros[16] = {0};
+  uint64_t offset = _builder.GetSize();
 
-  auto padalign16 = [](std::string &str) {
-    while (str.size() % 16 != 0)
-      str += '\0';
+  // pad to be 16 bytes aligned
+  auto padalign16 = [this, &offset]() {
+    const size_t padding = (16 - offset % 16) % 16;
+    if (padding > 0)
+    {
+      _blocks.emplace_back(zeros, padding);
+      offset += padding;
+    }
   };
 
-  result.reserve(result_size);
-  result.append(buff_ptr, _builder.GetSize());
-
-  auto mutable_model = circle::GetMutableModel(result.data());
+  auto mutable_model = circle::GetMutableModel(_builder.GetBufferPointer());
   auto mutable_buffers = mutable_model->mutable_buffers();
 
-  // pad to be 16 bytes aligned
-  padalign16(result);
+  padalign16();
   for (auto &it : md._buffer_data_map)
   {
     int32_t buffer_index = it.first;
-    SerializedModelData::BufferData &buffer_data = it.second;
-    uint64_t offset = result.size();
-    uint64_t size = buffer_data.size();
+    const SerializedModelData::BufferData &buffer_data = it.second;
+    uint64_t size = buffer_data.size;
 
     circle::Buffer *mutable_buffer = mutable_buffers->GetMutableObject(buffer_index);
     mutable_buffer->mutate_offset(offset);
     mutable_buffer->mutate_size(size);
 
-    result.append(buffer_data.begin(), buffer_data.end());
-    padalign16(result);
+    _blocks.emplace_back(reinterpret_cast<const char *>(buffer_data.data), size);
+    offset += size;
+    padalign16();
   }
-  padalign16(result);
-
-  // use final result
-  _fb_data_with_ext = result;
-}
-
-const char *CircleExporterImpl::getBufferPointer() const
-{
-  if (_ext_buffer)
-    return reinterpret_cast<const char *>(_fb_data_with_ext.data());
-  return reinterpret_cast<const char *>(_builder.GetBufferPointer());
-}
-
-size_t CircleExporterImpl::getBufferSize() const
-{
-  if (_ext_buffer)
-    return _fb_data_with_ext.size();
-  return _builder.GetSize();
 }
 
 } // namespace luci
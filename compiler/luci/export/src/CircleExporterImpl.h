@@ -26,6 +26,9 @@
 
 #include <loco.h>
 
+#include <utility>
+#include <vector>
+
 namespace luci
 {
 
@@ -40,15 +43,13 @@ public:
 
   explicit CircleExporterImpl(Module *module);
 
-  /**
-   * @return pointer to buffer with serialized graph
-   */
-  const char *getBufferPointer() const;
+  using Block = std::pair<const char *, size_t>;
 
   /**
-   * @return size of buffer with serialized graph
+   * @return blocks of serialized model, to be stored in order
+   * @note   flatbuffers area is the first block. Extended buffers follow it if any.
    */
-  size_t getBufferSize() const;
+  const std::vector<Block> &blocks() const { return _blocks; }
 
 private:
   /**
@@ -70,14 +71,13 @@ private:
   bool exportModuleData(Module *module, SerializedModelData &md);
 
   /**
-   * @brief finalizes file stream with extended buffer from internal buffer
+   * @brief finalizes blocks with extended buffer after internal buffer
    */
   void finalizeWithExtendedBuffer(SerializedModelData &md);
 
 private:
   flatbuffers::FlatBufferBuilder _builder;
-  bool _ext_buffer = false;
-  std::string _fb_data_with_ext;
+  std::vector<Block> _blocks;
 };
 
 } // namespace luci
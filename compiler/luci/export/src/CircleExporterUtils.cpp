@@ -81,6 +81,10 @@ circle::TensorType to_circle_tensortype(loco::DataType type)
       return circle::TensorType_MXFP4;
     case loco::DataType::MXINT8:
       return circle::TensorType_MXINT8;
+    case loco::DataType::GGML_Q4_0:
+      return circle::TensorType_GGML_Q4_0;
+    case loco::DataType::GGML_Q8_0:
+      return circle::TensorType_GGML_Q8_0;
 
     default:
       INTERNAL_EXN_V("failed to convert unsupported loco::DataType", oops::to_uint32(type));
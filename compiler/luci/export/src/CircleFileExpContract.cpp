@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleFileExpContract.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <climits>
+#include <cstdlib>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Return the path of the file to replace, following symbolic links
+std::string resolve_target(const std::string &path)
+{
+  std::unique_ptr<char, decltype(&std::free)> resolved{realpath(path.c_str(), nullptr), &std::free};
+  if (resolved)
+    return resolved.get();
+
+  // Target does not exist yet
+  return path;
+}
+
+bool write_all(int fd, const char *data, size_t size)
+{
+  while (size > 0)
+  {
+    auto written = ::write(fd, data, size);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+// Give the temporary file the permissions the target file would have after being overwritten
+bool copy_mode(int fd, const std::string &target)
+{
+  struct stat st;
+  if (stat(target.c_str(), &st) == 0)
+  {
+    if (fchmod(fd, st.st_mode & 07777) != 0)
+      return false;
+    // NOTE Changing the owner is allowed only for privileged users. Ignore the failure, as
+    //      overwriting the file would not keep the owner either.
+    if (fchown(fd, st.st_uid, st.st_gid) != 0)
+    {
+      // DO NOTHING
+    }
+    return true;
+  }
+
+  // New file gets the default permissions as std::ofstream creates, while mkstemp uses 0600
+  // NOTE umask() can only be read by setting it
+  const auto mask = umask(0);
+  umask(mask);
+  return fchmod(fd, 0666 & ~mask) == 0;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool CircleFileExpContract::store_blocks(
+  const std::vector<std::pair<const char *, size_t>> &blocks) const
+{
+  const auto target = resolve_target(_filepath);
+
+  // Unique name for concurrent exports to the same path
+  std::string temppath = target + ".XXXXXX";
+  int fd = mkstemp(&temppath[0]);
+  if (fd < 0)
+    return false;
+
+  bool ok = copy_mode(fd, target);
+  for (const auto &block : blocks)
+  {
+    if (not ok)
+      break;
+    ok = write_all(fd, block.first, block.second);
+  }
+
+  if (close(fd) != 0)
+    ok = false;
+
+  if (ok and std::rename(temppath.c_str(), target.c_str()) == 0)
+    return true;
+
+  unlink(temppath.c_str());
+  return false;
+}
+
+} // namespace luci
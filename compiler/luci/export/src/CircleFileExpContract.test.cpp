@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleFileExpContract.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+class CircleFileExpContractTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char tmpl[] = "/tmp/luci_export_test.XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(tmpl));
+    _dir = tmpl;
+  }
+
+  void TearDown() override
+  {
+    for (auto name : {"model.circle", "link.circle"})
+      unlink((_dir + "/" + name).c_str());
+    rmdir(_dir.c_str());
+  }
+
+  std::string path(const char *name) const { return _dir + "/" + name; }
+
+  uint32_t count_files(void) const
+  {
+    uint32_t count = 0;
+    auto dir = opendir(_dir.c_str());
+    while (auto entry = readdir(dir))
+    {
+      if (entry->d_name[0] != '.')
+        count++;
+    }
+    closedir(dir);
+    return count;
+  }
+
+  static std::string read(const std::string &path)
+  {
+    std::ifstream fs(path, std::ifstream::binary);
+    return std::string(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+  }
+
+private:
+  std::string _dir;
+};
+
+} // namespace
+
+TEST_F(CircleFileExpContractTest, store_blocks)
+{
+  luci::CircleFileExpContract contract(nullptr, path("model.circle"));
+
+  ASSERT_TRUE(contract.store_blocks({{"abc", 3}, {"de", 2}}));
+  EXPECT_EQ("abcde", read(path("model.circle")));
+
+  // Temporary file is not left
+  EXPECT_EQ(1, count_files());
+}
+
+TEST_F(CircleFileExpContractTest, keep_mode_and_symlink)
+{
+  {
+    std::ofstream fs(path("model.circle"));
+    fs << "old";
+  }
+  ASSERT_EQ(0, chmod(path("model.circle").c_str(), 0640));
+  ASSERT_EQ(0, symlink(path("model.circle").c_str(), path("link.circle").c_str()));
+
+  luci::CircleFileExpContract contract(nullptr, path("link.circle"));
+  ASSERT_TRUE(contract.store_blocks({{"new", 3}}));
+
+  struct stat st;
+  ASSERT_EQ(0, lstat(path("link.circle").c_str(), &st));
+  EXPECT_TRUE(S_ISLNK(st.st_mode));
+
+  ASSERT_EQ(0, stat(path("model.circle").c_str(), &st));
+  EXPECT_EQ(0640, st.st_mode & 07777);
+  EXPECT_EQ("new", read(path("model.circle")));
+}
+
+TEST_F(CircleFileExpContractTest, no_directory_NEG)
+{
+  luci::CircleFileExpContract contract(nullptr, path("none/model.circle"));
+
+  EXPECT_FALSE(contract.store_blocks({{"abc", 3}}));
+}
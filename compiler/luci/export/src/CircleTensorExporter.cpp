@@ -357,24 +357,17 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
-  const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
+  // NOTE use raw data of the constant as it is, without making a copy
+  const luci::CircleConst *cc = c;
+  const uint32_t size = cc->size<DT>();
   const size_t raw_size = size * sizeof(NativeType);
+  const uint8_t *raw_data = cc->raw_data();
 
   if (md._ext_buffer)
   {
-    // TODO optimize this if this operation takes long or much memory
-    SerializedModelData::BufferData buffer_data;
-    buffer_data.resize(raw_size);
-    std::memcpy(buffer_data.data(), raw_data.data(), raw_size);
-
+    // NOTE raw data should not be changed until the export is finished
     int32_t buffer_index = md._buffers.size();
-    md._buffer_data_map.emplace(buffer_index, buffer_data);
+    md._buffer_data_map.emplace(buffer_index, SerializedModelData::BufferData{raw_data, raw_size});
 
     // create fake indicator buffer
     return circle::CreateBuffer(builder, 0 /* data */, 1 /* offset */, 1 /* size */);
@@ -385,7 +378,7 @@ encodeOpBufferByDType(FlatBufferBuilder &builder, SerializedModelData &md, luci:
     return md._empty_buffer;
   }
 
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
   return CreateBuffer(builder, array_offset);
 }
 
@@ -489,6 +482,10 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder,
       return encodeOpBufferByDType<loco::DataType::BOOL>(builder, md, c);
     case loco::DataType::STRING:
       return encodeOpBufferByDType<loco::DataType::STRING>(builder, md, c);
+    case loco::DataType::GGML_Q4_0:
+      return encodeOpBufferByDType<loco::DataType::GGML_Q4_0>(builder, md, c);
+    case loco::DataType::GGML_Q8_0:
+      return encodeOpBufferByDType<loco::DataType::GGML_Q8_0>(builder, md, c);
     default:
       break;
   }
@@ -571,7 +568,9 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci::CircleConst *rhs)
+// NOTE const access not to make copies of constants referring external data
+template <loco::DataType DT>
+bool has_same_elements(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   assert(lhs->dtype() == DT);
   assert(rhs->dtype() == DT);
@@ -583,7 +582,7 @@ template <loco::DataType DT> bool has_same_elements(luci::CircleConst *lhs, luci
   return true;
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -624,6 +623,12 @@ bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
     case loco::DataType::BOOL:
       return has_same_elements<loco::DataType::BOOL>(lhs, rhs);
 
+    case loco::DataType::GGML_Q4_0:
+      return has_same_elements<loco::DataType::GGML_Q4_0>(lhs, rhs);
+
+    case loco::DataType::GGML_Q8_0:
+      return has_same_elements<loco::DataType::GGML_Q8_0>(lhs, rhs);
+
     default:
       break;
   }
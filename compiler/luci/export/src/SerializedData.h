@@ -134,7 +134,12 @@ struct SerializedModelData final
   // flag to indicate flatbuffer area got size > 2G
   bool _require_ext_buffer = false;
 
-  using BufferData = std::vector<uint8_t>;
+  // Buffer data refers the payload of CircleConst without copy
+  struct BufferData
+  {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
   using MapBufferData = std::map<int32_t, BufferData>;
   // temporary store for BufferData to put after flatbuffers area
   MapBufferData _buffer_data_map;
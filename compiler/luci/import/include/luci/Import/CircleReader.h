@@ -126,11 +126,17 @@ public:
   const uint8_t *file_data(uint64_t offset) const;
   size_t file_size(void) const { return _file_size; }
 
+public:
+  // to refer file data without copy while the file is alive (nullptr if not available)
+  const std::shared_ptr<const uint8_t> &file_owner(void) const { return _file_owner; }
+  void file_owner(const std::shared_ptr<const uint8_t> &owner) { _file_owner = owner; }
+
 private:
   const circle::Model *_model{nullptr};
   const circle::SubGraph *_current_subgraph{nullptr};
   const uint8_t *_file_data{nullptr};
   size_t _file_size{0};
+  std::shared_ptr<const uint8_t> _file_owner;
 };
 
 } // namespace luci
@@ -47,10 +47,14 @@ private:
 public:
   std::unique_ptr<Module> importModule(const uint8_t *data, size_t size);
 
+  // Constants of the Module may refer 'data' without copy, sharing its ownership
+  std::unique_ptr<Module> importModule(const std::shared_ptr<const uint8_t> &data, size_t size);
+
 private:
   const GraphBuilderSource *_source = nullptr;
   const uint8_t *_file_data = nullptr;
   size_t _file_size = 0;
+  std::shared_ptr<const uint8_t> _file_owner;
 };
 
 } // namespace luci
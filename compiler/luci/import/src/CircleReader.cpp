@@ -74,6 +74,10 @@ loco::DataType luci_datatype(const circle::TensorType type)
       return loco::DataType::MXFP4;
     case circle::TensorType_MXINT8:
       return loco::DataType::MXINT8;
+    case circle::TensorType_GGML_Q4_0:
+      return loco::DataType::GGML_Q4_0;
+    case circle::TensorType_GGML_Q8_0:
+      return loco::DataType::GGML_Q8_0;
     default:
       break;
   }
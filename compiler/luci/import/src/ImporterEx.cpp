@@ -17,12 +17,15 @@
 #include "luci/Importer.h"
 #include "luci/ImporterEx.h"
 
-#include <foder/FileLoader.h>
-
 #include <memory>
 #include <iostream>
 #include <stdexcept>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace luci
 {
 
@@ -32,6 +35,37 @@ namespace
 // limitation of current flatbuffers file size
 inline constexpr uint64_t FLATBUFFERS_SIZE_MAX = 2147483648UL; // 2GB
 
+/**
+ * @brief Map file as read-only so that constants can refer their data without copy
+ * @note  Mapping is released when the returned pointer and all its copies are destroyed.
+ *        File should not be truncated or overwritten in-place while it is mapped.
+ */
+std::shared_ptr<const uint8_t> map_file(const std::string &path, size_t &size)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open file: " + path);
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0)
+  {
+    close(fd);
+    throw std::runtime_error("Failed to read file: " + path);
+  }
+
+  size = static_cast<size_t>(st.st_size);
+  void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // NOTE mapping is kept after closing the file descriptor
+  close(fd);
+  if (addr == MAP_FAILED)
+    throw std::runtime_error("Failed to map file: " + path);
+
+  const auto mapped_size = size;
+  return std::shared_ptr<const uint8_t>(
+    static_cast<const uint8_t *>(addr),
+    [mapped_size](const uint8_t *ptr) { munmap(const_cast<uint8_t *>(ptr), mapped_size); });
+}
+
 } // namespace
 
 ImporterEx::ImporterEx()
@@ -52,12 +86,12 @@ ImporterEx::ImporterEx(const GraphBuilderSource *source) : ImporterEx{} { _sourc
 
 std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_path) const
 {
-  foder::FileLoader file_loader{input_path};
-  std::vector<char> model_data;
+  std::shared_ptr<const uint8_t> model_data;
+  size_t data_size = 0;
 
   try
   {
-    model_data = file_loader.load();
+    model_data = map_file(input_path, data_size);
   }
   catch (const std::runtime_error &err)
   {
@@ -65,8 +99,7 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
     return nullptr;
   }
 
-  auto data_data = reinterpret_cast<uint8_t *>(model_data.data());
-  auto data_size = model_data.size();
+  auto data_data = model_data.get();
 
   if (data_size < FLATBUFFERS_SIZE_MAX)
   {
@@ -78,8 +111,9 @@ std::unique_ptr<Module> ImporterEx::importVerifyModule(const std::string &input_
     }
   }
 
+  // NOTE constants of the module refer model_data, which keeps the file mapped
   Importer importer(_source);
-  return importer.importModule(data_data, data_size);
+  return importer.importModule(model_data, data_size);
 }
 
 std::unique_ptr<Module> ImporterEx::importModule(const std::vector<char> &model_data) const
@@ -25,13 +25,12 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <vector>
 
-#include <string.h>
-
 namespace
 {
 
@@ -51,7 +50,7 @@ std::ostream &operator<<(std::ostream &os, const luci::VectorWrapper<int32_t> &v
 using namespace luci;
 
 template <loco::DataType DT>
-void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
+void copy_data(const uint8_t *raw_data, size_t raw_size, uint32_t num_elements,
                CircleConst *const_node)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
@@ -59,11 +58,11 @@ void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   // TODO calculate the exact buffer size of sparse tensor
   if (const_node->sparsityparam())
   {
-    num_elements = raw_data.size() / sizeof(T);
+    num_elements = raw_size / sizeof(T);
   }
 
-  assert(raw_data.size() == num_elements * sizeof(T));
-  const auto *data = reinterpret_cast<const T *>(raw_data.data());
+  assert(raw_size == num_elements * sizeof(T));
+  const auto *data = reinterpret_cast<const T *>(raw_data);
 
   const_node->size<DT>(num_elements);
   for (uint32_t i = 0; i < num_elements; ++i)
@@ -73,13 +72,13 @@ void copy_data(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
 }
 
 template <>
-void copy_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
+void copy_data<loco::DataType::STRING>(const uint8_t *raw_data, size_t raw_size,
                                        uint32_t num_elements, CircleConst *const_node)
 {
   assert(const_node->sparsityparam() == nullptr);
 
-  const auto *data = reinterpret_cast<const char *>(raw_data.data());
-  const auto *i32d = reinterpret_cast<const int32_t *>(raw_data.data());
+  const auto *data = reinterpret_cast<const char *>(raw_data);
+  const auto *i32d = reinterpret_cast<const int32_t *>(raw_data);
 
   // de-serialize string data
   //   int32_t count
@@ -107,7 +106,7 @@ void copy_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
     {
       throw std::runtime_error("String offsets are not monotonic");
     }
-    if (offsets[i] > static_cast<int32_t>(raw_data.size()))
+    if (static_cast<size_t>(offsets[i]) > raw_size)
     {
       throw std::runtime_error("String offset is out of bounds");
     }
@@ -128,7 +127,7 @@ void copy_data<loco::DataType::STRING>(const VectorWrapper<uint8_t> &raw_data,
 //      this method will unpack two 4bit elements, packed in 8bit,
 //      to two 8bit elements, having values -8~7, for S4 and 0~15 for U4.
 template <loco::DataType DT>
-void copy_data_4(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
+void copy_data_4(const uint8_t *raw_data, size_t raw_size, uint32_t num_elements,
                  CircleConst *const_node)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
@@ -138,12 +137,13 @@ void copy_data_4(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   if (const_node->sparsityparam())
     return;
 
-  uint32_t raw_size = (num_elements + 1) / 2;
-  assert(raw_data.size() == raw_size);
+  uint32_t packed_size = (num_elements + 1) / 2;
+  assert(raw_size == packed_size);
+  (void)raw_size;
 
-  const uint8_t *data = raw_data.data();
+  const uint8_t *data = raw_data;
   const_node->size<DT>(num_elements);
-  for (uint32_t i = 0; i < raw_size; ++i)
+  for (uint32_t i = 0; i < packed_size; ++i)
   {
     uint32_t idx = i * 2;
     // for S4, 1bit for sign, 3bit for value
@@ -155,6 +155,45 @@ void copy_data_4(const VectorWrapper<uint8_t> &raw_data, uint32_t num_elements,
   }
 }
 
+// NOTE read_data refers raw data in the file without copy if the reader keeps the file alive.
+//      Otherwise, or if the data is not aligned for DT, raw data is copied.
+template <loco::DataType DT>
+void read_data(const CircleReader *reader, const uint8_t *raw_data, size_t raw_size,
+               uint32_t num_elements, CircleConst *const_node)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+
+  const auto &owner = reader->file_owner();
+  const bool aligned = reinterpret_cast<uintptr_t>(raw_data) % alignof(T) == 0;
+  const bool sparse = const_node->sparsityparam() != nullptr;
+  if (owner != nullptr && aligned && (sparse || raw_size == num_elements * sizeof(T)))
+  {
+    const_node->bind(owner, raw_data, raw_size - raw_size % sizeof(T));
+    return;
+  }
+
+  copy_data<DT>(raw_data, raw_size, num_elements, const_node);
+}
+
+// NOTE read_block_data reads block quantized data as bytes of blocks.
+//      Each block has fp16 scale and 32 values, packed in 4bit for Q4_0 and 8bit for Q8_0.
+template <loco::DataType DT>
+void read_block_data(const CircleReader *reader, const uint8_t *raw_data, size_t raw_size,
+                     uint32_t num_elements, CircleConst *const_node)
+{
+  static_assert(DT == loco::DataType::GGML_Q4_0 || DT == loco::DataType::GGML_Q8_0,
+                "Block quantized type is required");
+  constexpr uint32_t block_elements = 32;
+  constexpr uint32_t block_bytes =
+    sizeof(uint16_t) + (DT == loco::DataType::GGML_Q4_0 ? block_elements / 2 : block_elements);
+
+  if (num_elements % block_elements != 0 ||
+      raw_size != num_elements / block_elements * block_bytes)
+    throw std::runtime_error("CircleConst: Invalid size of block quantized data");
+
+  read_data<DT>(reader, raw_data, raw_size, raw_size, const_node);
+}
+
 } // namespace
 
 namespace luci
@@ -186,10 +225,9 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     // NOTE this shouldn't happen
     throw std::runtime_error("CircleConst: Circle file with invalid extended Buffer.");
   }
-  // temporary buffer to provide raw data from file
-  // must have life time same or longer than 'buffer' variable
-  std::vector<uint8_t> temp_buffer;
-  luci::VectorWrapper<uint8_t> buffer(nullptr);
+  // raw data of the buffer, in flatbuffers area or in extended area of the file
+  const uint8_t *raw_data = nullptr;
+  size_t raw_size = 0;
   if (r_buffer->offset() > 1)
   {
     if (r_buffer->size() >= std::numeric_limits<uint32_t>::max())
@@ -197,11 +235,6 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       // NOTE uint32_t limit is to match "uoffset_t flatbuffers::Vector::size()"
       throw std::runtime_error("CircleConst: Circle file with invalid extended Buffer.");
     }
-    uint32_t r_size = static_cast<uint32_t>(r_buffer->size());
-    // match binary level to flatbuffers::Vector
-    temp_buffer.resize(r_size + sizeof(uint32_t));
-
-    uint8_t *t_data = temp_buffer.data();
     const uint8_t *f_data = reader->file_data(r_buffer->offset());
     if (f_data == nullptr)
     {
@@ -209,28 +242,25 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, &r_size, sizeof(r_size));
-    t_data = t_data + sizeof(r_size);
     if (r_buffer->offset() + r_buffer->size() > reader->file_size())
     {
       // NOTE this shouldn't happen
       assert(false);
       return nullptr;
     }
-    memcpy(t_data, f_data, r_buffer->size());
-
-    using fbv_t = flatbuffers::Vector<uint8_t>;
-    const fbv_t *v_data = reinterpret_cast<const fbv_t *>(temp_buffer.data());
-    buffer = wrap(v_data);
+    raw_data = f_data;
+    raw_size = r_buffer->size();
 
     context->ext_buffer(true);
   }
   else
   {
-    buffer = wrap(r_buffer->data());
+    const auto buffer = wrap(r_buffer->data());
+    raw_data = buffer.data();
+    raw_size = buffer.size();
   }
   const auto const_dims = wrap(const_tensor->shape()); // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && raw_size == 0)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -250,7 +280,7 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (raw_size == 0 && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -266,47 +296,57 @@ CircleNode *CircleConstNodeBuilder::build(TensorIndex tensor_index,
     switch (luci_datatype(const_tensor->type()))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        read_data<loco::DataType::FLOAT32>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::FLOAT16:
-        copy_data<loco::DataType::FLOAT16>(buffer, num_elements, const_node);
+        read_data<loco::DataType::FLOAT16>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::U4:
-        copy_data_4<loco::DataType::U4>(buffer, num_elements, const_node);
+        copy_data_4<loco::DataType::U4>(raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        read_data<loco::DataType::U8>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::S4:
-        copy_data_4<loco::DataType::S4>(buffer, num_elements, const_node);
+        copy_data_4<loco::DataType::S4>(raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        read_data<loco::DataType::S8>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        read_data<loco::DataType::S16>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        read_data<loco::DataType::S32>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        read_data<loco::DataType::S64>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        read_data<loco::DataType::BOOL>(reader, raw_data, raw_size, num_elements, const_node);
         break;
 
       case loco::DataType::STRING:
-        copy_data<loco::DataType::STRING>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::STRING>(raw_data, raw_size, num_elements, const_node);
+        break;
+
+      case loco::DataType::GGML_Q4_0:
+        read_block_data<loco::DataType::GGML_Q4_0>(reader, raw_data, raw_size, num_elements,
+                                                   const_node);
+        break;
+
+      case loco::DataType::GGML_Q8_0:
+        read_block_data<loco::DataType::GGML_Q8_0>(reader, raw_data, raw_size, num_elements,
+                                                   const_node);
         break;
 
       default:
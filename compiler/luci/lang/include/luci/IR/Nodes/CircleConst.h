@@ -24,12 +24,20 @@
 
 #include <loco/IR/DataTypeTraits.h>
 
+#include <atomic>
+#include <memory>
+
 namespace luci
 {
 
 /**
  * @brief Class to build tensor data
  * @note  This will not be exported as a specific op
+ * @note  For block quantized types (GGML_Q4_0, GGML_Q8_0), size and index are in bytes of
+ *        blocks, not in elements
+ * @note  at() and scalar() may be called from multiple threads, including the first non-const
+ *        call which copies the bound payload. Other mutations (e.g., bind, size(uint32_t)) are
+ *        not thread-safe.
  */
 class CircleConst final : public FixedArityNode<0, CircleNodeImpl<CircleOpcode::CIRCLECONST>>
 {
@@ -42,8 +50,36 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Use 'size' bytes at 'data' as payload without copying it
+   * @note  'owner' should keep 'data' alive. Payload is copied to the node when it is
+   *        accessed first through non-const methods (copy-on-write).
+   *        STRING type is not supported.
+   */
+  void bind(const std::shared_ptr<const void> &owner, const uint8_t *data, size_t size);
+
+  // Return true if payload is not owned by the node
+  bool external(void) const { return _ext_data.load(std::memory_order_acquire) != nullptr; }
+
+  // Raw payload and its size in bytes (not for STRING)
+  const uint8_t *raw_data(void) const
+  {
+    auto ext_data = _ext_data.load(std::memory_order_acquire);
+    return ext_data != nullptr ? ext_data : _data.data();
+  }
+  size_t raw_size(void) const { return external() ? _ext_size : _data.size(); }
+
+private:
+  void materialize(void);
+
 private:
   std::vector<uint8_t> _data;
+  // payload outside of the node, kept alive by _ext_owner
+  // NOTE _ext_owner is kept after the payload is copied, as other threads may still read it
+  std::shared_ptr<const void> _ext_owner;
+  std::atomic<const uint8_t *> _ext_data{nullptr};
+  size_t _ext_size = 0;
   // TODO use _data for STRING and remove _strings
   std::vector<std::string> _strings; // for STRING type
 };
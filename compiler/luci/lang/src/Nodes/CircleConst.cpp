@@ -17,20 +17,53 @@
 #include "luci/IR/Nodes/CircleConst.h"
 
 #include <cassert>
+#include <mutex>
 
 namespace luci
 {
 
+void CircleConst::bind(const std::shared_ptr<const void> &owner, const uint8_t *data, size_t size)
+{
+  assert(dtype() != loco::DataType::STRING);
+  assert(owner != nullptr);
+  assert(data != nullptr);
+
+  _data.clear();
+  _data.shrink_to_fit();
+
+  _ext_owner = owner;
+  _ext_size = size;
+  _ext_data.store(data, std::memory_order_release);
+}
+
+void CircleConst::materialize(void)
+{
+  // NOTE Payload is copied once even if threads call non-const accessors at the same time
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto ext_data = _ext_data.load(std::memory_order_acquire);
+  if (ext_data == nullptr)
+    return;
+
+  _data.assign(ext_data, ext_data + _ext_size);
+
+  // Readers see the copied payload once _ext_data is cleared
+  _ext_data.store(nullptr, std::memory_order_release);
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(raw_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return raw_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  if (external())
+    materialize();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +72,15 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(raw_data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  if (external())
+    materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +88,14 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(raw_data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  if (external())
+    materialize();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
@@ -80,6 +117,8 @@ INSTANTIATE(loco::DataType::U8);
 INSTANTIATE(loco::DataType::U4);
 INSTANTIATE(loco::DataType::BOOL);
 INSTANTIATE(loco::DataType::FLOAT16);
+INSTANTIATE(loco::DataType::GGML_Q4_0);
+INSTANTIATE(loco::DataType::GGML_Q8_0);
 
 #undef INSTANTIATE
 
@@ -88,14 +127,14 @@ INSTANTIATE(loco::DataType::FLOAT16);
 template <> uint32_t CircleConst::size<loco::DataType::STRING>(void) const
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(_data.size() == 0 && not external());
   return _strings.size();
 }
 
 template <> void CircleConst::size<loco::DataType::STRING>(uint32_t l)
 {
   assert(dtype() == loco::DataType::STRING);
-  assert(_data.size() == 0);
+  assert(_data.size() == 0 && not external());
   _strings.resize(l);
 }
 
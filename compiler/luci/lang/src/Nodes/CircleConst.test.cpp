@@ -19,6 +19,8 @@
 #include "luci/IR/CircleDialect.h"
 #include "luci/IR/CircleNodeVisitor.h"
 
+#include <thread>
+
 #include <gtest/gtest.h>
 
 TEST(CircleConstTest, constructor)
@@ -64,3 +66,68 @@ TEST(CircleConstTest, string)
   ASSERT_EQ(1, const_node.size<loco::DataType::STRING>());
   EXPECT_TRUE(std::string("Hello") == const_node.at<loco::DataType::STRING>(0));
 }
+
+TEST(CircleConstTest, bind)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>{1, 2, 3});
+  const auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.bind(owner, data, owner->size() * sizeof(int32_t));
+
+  const auto &cnode = const_node;
+  ASSERT_TRUE(const_node.external());
+  ASSERT_EQ(3, cnode.size<loco::DataType::S32>());
+  EXPECT_EQ(2, cnode.at<loco::DataType::S32>(1));
+  EXPECT_EQ(data, cnode.raw_data());
+
+  // copy-on-write
+  const_node.at<loco::DataType::S32>(1) = 4;
+  ASSERT_FALSE(const_node.external());
+  EXPECT_EQ(4, cnode.at<loco::DataType::S32>(1));
+  EXPECT_EQ(2, owner->at(1));
+}
+
+TEST(CircleConstTest, bind_resize)
+{
+  auto owner = std::make_shared<std::vector<float>>(std::vector<float>{1.0f, 2.0f});
+  const auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::FLOAT32);
+  const_node.bind(owner, data, owner->size() * sizeof(float));
+  const_node.size<loco::DataType::FLOAT32>(3);
+
+  const auto &cnode = const_node;
+  ASSERT_FALSE(const_node.external());
+  ASSERT_EQ(3, cnode.size<loco::DataType::FLOAT32>());
+  EXPECT_FLOAT_EQ(2.0f, cnode.at<loco::DataType::FLOAT32>(1));
+}
+
+TEST(CircleConstTest, bind_concurrent_write)
+{
+  auto owner = std::make_shared<std::vector<int32_t>>(std::vector<int32_t>(64, 0));
+  const auto data = reinterpret_cast<const uint8_t *>(owner->data());
+
+  luci::CircleConst const_node;
+  const_node.dtype(loco::DataType::S32);
+  const_node.bind(owner, data, owner->size() * sizeof(int32_t));
+
+  // Each thread writes its own elements, while the first write copies the payload
+  std::vector<std::thread> threads;
+  for (int32_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&const_node, t]() {
+      for (uint32_t i = t; i < 64; i += 4)
+        const_node.at<loco::DataType::S32>(i) = static_cast<int32_t>(i);
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  const auto &cnode = const_node;
+  ASSERT_FALSE(const_node.external());
+  for (uint32_t i = 0; i < 64; ++i)
+    EXPECT_EQ(i, cnode.at<loco::DataType::S32>(i));
+}
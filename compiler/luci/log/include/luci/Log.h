@@ -30,6 +30,25 @@ class Logger final : public hermes::Source
 public:
   Logger(hermes::Context *ctx);
   ~Logger();
+
+private:
+  /**
+   * @brief MessageBus which posts messages of all loggers to the context one at a time
+   */
+  class SerialBus final : public hermes::MessageBus
+  {
+  public:
+    explicit SerialBus(hermes::MessageBus *bus) : _bus{bus} {}
+
+  public:
+    void post(std::unique_ptr<hermes::Message> &&msg) override;
+
+  private:
+    hermes::MessageBus *_bus;
+  };
+
+private:
+  SerialBus _serial_bus;
 };
 
 /**
@@ -70,9 +89,10 @@ private:
 #define WARN(name) HERMES_VERBOSE(name, 2)
 #define VERBOSE(name, lv) HERMES_VERBOSE(name, lv)
 
-// WARNING!
+// NOTE
 //
-//   THE CURRENT IMPLEMENTATION IS NOT THREAD SAFE.
+//   Loggers can be created and used in multiple threads.
+//   Each message is posted to sinks as a whole, so messages are not interleaved.
 //
 
 #endif // __LUCI_LOG_H__
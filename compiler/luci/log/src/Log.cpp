@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <iostream>
+#include <mutex>
 
 // TODO Extract these lexical conversion routines as a library
 namespace
@@ -43,11 +44,46 @@ template <> int safecast<int>(const char *s, const int &value)
 //
 // Logger
 //
+namespace
+{
+
+// Loggers can be created in worker threads of passes, while the registry of sources is not
+// thread safe
+std::mutex &registry_mutex(void)
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+// Sinks are not thread safe either
+std::mutex &post_mutex(void)
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+} // namespace
+
 namespace luci
 {
 
-Logger::Logger(hermes::Context *ctx) { activate(ctx->sources(), ctx->bus()); }
-Logger::~Logger() { deactivate(); }
+void Logger::SerialBus::post(std::unique_ptr<hermes::Message> &&msg)
+{
+  std::lock_guard<std::mutex> lock(post_mutex());
+  _bus->post(std::move(msg));
+}
+
+Logger::Logger(hermes::Context *ctx) : _serial_bus{ctx->bus()}
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  activate(ctx->sources(), &_serial_bus);
+}
+
+Logger::~Logger()
+{
+  std::lock_guard<std::mutex> lock(registry_mutex());
+  deactivate();
+}
 
 } // namespace luci
 
@@ -26,14 +26,13 @@ namespace luci
 
 hermes::Context *LoggingContext::get(void)
 {
-  static hermes::Context *ctx = nullptr;
-
-  if (ctx == nullptr)
-  {
-    ctx = new hermes::Context;
+  // NOTE Initialization of static local variable is thread safe
+  static hermes::Context *ctx = []() {
+    auto ctx = new hermes::Context;
     ctx->sinks()->append(std::make_unique<hermes::ConsoleReporter>());
     ctx->config(std::make_unique<LoggerConfig>());
-  }
+    return ctx;
+  }();
 
   return ctx;
 }
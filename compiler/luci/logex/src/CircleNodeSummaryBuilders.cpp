@@ -66,6 +66,10 @@ std::string to_str(loco::DataType type)
       return "MXFP4";
     case loco::DataType::MXINT8:
       return "MXINT8";
+    case loco::DataType::GGML_Q4_0:
+      return "GGML_Q4_0";
+    case loco::DataType::GGML_Q8_0:
+      return "GGML_Q8_0";
 
     default:
       return "Error";
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARTITION_AUTO_H__
+#define __LUCI_PARTITION_AUTO_H__
+
+#include "luci/Partition.h"
+
+#include <luci/IR/CircleNode.h>
+#include <luci/IR/Module.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Cost information to partition automatically
+ */
+struct PartitionCost
+{
+  // measured cost of op: OPNAME=cost, e.g. time in us
+  // ops not found here use estimated cost scaled to the measured ones
+  // NOTE cost of an op is the same for all groups, i.e. it doesn't depend on backend
+  std::unordered_map<std::string /* OPNAME */, double /* cost */> byopnames;
+
+  // cost to transfer a byte of tensor between two partitions
+  double transfer_per_byte = 0.0;
+
+  // allowed ratio over the minimal bottleneck cost to reduce transfer bytes
+  double balance_tolerance = 0.1;
+};
+
+/**
+ * @brief Result of automatic partitioning, in order of partition.groups
+ */
+struct PartitionAutoStats
+{
+  std::vector<double> stage_costs;     // compute cost of each stage
+  std::vector<uint64_t> stage_inbytes; // bytes transferred from previous stages
+};
+
+/**
+ * @brief Return estimated cost of node, MACs for compute heavy ops or output size otherwise
+ */
+double estimate_cost(const luci::CircleNode *node);
+
+/**
+ * @brief Assign ops of main graph to partition.groups as consecutive pipeline stages
+ *
+ * Ops are placed in topological order and split into stages in order of partition.groups,
+ * minimizing the maximum stage cost, which includes the transfer cost of tensors coming
+ * from previous stages. Among splits within balance_tolerance of the minimum, the one with
+ * the smallest transferred bytes is chosen. Result is set to partition.byopnames with
+ * COMPLY::OPNAME, so ops need unique names.
+ */
+PartitionAutoStats auto_partition(const luci::Module *module, luci::PartitionTable &partition,
+                                  const PartitionCost &cost);
+
+} // namespace luci
+
+#endif // __LUCI_PARTITION_AUTO_H__
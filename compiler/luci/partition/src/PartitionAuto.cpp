@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionAuto.h"
+#include "PartitionPGroups.h"
+
+#include "luci/Log.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <loco.h>
+#include <loco/IR/DataTypeTraits.h>
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+namespace
+{
+
+uint64_t num_elements(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return 0;
+
+  uint64_t elements = 1;
+  for (uint32_t r = 0; r < node->rank(); ++r)
+  {
+    // consider unknown dimension as 1, e.g. batch
+    if (node->dim(r).known())
+      elements *= node->dim(r).value();
+  }
+  return elements;
+}
+
+uint64_t num_bytes(const luci::CircleNode *node)
+{
+  return num_elements(node) * loco::size(node->dtype());
+}
+
+uint32_t dim_of(const loco::Node *node, uint32_t axis)
+{
+  auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+  if (circle_node->shape_status() != luci::ShapeStatus::VALID || axis >= circle_node->rank() ||
+      !circle_node->dim(axis).known())
+    return 1;
+  return circle_node->dim(axis).value();
+}
+
+uint32_t last_dim_of(const loco::Node *node, uint32_t from_last)
+{
+  auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+  if (circle_node->rank() <= from_last)
+    return 1;
+  return dim_of(node, circle_node->rank() - 1 - from_last);
+}
+
+/**
+ * @brief Return position of op which produces node, -1 if node is not produced by an op
+ * @note  Virtual output nodes like CircleSplitOut are produced by their owner op
+ */
+int64_t producer_position(const luci::CircleNode *node,
+                          const std::map<const luci::CircleNode *, int64_t> &positions)
+{
+  while (node != nullptr)
+  {
+    auto it = positions.find(node);
+    if (it != positions.end())
+      return it->second;
+    if (node->arity() == 0 || dynamic_cast<const luci::CircleOutput *>(node) != nullptr)
+      break;
+    node = loco::must_cast<const luci::CircleNode *>(node->arg(0));
+  }
+  return -1;
+}
+
+/**
+ * @brief Split ops of costs into at most max_stages consecutive stages
+ *
+ * Stage cost of ops [i, j) is the sum of their costs and the transfer cost of cut bytes at i.
+ * First the minimal bottleneck is found, then the split with the smallest sum of cut bytes
+ * whose stage costs are within the tolerance of the bottleneck.
+ *
+ * @return begin positions of stages
+ */
+std::vector<size_t> split_stages(const std::vector<double> &costs,
+                                 const std::vector<uint64_t> &cut_bytes, size_t max_stages,
+                                 double transfer_per_byte, double tolerance)
+{
+  const size_t n = costs.size();
+  const size_t K = std::min(max_stages, n);
+  const double inf = std::numeric_limits<double>::infinity();
+
+  std::vector<double> prefix(n + 1, 0.0);
+  for (size_t i = 0; i < n; ++i)
+    prefix[i + 1] = prefix[i] + costs[i];
+
+  auto stage_cost = [&](size_t i, size_t j) {
+    return prefix[j] - prefix[i] + transfer_per_byte * static_cast<double>(cut_bytes[i]);
+  };
+
+  // bottleneck[k][j]: minimal bottleneck of first j ops in k + 1 stages
+  std::vector<std::vector<double>> bottleneck(K, std::vector<double>(n + 1, inf));
+  for (size_t j = 1; j <= n; ++j)
+    bottleneck[0][j] = stage_cost(0, j);
+  for (size_t k = 1; k < K; ++k)
+  {
+    for (size_t j = k + 1; j <= n; ++j)
+    {
+      for (size_t i = k; i < j; ++i)
+        bottleneck[k][j] =
+          std::min(bottleneck[k][j], std::max(bottleneck[k - 1][i], stage_cost(i, j)));
+    }
+  }
+  double best = inf;
+  for (size_t k = 0; k < K; ++k)
+    best = std::min(best, bottleneck[k][n]);
+
+  // cut[k][j]: minimal sum of cut bytes of first j ops in k + 1 stages within the limit
+  const double limit = best * (1.0 + std::max(tolerance, 0.0)) + 1e-9;
+  const uint64_t none = std::numeric_limits<uint64_t>::max();
+  std::vector<std::vector<uint64_t>> cut(K, std::vector<uint64_t>(n + 1, none));
+  std::vector<std::vector<size_t>> from(K, std::vector<size_t>(n + 1, 0));
+  for (size_t j = 1; j <= n; ++j)
+  {
+    if (stage_cost(0, j) <= limit)
+      cut[0][j] = 0;
+  }
+  for (size_t k = 1; k < K; ++k)
+  {
+    for (size_t j = k + 1; j <= n; ++j)
+    {
+      for (size_t i = k; i < j; ++i)
+      {
+        if (cut[k - 1][i] == none || stage_cost(i, j) > limit)
+          continue;
+        const uint64_t bytes = cut[k - 1][i] + cut_bytes[i];
+        if (bytes < cut[k][j])
+        {
+          cut[k][j] = bytes;
+          from[k][j] = i;
+        }
+      }
+    }
+  }
+
+  size_t stages = 0;
+  for (size_t k = 0; k < K; ++k)
+  {
+    if (cut[k][n] != none && (stages == 0 || cut[k][n] < cut[stages - 1][n]))
+      stages = k + 1;
+  }
+  assert(stages > 0);
+
+  std::vector<size_t> begins(stages, 0);
+  size_t j = n;
+  for (size_t k = stages - 1; k > 0; --k)
+  {
+    begins[k] = from[k][j];
+    j = begins[k];
+  }
+  return begins;
+}
+
+} // namespace
+
+namespace luci
+{
+
+double estimate_cost(const luci::CircleNode *node)
+{
+  const double out_elements = static_cast<double>(num_elements(node));
+
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CONV_2D:
+    {
+      // filter: [O, H, W, I]
+      auto conv = loco::must_cast<const luci::CircleConv2D *>(node);
+      return out_elements * dim_of(conv->filter(), 1) * dim_of(conv->filter(), 2) *
+             dim_of(conv->filter(), 3);
+    }
+    case luci::CircleOpcode::DEPTHWISE_CONV_2D:
+    {
+      // filter: [1, H, W, O]
+      auto dconv = loco::must_cast<const luci::CircleDepthwiseConv2D *>(node);
+      return out_elements * dim_of(dconv->filter(), 1) * dim_of(dconv->filter(), 2);
+    }
+    case luci::CircleOpcode::TRANSPOSE_CONV:
+    {
+      // filter: [O, H, W, I]
+      auto tconv = loco::must_cast<const luci::CircleTransposeConv *>(node);
+      auto in_elements =
+        num_elements(loco::must_cast<const luci::CircleNode *>(tconv->outBackprop()));
+      return static_cast<double>(in_elements) * dim_of(tconv->filter(), 0) *
+             dim_of(tconv->filter(), 1) * dim_of(tconv->filter(), 2);
+    }
+    case luci::CircleOpcode::FULLY_CONNECTED:
+    {
+      // weights: [O, I]
+      auto fc = loco::must_cast<const luci::CircleFullyConnected *>(node);
+      return out_elements * last_dim_of(fc->weights(), 0);
+    }
+    case luci::CircleOpcode::BATCH_MATMUL:
+    {
+      auto bmm = loco::must_cast<const luci::CircleBatchMatMul *>(node);
+      return out_elements * last_dim_of(bmm->x(), bmm->adj_x() ? 1 : 0);
+    }
+    default:
+      break;
+  }
+
+  // memory bound ops: cost by output size, or by outputs for multiple output ops
+  if (out_elements == 0)
+  {
+    double succ_elements = 0;
+    for (auto succ : loco::succs(node))
+      succ_elements += num_elements(loco::must_cast<const luci::CircleNode *>(succ));
+    return std::max(succ_elements, 1.0);
+  }
+  return out_elements;
+}
+
+PartitionAutoStats auto_partition(const luci::Module *module, luci::PartitionTable &partition,
+                                  const PartitionCost &cost)
+{
+  assert(module != nullptr);
+
+  LOGGER(l);
+
+  if (partition.groups.empty())
+    throw std::runtime_error("auto_partition: 'backends' is empty");
+
+  // NOTE Only main graph is partitioned like produce_pgroups()
+  auto graph = module->graph();
+
+  // ops in topological order
+  std::vector<const luci::CircleNode *> ops;
+  std::map<const luci::CircleNode *, int64_t> positions;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
+  {
+    auto circle_node = loco::must_cast<const luci::CircleNode *>(node);
+    if (!check_allocate_partition(circle_node))
+      continue;
+    positions[circle_node] = static_cast<int64_t>(ops.size());
+    ops.push_back(circle_node);
+  }
+
+  PartitionAutoStats stats;
+  partition.byopnames.clear();
+  partition.comply = luci::PartitionTable::COMPLY::OPNAME;
+  if (ops.empty())
+    return stats;
+
+  // costs of ops, estimated costs are scaled to measured costs
+  std::vector<double> costs(ops.size(), 0.0);
+  double measured_sum = 0.0;
+  double estimated_sum = 0.0;
+  for (size_t i = 0; i < ops.size(); ++i)
+  {
+    costs[i] = estimate_cost(ops[i]);
+    auto it = cost.byopnames.find(ops[i]->name());
+    if (it != cost.byopnames.end())
+    {
+      measured_sum += it->second;
+      estimated_sum += costs[i];
+    }
+  }
+  const double scale =
+    (measured_sum > 0.0 && estimated_sum > 0.0) ? measured_sum / estimated_sum : 1.0;
+  for (size_t i = 0; i < ops.size(); ++i)
+  {
+    auto it = cost.byopnames.find(ops[i]->name());
+    costs[i] = (it != cost.byopnames.end()) ? it->second : costs[i] * scale;
+  }
+
+  // bytes of tensors alive across the cut before each position
+  std::vector<int64_t> delta(ops.size() + 1, 0);
+  {
+    std::map<const luci::CircleNode *, int64_t> last_use;
+    for (size_t pos = 0; pos < ops.size(); ++pos)
+    {
+      for (uint32_t a = 0; a < ops[pos]->arity(); ++a)
+      {
+        auto arg = loco::must_cast<const luci::CircleNode *>(ops[pos]->arg(a));
+        auto producer = producer_position(arg, positions);
+        if (producer >= 0 && producer < static_cast<int64_t>(pos))
+          last_use[arg] = std::max<int64_t>(last_use[arg], pos);
+      }
+    }
+    for (auto &[tensor, last] : last_use)
+    {
+      const auto bytes = static_cast<int64_t>(num_bytes(tensor));
+      delta[producer_position(tensor, positions) + 1] += bytes;
+      delta[last + 1] -= bytes;
+    }
+  }
+  std::vector<uint64_t> cut_bytes(ops.size(), 0);
+  {
+    int64_t alive = 0;
+    for (size_t pos = 1; pos < ops.size(); ++pos)
+    {
+      alive += delta[pos];
+      cut_bytes[pos] = static_cast<uint64_t>(alive);
+    }
+  }
+
+  auto begins = split_stages(costs, cut_bytes, partition.groups.size(), cost.transfer_per_byte,
+                             cost.balance_tolerance);
+
+  for (size_t s = 0; s < begins.size(); ++s)
+  {
+    const size_t begin = begins[s];
+    const size_t end = (s + 1 < begins.size()) ? begins[s + 1] : ops.size();
+    const auto &group = partition.groups.at(s);
+
+    double stage_cost = 0.0;
+    for (size_t pos = begin; pos < end; ++pos)
+    {
+      const auto &name = ops[pos]->name();
+      if (name.empty())
+        throw std::runtime_error("auto_partition: op without name is not supported");
+      auto inserted = partition.byopnames.emplace(name, group);
+      if (!inserted.second && inserted.first->second != group)
+        throw std::runtime_error("auto_partition: op name '" + name + "' is not unique");
+      stage_cost += costs[pos];
+    }
+    stats.stage_costs.push_back(stage_cost);
+    stats.stage_inbytes.push_back(cut_bytes[begin]);
+
+    INFO(l) << "Stage " << group << ": ops [" << begin << ", " << end << "), cost " << stage_cost
+            << ", in bytes " << cut_bytes[begin] << std::endl;
+  }
+
+  return stats;
+}
+
+} // namespace luci
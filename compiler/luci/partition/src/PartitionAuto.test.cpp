@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/PartitionAuto.h"
+
+#include <luci/test/TestIOGraph.h>
+
+#include <luci/IR/Nodes/CircleSqrt.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+class SqrtChainGraphlet
+{
+public:
+  SqrtChainGraphlet() = default;
+
+public:
+  void init(loco::Graph *g, const ShapeU32 input_shape)
+  {
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      _sqrt[i] = g->nodes()->create<luci::CircleSqrt>();
+      _sqrt[i]->dtype(loco::DataType::FLOAT32);
+      _sqrt[i]->shape(input_shape);
+      _sqrt[i]->shape_status(luci::ShapeStatus::VALID);
+      _sqrt[i]->name("sqrt" + std::to_string(i));
+    }
+  }
+
+protected:
+  luci::CircleSqrt *_sqrt[4] = {nullptr, nullptr, nullptr, nullptr};
+};
+
+class SqrtChainGraph : public TestIOGraph, public SqrtChainGraphlet
+{
+public:
+  SqrtChainGraph() = default;
+
+public:
+  void init(const ShapeU32 shape)
+  {
+    TestIOGraph::init(shape, shape);
+    SqrtChainGraphlet::init(g(), shape);
+
+    _sqrt[0]->x(input());
+    for (uint32_t i = 1; i < 4; ++i)
+      _sqrt[i]->x(_sqrt[i - 1]);
+
+    output()->from(_sqrt[3]);
+  }
+};
+
+} // namespace
+
+TEST(PartitionAutoTest, balanced_split)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  luci::PartitionCost cost;
+  cost.balance_tolerance = 0.0;
+
+  auto stats = luci::auto_partition(&module, pt, cost);
+
+  ASSERT_EQ(luci::PartitionTable::COMPLY::OPNAME, pt.comply);
+  ASSERT_EQ(4, pt.byopnames.size());
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("A", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+
+  ASSERT_EQ(2, stats.stage_costs.size());
+  ASSERT_DOUBLE_EQ(12.0, stats.stage_costs[0]);
+  ASSERT_DOUBLE_EQ(12.0, stats.stage_costs[1]);
+  ASSERT_EQ(0, stats.stage_inbytes[0]);
+  ASSERT_EQ(6 * sizeof(float), stats.stage_inbytes[1]);
+}
+
+TEST(PartitionAutoTest, measured_cost)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  // sqrt0 is measured to be heavy
+  luci::PartitionCost cost;
+  cost.byopnames["sqrt0"] = 100.0;
+  cost.byopnames["sqrt1"] = 10.0;
+  cost.byopnames["sqrt2"] = 20.0;
+  cost.byopnames["sqrt3"] = 30.0;
+  cost.balance_tolerance = 0.0;
+
+  auto stats = luci::auto_partition(&module, pt, cost);
+
+  ASSERT_EQ("A", pt.byopnames.at("sqrt0"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt1"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt2"));
+  ASSERT_EQ("B", pt.byopnames.at("sqrt3"));
+  ASSERT_DOUBLE_EQ(100.0, stats.stage_costs[0]);
+  ASSERT_DOUBLE_EQ(60.0, stats.stage_costs[1]);
+}
+
+TEST(PartitionAutoTest, estimated_cost_scaled_to_measured)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  // estimated cost of sqrt0 is 6, so others are scaled by 2
+  luci::PartitionCost cost;
+  cost.byopnames["sqrt0"] = 12.0;
+  cost.balance_tolerance = 0.0;
+
+  auto stats = luci::auto_partition(&module, pt, cost);
+
+  ASSERT_EQ(2, stats.stage_costs.size());
+  ASSERT_DOUBLE_EQ(24.0, stats.stage_costs[0]);
+  ASSERT_DOUBLE_EQ(24.0, stats.stage_costs[1]);
+}
+
+TEST(PartitionAutoTest, transfer_cost_keeps_single_stage)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  // transfer of 24 bytes costs more than splitting saves
+  luci::PartitionCost cost;
+  cost.transfer_per_byte = 1.0;
+
+  auto stats = luci::auto_partition(&module, pt, cost);
+
+  ASSERT_EQ(1, stats.stage_costs.size());
+  for (auto &byopname : pt.byopnames)
+    ASSERT_EQ("A", byopname.second);
+}
+
+TEST(PartitionAutoTest, estimate_cost)
+{
+  SqrtChainGraph g;
+  g.init({2, 3});
+
+  auto sqrt = loco::must_cast<luci::CircleNode *>(g.output()->from());
+  ASSERT_DOUBLE_EQ(6.0, luci::estimate_cost(sqrt));
+}
+
+TEST(PartitionAutoTest, no_groups_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  luci::PartitionCost cost;
+
+  EXPECT_ANY_THROW(luci::auto_partition(&module, pt, cost));
+}
+
+TEST(PartitionAutoTest, duplicate_name_NEG)
+{
+  luci::Module module;
+
+  SqrtChainGraph g;
+  g.init({2, 3});
+  for (auto node : loco::all_nodes(g.g()))
+  {
+    auto sqrt = dynamic_cast<luci::CircleSqrt *>(node);
+    if (sqrt != nullptr)
+      sqrt->name("sqrt");
+  }
+  g.transfer_to(&module);
+
+  luci::PartitionTable pt;
+  pt.groups = {"A", "B"};
+  pt.default_group = "A";
+
+  luci::PartitionCost cost;
+  cost.balance_tolerance = 0.0;
+
+  EXPECT_ANY_THROW(luci::auto_partition(&module, pt, cost));
+}
@@ -55,6 +55,11 @@ public:
   bool visit(const luci::CircleNode *) final { return false; }
 };
 
+} // namespace
+
+namespace luci
+{
+
 bool check_allocate_partition(const luci::CircleNode *node)
 {
   IsVirtualNode query;
@@ -72,7 +77,7 @@ bool check_allocate_partition(const luci::CircleNode *node)
   return true;
 }
 
-} // namespace
+} // namespace luci
 
 namespace
 {
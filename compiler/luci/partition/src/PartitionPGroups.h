@@ -26,6 +26,11 @@
 namespace luci
 {
 
+/**
+ * @brief Return true if node is a normal node to be assigned to a partition group
+ */
+bool check_allocate_partition(const luci::CircleNode *node);
+
 /**
  * @brief This will produce a PGroups from Module and PartitionTable.
  * @note  Each PGroup will hold one CircleNode and partition key value as group.
@@ -73,7 +73,7 @@ public:
       // quantize
       Quantize_input_model_dtype,
       Quantize_output_model_dtype,
-      Quantize_granularity, // layer-wise or channel-wise
+      Quantize_granularity, // layer-wise, channel-wise or group-wise
       Quantize_tensor_names,
       Quantize_scales,
       Quantize_zero_points,
@@ -87,6 +87,7 @@ public:
       Quantize_output_type,
       Quantize_TF_style_maxpool,
       Quantize_save_min_max,
+      Quantize_group_size, // number of elements in a group for group-wise
     };
 
     virtual ~Options() = default;
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_INCREMENTAL_PASS_H__
+#define __LUCI_PASS_INCREMENTAL_PASS_H__
+
+#include <loco.h>
+
+#include <unordered_set>
+
+namespace luci
+{
+
+/**
+ * @brief Pass which can be run only for the nodes touched since its last run
+ *
+ * @note  IncrementalPhaseRunner calls run(graph, dirty) with the nodes created, rewired or
+ *        updated (see loco::notify_update) since the last run of the pass, and their arguments.
+ *        The graph has no dead node at the call. The pass must give the same result as
+ *        run(graph), as long as all the other nodes are the same as in the last run.
+ */
+class IncrementalPass
+{
+public:
+  virtual ~IncrementalPass() = default;
+
+public:
+  // Run pass for dirty nodes and return false if there was nothing changed
+  virtual bool run(loco::Graph *graph, const std::unordered_set<loco::Node *> &dirty) = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_PASS_INCREMENTAL_PASS_H__
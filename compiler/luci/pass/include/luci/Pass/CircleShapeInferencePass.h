@@ -20,6 +20,7 @@
 #include <loco.h>
 
 #include <luci/ModulePass.h>
+#include <luci/IncrementalPass.h>
 
 namespace luci
 {
@@ -27,7 +28,7 @@ namespace luci
 /**
  * @brief Pass to infer shape of circle nodes
  */
-class CircleShapeInferencePass : public luci::Pass
+class CircleShapeInferencePass : public luci::Pass, public luci::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::CircleShapeInferencePass"; }
@@ -35,6 +36,7 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *graph);
+  bool run(loco::Graph *graph, const std::unordered_set<loco::Node *> &dirty);
 };
 
 } // namespace luci
@@ -20,6 +20,7 @@
 #include <loco.h>
 
 #include <luci/ModulePass.h>
+#include <luci/IncrementalPass.h>
 
 namespace luci
 {
@@ -27,7 +28,7 @@ namespace luci
 /**
  * @brief Pass to infer type of circle nodes
  */
-class CircleTypeInferencePass : public luci::Pass
+class CircleTypeInferencePass : public luci::Pass, public luci::IncrementalPass
 {
 public:
   virtual const char *name(void) const { return "luci::CircleTypeInferencePass"; }
@@ -35,6 +36,7 @@ public:
 public:
   bool run(luci::Module *m);
   bool run(loco::Graph *g);
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty);
 };
 
 } // namespace luci
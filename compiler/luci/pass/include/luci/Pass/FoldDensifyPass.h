@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
@@ -26,11 +28,12 @@ namespace luci
  * @brief  Class to Fold Densify if input is Sparse Constant
  *
  */
-struct FoldDensifyPass final : public logo::Pass
+struct FoldDensifyPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::FoldDensifyPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
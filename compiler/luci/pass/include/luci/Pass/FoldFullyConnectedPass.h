@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
@@ -26,11 +28,12 @@ namespace luci
  * @brief  Class to fold FullyConnected with constant input and filter into a
  * constant tensor
  */
-struct FoldFullyConnectedPass final : public logo::Pass
+struct FoldFullyConnectedPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::FoldFullyConnectedPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
@@ -19,17 +19,20 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to fuse Add into CircleTransposeConv
  */
-struct FuseAddWithTConvPass final : public logo::Pass
+struct FuseAddWithTConvPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::FuseAddWithTConvPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
@@ -19,6 +19,7 @@
 
 #include <loco.h>
 
+#include <luci/IncrementalPass.h>
 #include <luci/ModulePass.h>
 
 namespace luci
@@ -27,11 +28,12 @@ namespace luci
 /**
  * @brief  Class to fuse Mul operation with a Div operation
  */
-struct FuseMulWithDivPass final : public logo::Pass
+struct FuseMulWithDivPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::FuseMulWithDivPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
@@ -28,6 +28,7 @@ enum QuantizationGranularity
 {
   LayerWise = 0,
   ChannelWise = 1,
+  GroupWise = 2, // quantize each group of consecutive elements (block quantization)
 };
 
 struct LayerInfo
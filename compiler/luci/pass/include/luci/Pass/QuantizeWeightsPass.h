@@ -37,6 +37,8 @@ public:
     loco::DataType input_model_dtype = loco::DataType::Unknown;
     loco::DataType output_model_dtype = loco::DataType::Unknown;
     QuantizationGranularity granularity = QuantizationGranularity::ChannelWise;
+    // Number of elements in a group, used for GroupWise granularity
+    uint32_t group_size = 32;
   };
 
 public:
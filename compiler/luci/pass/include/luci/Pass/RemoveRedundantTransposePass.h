@@ -19,17 +19,20 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
 /**
  * @brief fuse or remove subsequent Transpose operators
  */
-struct RemoveRedundantTransposePass final : public logo::Pass
+struct RemoveRedundantTransposePass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::RemoveRedundantTransposePass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
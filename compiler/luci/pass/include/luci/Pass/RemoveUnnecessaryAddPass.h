@@ -19,17 +19,20 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to temove unnecessary(input and output are same) Add node.
  */
-struct RemoveUnnecessaryAddPass final : public logo::Pass
+struct RemoveUnnecessaryAddPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryAddPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
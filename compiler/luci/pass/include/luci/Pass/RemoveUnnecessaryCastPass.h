@@ -19,6 +19,8 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
@@ -27,11 +29,12 @@ namespace luci
  * @details This class will remove unnecessary Cast nodes.
  *          See https://github.com/Samsung/ONE/issues/13623 for more details.
  */
-struct RemoveUnnecessaryCastPass final : public logo::Pass
+struct RemoveUnnecessaryCastPass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryCastPass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
@@ -19,17 +19,20 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to Remove Unnecessary(input shape and output shape same) Reshape node.
  */
-struct RemoveUnnecessaryReshapePass final : public logo::Pass
+struct RemoveUnnecessaryReshapePass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryReshapePass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
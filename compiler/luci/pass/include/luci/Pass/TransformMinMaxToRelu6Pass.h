@@ -19,17 +19,20 @@
 
 #include <logo/Pass.h>
 
+#include <luci/IncrementalPass.h>
+
 namespace luci
 {
 
 /**
  * @brief  Class to transform Maximum(Minimum(input, 6), 0) to Relu6
  */
-struct TransformMinMaxToRelu6Pass final : public logo::Pass
+struct TransformMinMaxToRelu6Pass final : public logo::Pass, public luci::IncrementalPass
 {
   const char *name(void) const final { return "luci::TransformMinMaxToRelu6Pass"; }
 
   bool run(loco::Graph *g) final;
+  bool run(loco::Graph *g, const std::unordered_set<loco::Node *> &dirty) final;
 };
 
 } // namespace luci
@@ -111,6 +111,7 @@
 // logo passes
 #include <logo/RemoveDeadNodeWithQueryPass.h>
 
+#include "IncrementalPhase.h"
 #include "ModulePhase.h"
 #include "ProgressReporter.h"
 
@@ -204,7 +205,7 @@ void convert_nchw_to_nhwc(loco::Graph *g, bool preserve_input, bool preserve_out
     std::make_unique<luci::ConvertNCHWToNHWCPass>(preserve_input, preserve_output));
 
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  IncrementalPhaseRunner phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -228,13 +229,14 @@ void CircleOptimizer::canonicalize(loco::Graph *g) const
 {
   logo::Phase phase;
 
+  // RemoveDeadNodeWithQueryPass comes first so that inference passes run incrementally
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
   phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
   phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
   phase.emplace_back(std::make_unique<luci::CanonicalizePass>());
-  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
 
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  IncrementalPhaseRunner phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -423,7 +425,7 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   /* TRANSFORM DECLARATION END */
 
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
-  logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
+  IncrementalPhaseRunner phase_runner{g};
   phase_runner.attach(&prog);
   phase_runner.run(phase);
 }
@@ -634,7 +634,7 @@ void CircleQuantizer::quantize_weights(loco::Graph *g) const
   {
     static const std::vector<std::string> qw_supported_input_model_dtype{"float32"};
     static const std::vector<std::string> qw_supported_output_model_dtype{"int4", "int8", "int16"};
-    static const std::vector<std::string> qw_supported_granularity{"channel"};
+    static const std::vector<std::string> qw_supported_granularity{"channel", "group"};
 
     auto input_model_dtype =
       _options->param(Options::AlgorithmParameters::Quantize_input_model_dtype);
@@ -658,6 +658,10 @@ void CircleQuantizer::quantize_weights(loco::Graph *g) const
       ctx->input_model_dtype = str_to_dtype(input_model_dtype);
       ctx->output_model_dtype = str_to_dtype(output_model_dtype);
       ctx->granularity = str_to_granularity(granularity);
+
+      auto group_size = _options->param(Options::AlgorithmParameters::Quantize_group_size);
+      if (not group_size.empty())
+        ctx->group_size = std::stoul(group_size);
     }
     luci::QuantizeWeightsPass weights_quantizer(std::move(ctx));
 
@@ -23,6 +23,33 @@
 
 #include <loco.h>
 
+namespace
+{
+
+// Return true if shape of node is updated
+bool infer_shape(loco::Node *node)
+{
+  luci::sinf::Rule shape_infer_rule;
+  loco::TensorShape shape;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+  if (shape_infer_rule.infer(circle_node, shape) && !luci::is_same_shape(circle_node, shape))
+  {
+    circle_node->rank(shape.rank());
+    for (uint32_t i = 0; i < shape.rank(); ++i)
+      circle_node->dim(i) = shape.dim(i);
+
+    circle_node->shape_status(luci::ShapeStatus::VALID);
+
+    loco::notify_update(node);
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -41,27 +68,20 @@ bool CircleShapeInferencePass::run(luci::Module *m)
 
 bool CircleShapeInferencePass::run(loco::Graph *g)
 {
-  luci::sinf::Rule shape_infer_rule;
   bool changed = false;
 
   for (auto node : inference_candidates(g))
   {
-    loco::TensorShape shape;
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-
-    if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
-    {
-      circle_node->rank(shape.rank());
-      for (uint32_t i = 0; i < shape.rank(); ++i)
-        circle_node->dim(i) = shape.dim(i);
-
-      circle_node->shape_status(luci::ShapeStatus::VALID);
-
+    if (infer_shape(node))
       changed = true;
-    }
   }
 
   return changed;
 }
 
+bool CircleShapeInferencePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return infer_incrementally(dirty, infer_shape);
+}
+
 } // namespace luci
@@ -22,6 +22,29 @@
 
 #include <loco.h>
 
+namespace
+{
+
+// Return true if dtype of node is updated
+bool infer_type(loco::Node *node)
+{
+  luci::tinf::Rule type_infer_rule;
+  loco::DataType dtype;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+
+  if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
+  {
+    circle_node->dtype(dtype);
+
+    loco::notify_update(node);
+    return true;
+  }
+
+  return false;
+}
+
+} // namespace
+
 namespace luci
 {
 
@@ -40,22 +63,20 @@ bool CircleTypeInferencePass::run(luci::Module *m)
 
 bool CircleTypeInferencePass::run(loco::Graph *g)
 {
-  luci::tinf::Rule type_infer_rule;
   bool changed = false;
 
   for (auto node : inference_candidates(g))
   {
-    loco::DataType dtype;
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-
-    if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
-    {
-      circle_node->dtype(dtype);
+    if (infer_type(node))
       changed = true;
-    }
   }
 
   return changed;
 }
 
+bool CircleTypeInferencePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return infer_incrementally(dirty, infer_type);
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldAddV2Pass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -87,18 +89,10 @@ template <loco::DataType T> bool fold_add_v2(luci::CircleCustom *add_v2)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for AddV2 Op
- **/
-bool FoldAddV2Pass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto custom = dynamic_cast<luci::CircleCustom *>(node))
     {
@@ -117,4 +111,22 @@ bool FoldAddV2Pass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for AddV2 Op
+ **/
+bool FoldAddV2Pass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldAddV2Pass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldCastPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -99,18 +101,10 @@ bool fold_cast(luci::CircleCast *cast)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for Cast Op
- **/
-bool FoldCastPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto cast = dynamic_cast<luci::CircleCast *>(node))
     {
@@ -122,4 +116,22 @@ bool FoldCastPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for Cast Op
+ **/
+bool FoldCastPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldCastPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,7 @@
  */
 
 #include "luci/Pass/FoldDensifyPass.h"
+#include "helpers/PatternCandidates.h"
 #include "helpers/SparsityFormatConverter.h"
 
 #include <luci/IR/CircleNodes.h>
@@ -139,6 +140,22 @@ bool fold_densify(luci::CircleDensify *densify)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+
+  for (auto node : nodes)
+  {
+    if (auto densify = dynamic_cast<luci::CircleDensify *>(node))
+    {
+      if (fold_densify(densify))
+        changed = true;
+    }
+  }
+
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -163,18 +180,12 @@ namespace luci
  */
 bool FoldDensifyPass::run(loco::Graph *g)
 {
-  bool changed = false;
-
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto densify = dynamic_cast<luci::CircleDensify *>(node))
-    {
-      if (fold_densify(densify))
-        changed = true;
-    }
-  }
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
 
-  return changed;
+bool FoldDensifyPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
@@ -17,7 +17,9 @@
 #include "luci/Pass/FoldDepthwiseConv2DPass.h"
 
 #include "helpers/Compute.h"
+#include "helpers/PatternCandidates.h"
 #include "helpers/Shape.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/AttrFusedActFunc.h>
@@ -26,7 +28,10 @@
 
 #include <luci_compute/DepthwiseConv2D.h>
 
+#include <algorithm>
 #include <cassert>
+#include <stdexcept>
+#include <vector>
 
 namespace luci
 {
@@ -131,23 +136,74 @@ bool fold_depthwise_conv_2d(luci::CircleDepthwiseConv2D *node)
   constant->name(node->name());
 
   auto constant_data = &constant->at<loco::DataType::FLOAT32>(0);
-  comp_dwconv2d.output(constant_data);
-  comp_dwconv2d.compute();
+
+  // Input channels are split to threads, as batch size of constant input is usually small
+  const auto input_shape = static_shape(input);
+  const auto filter_shape = static_shape(filter);
+  const uint32_t in_channels = input_shape.dim(3).value();
+  const uint32_t multiplier = node->depthMultiplier();
+  const uint32_t out_channels = in_channels * multiplier;
+  const size_t grain = std::max<size_t>(1, ThreadPool::kElementGrain * in_channels / output_size);
+
+  // Copy data[..., offset:offset + count] of tensor whose last dimension is 'depth'
+  auto slice = [](const float *data, uint32_t size, uint32_t depth, uint32_t offset,
+                  uint32_t count) {
+    std::vector<float> sliced((size / depth) * count);
+    for (uint32_t i = 0; i < size / depth; ++i)
+      std::copy(data + i * depth + offset, data + i * depth + offset + count,
+                sliced.begin() + i * count);
+    return sliced;
+  };
+
+  ThreadPool::shared().parallel_for(in_channels, grain, [&](size_t begin, size_t end) {
+    if (begin == 0 and end == in_channels)
+    {
+      comp_dwconv2d.output(constant_data);
+      comp_dwconv2d.compute();
+      return;
+    }
+
+    // Compute output channels of input channels [begin, end)
+    const uint32_t channels = end - begin;
+    auto part_input = slice(input_data, loco::element_count(&input_shape), in_channels, begin,
+                            channels);
+    auto part_filter = slice(filter_data, loco::element_count(&filter_shape), out_channels,
+                             begin * multiplier, channels * multiplier);
+
+    auto part_input_shape = input_shape;
+    part_input_shape.dim(3).set(channels);
+    auto part_filter_shape = filter_shape;
+    part_filter_shape.dim(3).set(channels * multiplier);
+
+    compute::DepthwiseConv2D part_dwconv2d{};
+    set_params(node, part_dwconv2d);
+    part_dwconv2d.input(part_input_shape, part_input.data());
+    part_dwconv2d.filter(part_filter_shape, part_filter.data());
+    part_dwconv2d.bias(loco::TensorShape{channels * multiplier}, bias_data + begin * multiplier);
+    if (!part_dwconv2d.prepare())
+      throw std::runtime_error("FoldDepthwiseConv2DPass failed to compute " + node->name());
+
+    std::vector<float> part_output(output_size / in_channels * channels);
+    part_dwconv2d.output(part_output.data());
+    part_dwconv2d.compute();
+
+    const uint32_t part_depth = channels * multiplier;
+    for (uint32_t i = 0; i < output_size / out_channels; ++i)
+    {
+      std::copy(part_output.begin() + i * part_depth, part_output.begin() + (i + 1) * part_depth,
+                constant_data + i * out_channels + begin * multiplier);
+    }
+  });
 
   loco::replace(node).with(constant);
 
   return true;
 }
 
-} // namespace
-
-/**
- * Constant Folding for DepthwiseConv2D Op
- **/
-bool FoldDepthwiseConv2DPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto depthwise_conv2d = dynamic_cast<CircleDepthwiseConv2D *>(node);
 
@@ -167,4 +223,19 @@ bool FoldDepthwiseConv2DPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+/**
+ * Constant Folding for DepthwiseConv2D Op
+ **/
+bool FoldDepthwiseConv2DPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldDepthwiseConv2DPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
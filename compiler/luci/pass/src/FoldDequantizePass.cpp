@@ -15,6 +15,7 @@
  */
 
 #include "luci/Pass/FoldDequantizePass.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -77,13 +78,19 @@ luci::CircleConst *dequantized_const_node(luci::CircleConst *const_node)
   new_const_node->shape_status(luci::ShapeStatus::VALID);
   new_const_node->name(name + "_DQ");
 
+  // NOTE const_node is read through const methods from multiple threads
+  const luci::CircleConst *input = const_node;
+  auto &pool = luci::ThreadPool::shared();
+
   if (const_node->dtype() == loco::DataType::FLOAT16)
   {
-    for (uint32_t i = 0; i < new_const_node->size<loco::DataType::FLOAT32>(); ++i)
-    {
-      auto raw = const_node->at<loco::DataType::FLOAT16>(i);
-      new_const_node->at<loco::DataType::FLOAT32>(i) = fp16_ieee_to_fp32_value(raw);
-    }
+    pool.parallel_for(dim_size, luci::ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+      {
+        auto raw = input->at<loco::DataType::FLOAT16>(i);
+        new_const_node->at<loco::DataType::FLOAT32>(i) = fp16_ieee_to_fp32_value(raw);
+      }
+    });
     return new_const_node;
   }
 
@@ -101,60 +108,62 @@ luci::CircleConst *dequantized_const_node(luci::CircleConst *const_node)
   for (uint32_t i = q_dim + 1; i < const_node->rank(); ++i)
     right_count *= const_node->dim(i).value();
 
-  for (uint32_t i = 0; i < new_const_node->size<loco::DataType::FLOAT32>(); ++i)
-  {
-    uint32_t qd = (i % right_count) / (right_count / q_dim_value);
-    if (qd >= const_node->quantparam()->zerop.size())
-      qd = 0;
-
-    switch (const_node->dtype())
+  pool.parallel_for(dim_size, luci::ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
     {
-      case loco::DataType::U4:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::U4>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::S4:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::S4>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::S8:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::S8>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::S16:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::S16>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::S32:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::S32>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::S64:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::S64>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      case loco::DataType::U8:
-        new_const_node->at<loco::DataType::FLOAT32>(i) =
-          static_cast<float>(const_node->at<loco::DataType::U8>(i) -
-                             const_node->quantparam()->zerop.at(qd)) *
-          const_node->quantparam()->scale.at(qd);
-        break;
-      default:
-        throw std::runtime_error("Not supported dtype for FoldDequantizePass");
+      uint32_t qd = (i % right_count) / (right_count / q_dim_value);
+      if (qd >= input->quantparam()->zerop.size())
+        qd = 0;
+
+      switch (const_node->dtype())
+      {
+        case loco::DataType::U4:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::U4>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::S4:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::S4>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::S8:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::S8>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::S16:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::S16>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::S32:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::S32>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::S64:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::S64>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        case loco::DataType::U8:
+          new_const_node->at<loco::DataType::FLOAT32>(i) =
+            static_cast<float>(input->at<loco::DataType::U8>(i) -
+                               input->quantparam()->zerop.at(qd)) *
+            input->quantparam()->scale.at(qd);
+          break;
+        default:
+          throw std::runtime_error("Not supported dtype for FoldDequantizePass");
+      }
     }
-  }
+  });
 
   return new_const_node;
 }
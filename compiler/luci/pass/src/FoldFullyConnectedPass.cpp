@@ -17,7 +17,9 @@
 #include "luci/Pass/FoldFullyConnectedPass.h"
 
 #include "helpers/Compute.h"
+#include "helpers/PatternCandidates.h"
 #include "helpers/Shape.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/AttrFusedActFunc.h>
@@ -26,7 +28,10 @@
 
 #include <luci_compute/FullyConnected.h>
 
+#include <algorithm>
 #include <cassert>
+#include <stdexcept>
+#include <vector>
 
 namespace luci
 {
@@ -140,23 +145,57 @@ bool fold_fully_connected(luci::CircleFullyConnected *node)
     constant->name(node->name());
   }
   auto constant_data = &constant->at<loco::DataType::FLOAT32>(0);
-  comp_fc.output(constant_data);
-  comp_fc.compute();
+
+  // Output units are split to threads, as batch size of constant input is usually small
+  const uint32_t num_units = weights->dim(0).value();
+  const uint32_t input_size = weights->dim(1).value();
+  const uint32_t batches = output_size / num_units;
+  const size_t grain = std::max<size_t>(1, ThreadPool::kElementGrain / (batches * input_size));
+
+  ThreadPool::shared().parallel_for(num_units, grain, [&](size_t begin, size_t end) {
+    if (begin == 0 and end == num_units)
+    {
+      comp_fc.output(constant_data);
+      comp_fc.compute();
+      return;
+    }
+
+    // Compute output[:, begin:end] with weights[begin:end, :] and bias[begin:end]
+    const uint32_t units = end - begin;
+    loco::TensorShape weights_shape{units, input_size};
+    loco::TensorShape bias_shape;
+    if (bias_data)
+      bias_shape = loco::TensorShape{units};
+
+    compute::FullyConnected part_fc{};
+    set_params(node, part_fc);
+    part_fc.input(static_shape(input), input_data);
+    part_fc.weights(weights_shape, weights_data + begin * input_size);
+    part_fc.bias(bias_shape, bias_data ? bias_data + begin : nullptr);
+    part_fc.keep_num_dims(false);
+    if (!part_fc.prepare())
+      throw std::runtime_error("FoldFullyConnectedPass failed to compute " + node->name());
+
+    std::vector<float> part_output(batches * units);
+    part_fc.output(part_output.data());
+    part_fc.compute();
+
+    for (uint32_t b = 0; b < batches; ++b)
+    {
+      std::copy(part_output.begin() + b * units, part_output.begin() + (b + 1) * units,
+                constant_data + b * num_units + begin);
+    }
+  });
 
   loco::replace(node).with(constant);
 
   return true;
 }
 
-} // namespace
-
-/**
- * Constant Folding for FullyConnected Op
- **/
-bool FoldFullyConnectedPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto fc = dynamic_cast<CircleFullyConnected *>(node);
 
@@ -167,6 +206,21 @@ bool FoldFullyConnectedPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+/**
+ * Constant Folding for FullyConnected Op
+ **/
+bool FoldFullyConnectedPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldFullyConnectedPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
 
 #undef RETURN_FALSE_UNLESS
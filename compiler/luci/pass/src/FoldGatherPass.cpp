@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldGatherPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -158,18 +160,10 @@ bool fold_gather(luci::CircleGather *gather_node)
   }
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for Gather Op
- **/
-bool FoldGatherPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto gather_node = dynamic_cast<luci::CircleGather *>(node))
     {
@@ -181,4 +175,22 @@ bool FoldGatherPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for Gather Op
+ **/
+bool FoldGatherPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldGatherPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldMulPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 #include <algorithm>
@@ -101,18 +103,10 @@ bool fold_mul(luci::CircleMul *mul)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for Mul Op
- **/
-bool FoldMulPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto mul = dynamic_cast<luci::CircleMul *>(node))
     {
@@ -124,4 +118,22 @@ bool FoldMulPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for Mul Op
+ **/
+bool FoldMulPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldMulPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldReshapePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -100,18 +102,10 @@ bool fold_reshape(luci::CircleReshape *reshape)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for Reshape Op
- **/
-bool FoldReshapePass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto reshape = dynamic_cast<luci::CircleReshape *>(node))
     {
@@ -123,4 +117,22 @@ bool FoldReshapePass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for Reshape Op
+ **/
+bool FoldReshapePass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldReshapePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
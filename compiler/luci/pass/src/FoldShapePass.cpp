@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldShapePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -67,6 +69,33 @@ template <loco::DataType OutType> bool fold_shape(luci::CircleShape *shape)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+  for (auto node : nodes)
+  {
+    if (auto shape = dynamic_cast<luci::CircleShape *>(node))
+    {
+      auto out_type = shape->out_type();
+      switch (out_type)
+      {
+        case loco::DataType::S32:
+          if (fold_shape<loco::DataType::S32>(shape))
+            changed = true;
+          break;
+        case loco::DataType::S64:
+          if (fold_shape<loco::DataType::S64>(shape))
+            changed = true;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -90,29 +119,12 @@ namespace luci
  */
 bool FoldShapePass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto shape = dynamic_cast<luci::CircleShape *>(node))
-    {
-      auto out_type = shape->out_type();
-      switch (out_type)
-      {
-        case loco::DataType::S32:
-          if (fold_shape<loco::DataType::S32>(shape))
-            changed = true;
-          break;
-        case loco::DataType::S64:
-          if (fold_shape<loco::DataType::S64>(shape))
-            changed = true;
-          break;
-        default:
-          break;
-      }
-    }
-  }
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
 
-  return changed;
+bool FoldShapePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
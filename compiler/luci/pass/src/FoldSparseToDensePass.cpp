@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldSparseToDensePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 #include <limits>
@@ -115,18 +117,10 @@ bool fold_sparse_to_dense(luci::CircleSparseToDense *stod)
   return false;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for SparseToDense Op
- **/
-bool FoldSparseToDensePass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto stod = dynamic_cast<luci::CircleSparseToDense *>(node))
     {
@@ -138,4 +132,22 @@ bool FoldSparseToDensePass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for SparseToDense Op
+ **/
+bool FoldSparseToDensePass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldSparseToDensePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FoldSqueezePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -95,18 +97,10 @@ bool fold_squeeze(luci::CircleSqueeze *squeeze)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-/**
- * Constant Folding for Squeeze Op
- **/
-bool FoldSqueezePass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto squeeze = dynamic_cast<luci::CircleSqueeze *>(node))
     {
@@ -118,4 +112,22 @@ bool FoldSqueezePass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+/**
+ * Constant Folding for Squeeze Op
+ **/
+bool FoldSqueezePass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FoldSqueezePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseActivationFunctionPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeMixins.h>
 #include <luci/IR/CircleOpcode.h>
@@ -89,10 +91,13 @@ bool fuse_activation_function(luci::CircleNode *node)
   return true;
 }
 
-bool FuseActivationFunctionPass::run(loco::Graph *g)
+namespace
+{
+
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto circle_node = static_cast<luci::CircleNode *>(node);
     auto opcode = circle_node->opcode();
@@ -108,4 +113,16 @@ bool FuseActivationFunctionPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+bool FuseActivationFunctionPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseActivationFunctionPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
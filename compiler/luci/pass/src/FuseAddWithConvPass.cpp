@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseAddWithConvPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -138,15 +139,10 @@ bool fused_add_with_conv(luci::CircleAdd *add)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseAddWithConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto add = dynamic_cast<luci::CircleAdd *>(node))
     {
@@ -158,4 +154,19 @@ bool FuseAddWithConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseAddWithConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseAddWithConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseAddWithFullyConnectedPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Service/Nodes/CircleConst.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -304,15 +306,10 @@ bool fuse_add_with_s16_fc(luci::CircleFullyConnected *fc)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseAddWithFullyConnectedPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto fc = dynamic_cast<luci::CircleFullyConnected *>(node);
     if (not fc)
@@ -336,4 +333,20 @@ bool FuseAddWithFullyConnectedPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseAddWithFullyConnectedPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseAddWithFullyConnectedPass::run(loco::Graph *,
+                                        const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
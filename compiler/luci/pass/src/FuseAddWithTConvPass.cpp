@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseAddWithTConvPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -122,15 +123,10 @@ bool fuse_add_with_tconv(luci::CircleAdd *add)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseAddWithTConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto add = dynamic_cast<luci::CircleAdd *>(node))
       if (fuse_add_with_tconv(add))
@@ -140,4 +136,19 @@ bool FuseAddWithTConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseAddWithTConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseAddWithTConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
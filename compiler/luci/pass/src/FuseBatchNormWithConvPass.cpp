@@ -16,6 +16,7 @@
 
 #include "luci/Pass/FuseBatchNormWithConvPass.h"
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -173,15 +174,10 @@ bool fused_batch_norm_with_conv(luci::CircleAdd *add)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseBatchNormWithConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto add = dynamic_cast<luci::CircleAdd *>(node))
     {
@@ -193,4 +189,19 @@ bool FuseBatchNormWithConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseBatchNormWithConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseBatchNormWithConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseBatchNormWithDwConvPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -218,15 +219,10 @@ bool fused_batch_norm_with_dwconv(luci::CircleAdd *add)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseBatchNormWithDwConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto add = dynamic_cast<luci::CircleAdd *>(node))
     {
@@ -238,4 +234,19 @@ bool FuseBatchNormWithDwConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseBatchNormWithDwConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseBatchNormWithDwConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
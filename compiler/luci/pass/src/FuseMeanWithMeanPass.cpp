@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseMeanWithMeanPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNode.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -148,15 +150,10 @@ bool fuse_mean_with_mean(luci::CircleMean *mean)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseMeanWithMeanPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto mean = dynamic_cast<luci::CircleMean *>(node);
     if (not mean)
@@ -169,4 +166,19 @@ bool FuseMeanWithMeanPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseMeanWithMeanPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseMeanWithMeanPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -20,6 +20,7 @@
 #include <luci/Profile/CircleNodeOrigin.h>
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #define CHECK_OR_FALSE(condition) \
   if (not(condition))             \
@@ -96,15 +97,10 @@ bool fuse_fc_with_mul(luci::CircleFullyConnected *fc)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseMulToFullyConnectedWeightsPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto fc = dynamic_cast<luci::CircleFullyConnected *>(node);
     if (not fc)
@@ -117,4 +113,20 @@ bool FuseMulToFullyConnectedWeightsPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseMulToFullyConnectedWeightsPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseMulToFullyConnectedWeightsPass::run(loco::Graph *,
+                                             const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseMulWithConvPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -184,15 +185,10 @@ bool fuse_mul_with_conv(luci::CircleMul *mul)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseMulWithConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto mul = dynamic_cast<luci::CircleMul *>(node);
     if (not mul)
@@ -205,4 +201,19 @@ bool FuseMulWithConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseMulWithConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseMulWithConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseMulWithDivPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/IR/CircleNodes.h>
@@ -222,12 +223,10 @@ bool fuse_mul_with_div_to_mul(luci::CircleDiv *div)
   return true;
 }
 
-} // namespace
-
-bool FuseMulWithDivPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto div = dynamic_cast<luci::CircleDiv *>(node);
     if (not div)
@@ -243,4 +242,16 @@ bool FuseMulWithDivPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+bool FuseMulWithDivPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseMulWithDivPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
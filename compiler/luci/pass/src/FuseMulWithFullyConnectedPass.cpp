@@ -17,6 +17,7 @@
 #include "luci/Pass/FuseMulWithFullyConnectedPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -233,15 +234,10 @@ bool fuse_mul_with_fc(luci::CircleMul *mul)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseMulWithFullyConnectedPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto mul = dynamic_cast<luci::CircleMul *>(node))
     {
@@ -253,4 +249,20 @@ bool FuseMulWithFullyConnectedPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseMulWithFullyConnectedPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseMulWithFullyConnectedPass::run(loco::Graph *,
+                                        const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseSliceWithTConvPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/CircleNodeClone.h>
@@ -264,15 +266,10 @@ bool fuse_slice_with_tconv(luci::CircleSlice *slice)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseSliceWithTConvPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto slice = dynamic_cast<luci::CircleSlice *>(node);
     if (not slice)
@@ -285,4 +282,19 @@ bool FuseSliceWithTConvPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseSliceWithTConvPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseSliceWithTConvPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
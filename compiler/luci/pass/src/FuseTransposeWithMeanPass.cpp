@@ -16,6 +16,8 @@
 
 #include "luci/Pass/FuseTransposeWithMeanPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNode.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 #include <luci/Service/Nodes/CircleConst.h>
@@ -140,15 +142,10 @@ bool fuse_transpose_with_mean(luci::CircleMean *mean)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool FuseTransposeWithMeanPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto mean = dynamic_cast<luci::CircleMean *>(node);
     if (not mean)
@@ -161,4 +158,19 @@ bool FuseTransposeWithMeanPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool FuseTransposeWithMeanPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool FuseTransposeWithMeanPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
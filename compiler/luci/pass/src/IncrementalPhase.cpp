@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IncrementalPhase.h"
+
+#include <luci/CircleNodeSummaryBuilder.h>
+#include <luci/IncrementalPass.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <logo/Pass.h>
+#include <logo/RemoveDeadNodeWithQueryPass.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+
+void hash_combine(size_t &seed, size_t value)
+{
+  seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+void hash_combine(size_t &seed, const std::string &value)
+{
+  hash_combine(seed, std::hash<std::string>()(value));
+}
+
+// Symbol table to build node summary without node names, as arguments are hashed as pointers
+struct NoNameSymbolTable final : public locop::SymbolTable
+{
+  std::string lookup(const loco::Node *) const final { return ""; }
+};
+
+// Return a value which changes when the node is replaced, rewired, inferenced again or
+// its attributes are changed. Constant values are not hashed, as they can be large.
+// In-place changes of them are tracked by 'version', the number of notified updates.
+size_t signature(loco::Node *node, uint32_t version)
+{
+  size_t seed = std::hash<const void *>()(node->dialect());
+  hash_combine(seed, node->opnum());
+  hash_combine(seed, version);
+
+  hash_combine(seed, node->arity());
+  for (uint32_t i = 0; i < node->arity(); ++i)
+    hash_combine(seed, std::hash<const void *>()(node->arg(i)));
+
+  auto circle_node = dynamic_cast<luci::CircleNode *>(node);
+  if (circle_node == nullptr)
+    return seed;
+
+  hash_combine(seed, static_cast<size_t>(circle_node->dtype()));
+  hash_combine(seed, static_cast<size_t>(circle_node->shape_status()));
+  hash_combine(seed, circle_node->rank());
+  for (uint32_t i = 0; i < circle_node->rank(); ++i)
+  {
+    const auto &dim = circle_node->dim(i);
+    hash_combine(seed, dim.known() ? dim.value() + 1 : 0);
+  }
+
+  // Attributes
+  NoNameSymbolTable tbl;
+  locop::NodeSummary summary;
+  luci::CircleNodeSummaryBuilder builder;
+  if (builder.build(node, &tbl, summary))
+  {
+    for (uint32_t i = 0; i < summary.args().count(); ++i)
+    {
+      hash_combine(seed, summary.args().at(i).first);
+      hash_combine(seed, summary.args().at(i).second);
+    }
+    for (uint32_t i = 0; i < summary.comments().count(); ++i)
+      hash_combine(seed, summary.comments().at(i));
+  }
+
+  return seed;
+}
+
+} // namespace
+
+namespace luci
+{
+
+/**
+ * @brief Collect node edits of the graph while it is alive
+ *
+ * @note  Edits are forwarded to the observer attached before, if any
+ */
+class IncrementalPhaseRunner::EditCollector final : public loco::GraphObserver
+{
+public:
+  EditCollector(loco::Graph *graph) : _graph{graph}, _prev{graph->observer()}
+  {
+    _graph->observer(this);
+  }
+
+  ~EditCollector() { _graph->observer(_prev); }
+
+public:
+  void onCreate(loco::Node *node) final
+  {
+    _destroyed.erase(node);
+    _touched.insert(node);
+
+    if (_prev != nullptr)
+      _prev->onCreate(node);
+  }
+
+  void onDestroy(loco::Node *node) final
+  {
+    // Arguments lose a user
+    for (uint32_t i = 0; i < node->arity(); ++i)
+      touch(node->arg(i));
+
+    _touched.erase(node);
+    _destroyed.insert(node);
+
+    if (_prev != nullptr)
+      _prev->onDestroy(node);
+  }
+
+  void onArgChange(loco::Node *user, loco::Node *prev, loco::Node *curr) final
+  {
+    touch(user);
+    touch(prev);
+    touch(curr);
+
+    if (_prev != nullptr)
+      _prev->onArgChange(user, prev, curr);
+  }
+
+  void onUpdate(loco::Node *node) final
+  {
+    touch(node);
+    _updated.push_back(node);
+
+    if (_prev != nullptr)
+      _prev->onUpdate(node);
+  }
+
+public:
+  const std::unordered_set<loco::Node *> &touched(void) const { return _touched; }
+  const std::unordered_set<loco::Node *> &destroyed(void) const { return _destroyed; }
+  const std::vector<loco::Node *> &updated(void) const { return _updated; }
+
+private:
+  void touch(loco::Node *node)
+  {
+    if (node != nullptr)
+      _touched.insert(node);
+  }
+
+private:
+  loco::Graph *_graph;
+  loco::GraphObserver *_prev;
+  std::unordered_set<loco::Node *> _touched;
+  std::unordered_set<loco::Node *> _destroyed;
+  std::vector<loco::Node *> _updated;
+};
+
+void IncrementalPhaseRunner::run(const logo::Phase &phase)
+{
+  notifyPhaseBegin();
+
+  _versions.clear();
+  _signatures.clear();
+  for (auto node : loco::all_nodes(_graph))
+    _signatures[node] = signature(node, 0);
+
+  _edit_log.clear();
+  _log_base = 0;
+  _destroyed.clear();
+
+  _pass_positions.assign(phase.size(), 0);
+  _ran.assign(phase.size(), false);
+  _ran_incrementally.assign(phase.size(), false);
+
+  // IncrementalPass(es) may run incrementally only after RemoveDeadNodeWithQueryPass, where
+  // the graph has no dead node
+  _incremental.assign(phase.size(), false);
+  bool dead_node_free = false;
+  for (size_t i = 0; i < phase.size(); ++i)
+  {
+    auto pass = phase[i].get();
+    if (dead_node_free and dynamic_cast<luci::IncrementalPass *>(pass) != nullptr)
+      _incremental[i] = true;
+    if (dynamic_cast<logo::RemoveDeadNodeWithQueryPass *>(pass) != nullptr)
+      dead_node_free = true;
+  }
+
+  _stats.clear();
+  _stats.resize(phase.size());
+  for (size_t i = 0; i < phase.size(); ++i)
+    _stats[i].name = logo::pass_name(phase[i].get());
+
+  for (bool changed = true; changed;)
+  {
+    changed = false;
+
+    for (size_t i = 0; i < phase.size(); ++i)
+    {
+      if (run_pass(i, phase[i].get(), false))
+      {
+        changed = true;
+        break;
+      }
+    }
+
+    if (changed)
+      continue;
+
+    // Confirm the fixed point by running incrementally run passes for the whole graph
+    for (size_t i = 0; i < phase.size(); ++i)
+    {
+      if (not _ran_incrementally[i])
+        continue;
+
+      if (run_pass(i, phase[i].get(), true))
+      {
+        changed = true;
+        break;
+      }
+    }
+  }
+
+  notifyPhaseEnd();
+
+  report();
+}
+
+bool IncrementalPhaseRunner::run_pass(size_t index, logo::Pass *pass, bool whole_graph)
+{
+  auto &stat = _stats.at(index);
+
+  notifyPassBegin(pass);
+
+  const auto begin = std::chrono::steady_clock::now();
+  // Edits of this run are also dirty for the next run of this pass
+  const auto position = _log_base + _edit_log.size();
+
+  bool changed = false;
+  {
+    EditCollector collector{_graph};
+
+    if (_incremental[index] and _ran[index] and not whole_graph)
+    {
+      auto incremental_pass = dynamic_cast<luci::IncrementalPass *>(pass);
+      auto dirty = dirty_nodes(index);
+      if (not dirty.empty())
+        changed = incremental_pass->run(_graph, dirty);
+
+      _ran_incrementally[index] = true;
+      stat.incremental_runs++;
+    }
+    else
+    {
+      changed = pass->run(_graph);
+      _ran_incrementally[index] = false;
+    }
+
+    if (changed)
+      record_edits(collector);
+  }
+
+  stat.elapsed += std::chrono::steady_clock::now() - begin;
+  stat.runs++;
+  if (changed)
+    stat.changes++;
+
+  notifyPassEnd(pass, changed);
+
+  _pass_positions[index] = position;
+  _ran[index] = true;
+
+  trim_edit_log();
+
+  return changed;
+}
+
+std::unordered_set<loco::Node *> IncrementalPhaseRunner::dirty_nodes(size_t index) const
+{
+  std::unordered_set<loco::Node *> dirty;
+
+  assert(_pass_positions[index] >= _log_base);
+  for (size_t i = _pass_positions[index] - _log_base; i < _edit_log.size(); ++i)
+  {
+    auto node = _edit_log[i];
+    if (_destroyed.find(node) == _destroyed.end())
+      dirty.insert(node);
+  }
+
+  return dirty;
+}
+
+void IncrementalPhaseRunner::record_edits(EditCollector &collector)
+{
+  for (auto node : collector.updated())
+    _versions[node]++;
+
+  for (auto node : collector.destroyed())
+  {
+    _destroyed.insert(node);
+    _signatures.erase(node);
+    _versions.erase(node);
+  }
+
+  std::unordered_set<loco::Node *> dirty;
+
+  if (collector.touched().empty())
+  {
+    // The pass reported a change without any notification. Find the changed nodes.
+    const auto nodes = loco::all_nodes(_graph);
+    for (auto node : nodes)
+    {
+      const auto sig = signature(node, version(node));
+      auto iter = _signatures.find(node);
+      if (iter == _signatures.end() or iter->second != sig)
+      {
+        _signatures[node] = sig;
+        dirty.insert(node);
+      }
+    }
+
+    // Nothing but constant values may be changed, which are not in the signature
+    if (dirty.empty())
+      dirty.insert(nodes.begin(), nodes.end());
+  }
+  else
+  {
+    for (auto node : collector.touched())
+    {
+      _destroyed.erase(node);
+      dirty.insert(node);
+      for (uint32_t i = 0; i < node->arity(); ++i)
+      {
+        if (node->arg(i) != nullptr)
+          dirty.insert(node->arg(i));
+      }
+    }
+
+    for (auto node : dirty)
+      _signatures[node] = signature(node, version(node));
+  }
+
+  _edit_log.insert(_edit_log.end(), dirty.begin(), dirty.end());
+}
+
+uint32_t IncrementalPhaseRunner::version(loco::Node *node) const
+{
+  auto iter = _versions.find(node);
+  return iter == _versions.end() ? 0 : iter->second;
+}
+
+void IncrementalPhaseRunner::trim_edit_log(void)
+{
+  // Drop the edits already seen by all the passes which may run incrementally
+  auto min_position = _log_base + _edit_log.size();
+  for (size_t i = 0; i < _pass_positions.size(); ++i)
+  {
+    if (_incremental[i] and _ran[i])
+      min_position = std::min(min_position, _pass_positions[i]);
+  }
+
+  const auto count = min_position - _log_base;
+  if (count == 0)
+    return;
+
+  _edit_log.erase(_edit_log.begin(), _edit_log.begin() + count);
+  _log_base = min_position;
+}
+
+void IncrementalPhaseRunner::report(void) const
+{
+  LOGGER(l);
+
+  INFO(l) << "IncrementalPhaseRunner statistics (runs / changes / incremental runs / ms)";
+  for (const auto &stat : _stats)
+  {
+    const auto ms = std::chrono::duration_cast<std::chrono::microseconds>(stat.elapsed).count();
+    INFO(l) << "  " << stat.name << " : " << stat.runs << " / " << stat.changes << " / "
+            << stat.incremental_runs << " / " << ms / 1000.0;
+  }
+}
+
+} // namespace luci
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INCREMENTAL_PHASE_H__
+#define __LUCI_INCREMENTAL_PHASE_H__
+
+#include <logo/Phase.h>
+
+#include <loco.h>
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief Run passes of a phase like logo::PhaseRunner<logo::PhaseStrategy::Restart>, while
+ *        luci::IncrementalPass(es) are run only for the nodes touched since their last run
+ *
+ * @note  Node edits are collected through loco::GraphObserver while a pass runs. A node is dirty
+ *        when it is created, rewired, or notified by loco::notify_update(), and the arguments of
+ *        a dirty node are also dirty to cover in-place changes of constants or attributes next to
+ *        it. When a pass reports a change without any edit notified, nodes are compared with
+ *        their signature (operator, arguments, dtype, shape, attributes and the number of
+ *        notified updates) instead. Constant values are not compared, so all nodes are dirty
+ *        when no node is found changed.
+ *        IncrementalPass(es) are run incrementally only after logo::RemoveDeadNodeWithQueryPass
+ *        in the phase, where the graph has no dead node. To reach the same fixed point as Restart
+ *        strategy for edits out of the dirty nodes, IncrementalPass(es) are run once more for the
+ *        whole graph when no pass makes a change.
+ */
+class IncrementalPhaseRunner final : public logo::PhaseRunnerMixinObservable
+{
+public:
+  struct PassStat
+  {
+    std::string name;
+    // Number of runs and the number of runs which made a change
+    uint32_t runs = 0;
+    uint32_t changes = 0;
+    // Number of runs only for the dirty nodes
+    uint32_t incremental_runs = 0;
+    std::chrono::nanoseconds elapsed{0};
+  };
+
+public:
+  IncrementalPhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const logo::Phase &);
+
+  const std::vector<PassStat> &stats(void) const { return _stats; }
+
+private:
+  class EditCollector;
+
+  bool run_pass(size_t index, logo::Pass *pass, bool whole_graph);
+  std::unordered_set<loco::Node *> dirty_nodes(size_t index) const;
+  void record_edits(EditCollector &collector);
+  uint32_t version(loco::Node *node) const;
+  void trim_edit_log(void);
+  void report(void) const;
+
+private:
+  loco::Graph *_graph;
+
+  // Signature of each node, to find the nodes changed without any notification
+  std::unordered_map<loco::Node *, size_t> _signatures;
+  // Number of loco::notify_update() of each node, e.g. for in-place changes of constant values
+  std::unordered_map<loco::Node *, uint32_t> _versions;
+
+  // Dirty nodes in the order of the edits. _log_base is the position of _edit_log.front().
+  std::vector<loco::Node *> _edit_log;
+  size_t _log_base = 0;
+  // Nodes destroyed, which may be still in _edit_log
+  std::unordered_set<loco::Node *> _destroyed;
+
+  // Position in the edit log at the beginning of the last run of each pass
+  std::vector<size_t> _pass_positions;
+  std::vector<bool> _ran;
+  std::vector<bool> _ran_incrementally;
+  // True for the passes which may run incrementally
+  std::vector<bool> _incremental;
+
+  std::vector<PassStat> _stats;
+};
+
+} // namespace luci
+
+#endif // __LUCI_INCREMENTAL_PHASE_H__
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IncrementalPhase.h"
+
+#include "luci/IncrementalPass.h"
+#include "luci/Pass/CircleShapeInferencePass.h"
+#include "luci/Pass/CircleTypeInferencePass.h"
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <logo/RemoveDeadNodeWithQueryPass.h>
+
+#include <loco.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ *  Insert one more Relu after the Relu connected to the output, only once
+ *
+ *  BEFORE
+ *    [Input] --- [Relu] --- [Output]
+ *
+ *  AFTER
+ *    [Input] --- [Relu] --- [Relu] --- [Output]
+ */
+class InsertReluOncePass final : public logo::Pass
+{
+public:
+  const char *name(void) const final { return "InsertReluOncePass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    if (_done)
+      return false;
+
+    auto output = loco::must_cast<luci::CircleOutput *>(loco::output_nodes(g).at(0));
+    auto relu = g->nodes()->create<luci::CircleRelu>();
+    relu->features(output->from());
+    output->from(relu);
+
+    _done = true;
+    return true;
+  }
+
+private:
+  bool _done = false;
+};
+
+/**
+ *  Insert Add before the Relu connected to the output, only once
+ *
+ *  BEFORE
+ *    [Input] --- [Relu] --- [Output]
+ *
+ *  AFTER
+ *    [Input] --- [Add] --- [Relu] --- [Output]
+ */
+class InsertAddOncePass final : public logo::Pass
+{
+public:
+  const char *name(void) const final { return "InsertAddOncePass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    if (_done)
+      return false;
+
+    auto output = loco::must_cast<luci::CircleOutput *>(loco::output_nodes(g).at(0));
+    auto relu = loco::must_cast<luci::CircleRelu *>(output->from());
+    auto add = g->nodes()->create<luci::CircleAdd>();
+    add->x(relu->features());
+    add->y(relu->features());
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    relu->features(add);
+
+    _done = true;
+    return true;
+  }
+
+private:
+  bool _done = false;
+};
+
+/**
+ *  Change the shape of Input in place, only once, without loco::notify_update()
+ */
+class ChangeInputShapeOncePass final : public logo::Pass
+{
+public:
+  const char *name(void) const final { return "ChangeInputShapeOncePass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    if (_done)
+      return false;
+
+    auto input = loco::must_cast<luci::CircleInput *>(loco::input_nodes(g).at(0));
+    input->dim(3) = 5;
+
+    _done = true;
+    return true;
+  }
+
+private:
+  bool _done = false;
+};
+
+/**
+ *  Change the value of CircleConst in place, only once, without loco::notify_update()
+ */
+class ChangeConstOncePass final : public logo::Pass
+{
+public:
+  const char *name(void) const final { return "ChangeConstOncePass"; }
+
+  bool run(loco::Graph *g) final
+  {
+    if (_done)
+      return false;
+
+    for (auto node : loco::all_nodes(g))
+    {
+      if (auto const_node = dynamic_cast<luci::CircleConst *>(node))
+      {
+        const_node->at<loco::DataType::FLOAT32>(0) = 2.0f;
+        _done = true;
+      }
+    }
+    return _done;
+  }
+
+private:
+  bool _done = false;
+};
+
+/**
+ *  Collect the dirty nodes given to incremental runs
+ */
+class CollectDirtyPass final : public logo::Pass, public luci::IncrementalPass
+{
+public:
+  const char *name(void) const final { return "CollectDirtyPass"; }
+
+  bool run(loco::Graph *) final { return false; }
+
+  bool run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty) final
+  {
+    collected.insert(dirty.begin(), dirty.end());
+    return false;
+  }
+
+public:
+  std::unordered_set<loco::Node *> collected;
+};
+
+class IncrementalPhaseTestGraph
+{
+public:
+  void init(void)
+  {
+    _g = loco::make_graph();
+
+    _input = _g->nodes()->create<luci::CircleInput>();
+    _input->dtype(loco::DataType::FLOAT32);
+    _input->shape({1, 4, 4, 3});
+    _input->shape_status(luci::ShapeStatus::VALID);
+    auto graph_input = _g->inputs()->create();
+    _input->index(graph_input->index());
+
+    _relu = _g->nodes()->create<luci::CircleRelu>();
+    _relu->features(_input);
+
+    _output = _g->nodes()->create<luci::CircleOutput>();
+    _output->from(_relu);
+    auto graph_output = _g->outputs()->create();
+    graph_output->dtype(loco::DataType::FLOAT32);
+    _output->index(graph_output->index());
+  }
+
+public:
+  std::unique_ptr<loco::Graph> _g;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleRelu *_relu = nullptr;
+  luci::CircleOutput *_output = nullptr;
+};
+
+} // namespace
+
+TEST(IncrementalPhaseTest, same_as_restart)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<InsertReluOncePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  auto relu = loco::must_cast<luci::CircleRelu *>(g._output->from());
+  ASSERT_NE(g._relu, relu);
+  EXPECT_EQ(loco::DataType::FLOAT32, relu->dtype());
+  EXPECT_EQ(luci::ShapeStatus::VALID, relu->shape_status());
+  ASSERT_EQ(4, relu->rank());
+  EXPECT_EQ(3, relu->dim(3).value());
+
+  const auto &stats = phase_runner.stats();
+  ASSERT_EQ(4, stats.size());
+  EXPECT_STREQ("luci::CircleShapeInferencePass", stats[2].name.c_str());
+  EXPECT_LT(0, stats[2].incremental_runs);
+  EXPECT_EQ(1, stats[3].changes);
+  EXPECT_EQ(nullptr, g._g->observer());
+}
+
+TEST(IncrementalPhaseTest, fuse_incrementally)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::FuseActivationFunctionPass>());
+  phase.emplace_back(std::make_unique<InsertAddOncePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  // Relu is fused to Add inserted after the first run of FuseActivationFunctionPass
+  auto add = dynamic_cast<luci::CircleAdd *>(g._output->from());
+  ASSERT_NE(nullptr, add);
+  EXPECT_EQ(luci::FusedActFunc::RELU, add->fusedActivationFunction());
+  EXPECT_EQ(luci::ShapeStatus::VALID, add->shape_status());
+
+  const auto &stats = phase_runner.stats();
+  ASSERT_EQ(5, stats.size());
+  EXPECT_LT(0, stats[3].incremental_runs);
+  EXPECT_EQ(1, stats[3].changes);
+}
+
+TEST(IncrementalPhaseTest, change_without_notification)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<ChangeInputShapeOncePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  ASSERT_EQ(4, g._relu->rank());
+  EXPECT_EQ(5, g._relu->dim(3).value());
+  EXPECT_LT(0, phase_runner.stats()[1].incremental_runs);
+}
+
+TEST(IncrementalPhaseTest, change_const_without_notification)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  auto const_node = g._g->nodes()->create<luci::CircleConst>();
+  const_node->dtype(loco::DataType::FLOAT32);
+  const_node->shape({1});
+  const_node->size<loco::DataType::FLOAT32>(1);
+  const_node->at<loco::DataType::FLOAT32>(0) = 1.0f;
+  auto add = g._g->nodes()->create<luci::CircleAdd>();
+  add->x(g._input);
+  add->y(const_node);
+  add->fusedActivationFunction(luci::FusedActFunc::NONE);
+  g._relu->features(add);
+
+  auto collect = std::make_unique<CollectDirtyPass>();
+  auto collect_pass = collect.get();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  phase.emplace_back(std::move(collect));
+  phase.emplace_back(std::make_unique<ChangeConstOncePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  // Constant values are not in the signature, so all nodes are dirty
+  EXPECT_LT(0, phase_runner.stats()[1].incremental_runs);
+  EXPECT_NE(collect_pass->collected.end(), collect_pass->collected.find(const_node));
+  EXPECT_NE(collect_pass->collected.end(), collect_pass->collected.find(add));
+}
+
+TEST(IncrementalPhaseTest, no_dead_node_pass_NEG)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<InsertReluOncePass>());
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  // IncrementalPass(es) run for the whole graph as the graph may have dead nodes
+  for (const auto &stat : phase_runner.stats())
+    EXPECT_EQ(0, stat.incremental_runs);
+}
+
+TEST(IncrementalPhaseTest, empty_phase)
+{
+  IncrementalPhaseTestGraph g;
+  g.init();
+
+  logo::Phase phase;
+
+  luci::IncrementalPhaseRunner phase_runner{g._g.get()};
+  phase_runner.run(phase);
+
+  EXPECT_TRUE(phase_runner.stats().empty());
+}
@@ -15,12 +15,54 @@
  */
 
 #include "QuantizationUtils.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/Log.h>
 
 #include <iostream>
 #include <cmath>
 #include <limits>
+#include <mutex>
+
+namespace
+{
+
+uint32_t num_elements(const loco::TensorShape &dimension)
+{
+  uint32_t size = 1;
+  for (uint32_t i = 0; i < dimension.rank(); ++i)
+    size *= dimension.dim(i).value();
+  return size;
+}
+
+// Call func for elements of [begin, end) in row-major order of 4D dimension
+void iterate_range(loco::TensorShape dimension, int32_t channel_dim_index, size_t begin,
+                   size_t end, const luci::IterFunc &func)
+{
+  assert(dimension.rank() == 4);
+
+  uint32_t indices[4];
+  size_t rest = begin;
+  for (int32_t i = 3; i >= 0; --i)
+  {
+    indices[i] = rest % dimension.dim(i).value();
+    rest /= dimension.dim(i).value();
+  }
+
+  for (size_t n = begin; n < end; ++n)
+  {
+    func(indices, dimension, channel_dim_index);
+
+    for (int32_t i = 3; i >= 0; --i)
+    {
+      if (++indices[i] < dimension.dim(i).value())
+        break;
+      indices[i] = 0;
+    }
+  }
+}
+
+} // namespace
 
 namespace luci
 {
@@ -618,6 +660,23 @@ void iterate_per_channel(CircleConst *node, IterFunc func)
   }
 }
 
+void parallel_iterate_per_channel(CircleConst *node, int32_t &channel_dim_index, IterFunc func)
+{
+  loco::TensorShape dimension;
+  dimension.rank(4);
+
+  if (!get_channel_dim_index(node, dimension, channel_dim_index))
+  {
+    assert(false);
+    return;
+  }
+
+  const int32_t channel_dim = channel_dim_index;
+  ThreadPool::shared().parallel_for(
+    num_elements(dimension), ThreadPool::kElementGrain,
+    [&](size_t begin, size_t end) { iterate_range(dimension, channel_dim, begin, end, func); });
+}
+
 void cal_minmax_per_channel(CircleConst *node, std::vector<float> &min, std::vector<float> &max,
                             int32_t &channel_dim_index)
 {
@@ -634,23 +693,55 @@ void cal_minmax_per_channel(CircleConst *node, std::vector<float> &min, std::vec
   min.resize(size);
   max.resize(size);
 
-  auto cal_minmax = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
-    int channel_idx = indices[channel_dim_index];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-    if (has_min_max_value[channel_idx])
-    {
-      min[channel_idx] = data < min[channel_idx] ? data : min[channel_idx];
-      max[channel_idx] = data > max[channel_idx] ? data : max[channel_idx];
-    }
-    else
-    {
-      min[channel_idx] = data;
-      max[channel_idx] = data;
-      has_min_max_value[channel_idx] = true;
-    }
-  };
+  const CircleConst *input = node;
+  const int32_t channel_dim = channel_dim_index;
+  std::mutex mutex;
+
+  // Each thread finds min/max of its range, which are merged at the end
+  ThreadPool::shared().parallel_for(
+    num_elements(dimension), ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+      std::vector<bool> local_has_value(size, false);
+      std::vector<float> local_min(size);
+      std::vector<float> local_max(size);
+
+      auto cal_minmax = [&](uint32_t *indices, loco::TensorShape &dimension,
+                            int channel_dim_index) {
+        int channel_idx = indices[channel_dim_index];
+        auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+        if (local_has_value[channel_idx])
+        {
+          local_min[channel_idx] = data < local_min[channel_idx] ? data : local_min[channel_idx];
+          local_max[channel_idx] = data > local_max[channel_idx] ? data : local_max[channel_idx];
+        }
+        else
+        {
+          local_min[channel_idx] = data;
+          local_max[channel_idx] = data;
+          local_has_value[channel_idx] = true;
+        }
+      };
 
-  iterate_per_channel(node, channel_dim_index, cal_minmax);
+      iterate_range(dimension, channel_dim, begin, end, cal_minmax);
+
+      std::lock_guard<std::mutex> lock(mutex);
+      for (uint32_t c = 0; c < size; ++c)
+      {
+        if (not local_has_value[c])
+          continue;
+
+        if (has_min_max_value[c])
+        {
+          min[c] = local_min[c] < min[c] ? local_min[c] : min[c];
+          max[c] = local_max[c] > max[c] ? local_max[c] : max[c];
+        }
+        else
+        {
+          min[c] = local_min[c];
+          max[c] = local_max[c];
+          has_min_max_value[c] = true;
+        }
+      }
+    });
 }
 
 void check_quant_unfriendly_values(const luci::CircleConst *node)
@@ -660,16 +751,20 @@ void check_quant_unfriendly_values(const luci::CircleConst *node)
   if (node->dtype() != loco::DataType::FLOAT32)
     return;
 
-  for (uint32_t i = 0; i < node->size<loco::DataType::FLOAT32>(); i++)
-  {
-    const auto val = node->at<loco::DataType::FLOAT32>(i);
+  ThreadPool::shared().parallel_for(
+    node->size<loco::DataType::FLOAT32>(), ThreadPool::kElementGrain,
+    [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; i++)
+      {
+        const auto val = node->at<loco::DataType::FLOAT32>(i);
 
-    if (val == std::numeric_limits<float>::lowest())
-      throw std::runtime_error(node->name() + " includes -inf");
+        if (val == std::numeric_limits<float>::lowest())
+          throw std::runtime_error(node->name() + " includes -inf");
 
-    if (val == std::numeric_limits<float>::max())
-      throw std::runtime_error(node->name() + " includes inf");
-  }
+        if (val == std::numeric_limits<float>::max())
+          throw std::runtime_error(node->name() + " includes inf");
+      }
+    });
 }
 
 } // namespace luci
@@ -113,6 +113,11 @@ using IterFunc = std::function<void(uint32_t *, loco::TensorShape &, int32_t)>;
 void iterate_per_channel(CircleConst *node, int32_t &channel_dim_index, IterFunc func);
 void iterate_per_channel(CircleConst *node, IterFunc func);
 
+// Same as iterate_per_channel, but func is called from multiple threads
+// NOTE func should read node only through const methods (to avoid copy-on-write of external
+//      data), and should write only what belongs to the element of given indices
+void parallel_iterate_per_channel(CircleConst *node, int32_t &channel_dim_index, IterFunc func);
+
 // Throw exception if constant node contains quantization-unfrinedly values
 void check_quant_unfriendly_values(const luci::CircleConst *node);
 
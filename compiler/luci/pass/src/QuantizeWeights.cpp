@@ -16,6 +16,7 @@
 
 #include "QuantizeWeights.h"
 #include "QuantizationUtils.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/Service/Nodes/CircleConst.h>
 #include <luci/Log.h>
@@ -30,6 +31,20 @@ using namespace luci;
 namespace
 {
 
+// Store quantized values to node as DT, clamping them to [min_value, max_value]
+template <loco::DataType DT>
+void store_quantized(CircleConst *node, const std::vector<int32_t> &values, int32_t min_value,
+                     int32_t max_value)
+{
+  node->dtype(DT);               // change the type of tensor
+  node->size<DT>(values.size()); // resize tensor
+  ThreadPool::shared().parallel_for(
+    values.size(), ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+        node->at<DT>(i) = std::min(max_value, std::max(min_value, values[i]));
+    });
+}
+
 void asym_wquant_per_channel(CircleConst *node, std::vector<float> &min,
                              std::vector<float> &scaling_factor, int32_t &channel_dim_index)
 {
@@ -41,22 +56,18 @@ void asym_wquant_per_channel(CircleConst *node, std::vector<float> &min,
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   std::vector<int32_t> quantized_values(size);
 
+  const CircleConst *input = node;
   auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int32_t channel_dim_index) {
     int channel_idx = indices[channel_dim_index];
     const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+    auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
     quantized_values[cal_offset(dimension, indices)] =
       static_cast<int32_t>(std::round((data - min[channel_idx]) * scaling_factor_inv));
   };
 
-  iterate_per_channel(node, channel_dim_index, quantize);
+  parallel_iterate_per_channel(node, channel_dim_index, quantize);
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  store_quantized<loco::DataType::U8>(node, quantized_values, kMinScale, kMaxScale);
 }
 
 // TODO Reduce duplicate code with QuantizeDequantizeWeights
@@ -76,25 +87,20 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
     compute_sym_scale(min[i], max[i], scaling_factor[i], nudged_min[i], nudged_max[i]);
   }
 
+  const CircleConst *input = node;
   auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
     int channel_idx = indices[channel_dim_index];
     const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+    auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
     data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
     data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
     quantized_values[cal_offset(dimension, indices)] =
       static_cast<int32_t>(std::round(data * scaling_factor_inv));
   };
 
-  iterate_per_channel(node, channel_dim_index, quantize);
+  parallel_iterate_per_channel(node, channel_dim_index, quantize);
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  store_quantized<loco::DataType::S16>(node, quantized_values, kMinScale, kMaxScale);
 }
 
 void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
@@ -115,24 +121,20 @@ void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
     compute_asym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
   }
 
+  const CircleConst *input = node;
   auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
     int channel_idx = indices[channel_dim_index];
     const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+    auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
     data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
     data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
     quantized_values[cal_offset(dimension, indices)] =
       static_cast<int32_t>(std::round((data - nudged_min[channel_idx]) * scaling_factor_inv));
   };
 
-  iterate_per_channel(node, channel_dim_index, quantize);
+  parallel_iterate_per_channel(node, channel_dim_index, quantize);
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  store_quantized<loco::DataType::U8>(node, quantized_values, kMinScale, kMaxScale);
 }
 
 void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
@@ -146,23 +148,18 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_facto
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   std::vector<int32_t> quantized_values(size);
 
+  const CircleConst *input = node;
   auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int32_t channel_dim_index) {
     int channel_idx = indices[channel_dim_index];
     const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+    auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
     quantized_values[cal_offset(dimension, indices)] =
       static_cast<int32_t>(std::round(data * scaling_factor_inv));
   };
 
-  iterate_per_channel(node, channel_dim_index, quantize);
+  parallel_iterate_per_channel(node, channel_dim_index, quantize);
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  store_quantized<loco::DataType::S16>(node, quantized_values, kMinScale, kMaxScale);
 }
 
 void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
@@ -174,18 +171,17 @@ void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
 
   const float scaling_factor_inv = 1.0 / scaling_factor;
   std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    quantized_values[i] = static_cast<int32_t>(std::round((data - min) * scaling_factor_inv));
-  }
+  const CircleConst *input = node;
+  ThreadPool::shared().parallel_for(
+    size, ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+      {
+        auto data = input->at<loco::DataType::FLOAT32>(i);
+        quantized_values[i] = static_cast<int32_t>(std::round((data - min) * scaling_factor_inv));
+      }
+    });
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  store_quantized<loco::DataType::U8>(node, quantized_values, kMinScale, kMaxScale);
 }
 
 // Quantize const per channel
@@ -385,6 +381,20 @@ void QuantizeWeights::quantize_weights(luci::CircleConst *weights)
     asym_wquant_per_layer(weights, min, scaling_factor);
   }
 }
+
+void QuantizeWeights::quantize_or_defer(luci::CircleConst *weights)
+{
+  if (deferred == nullptr)
+  {
+    quantize_weights(weights);
+    return;
+  }
+
+  // NOTE Cloned weights are owned by a node, so they can be quantized in parallel
+  QuantizeWeights qw(input_type, output_type, granularity);
+  deferred->emplace_back([qw, weights]() mutable { qw.quantize_weights(weights); });
+}
+
 void QuantizeWeights::visit(luci::CircleConv2D *node)
 {
   LOGGER(l);
@@ -395,7 +405,7 @@ void QuantizeWeights::visit(luci::CircleConv2D *node)
   {
     auto new_weights = luci::clone(weights);
     node->filter(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -409,7 +419,7 @@ void QuantizeWeights::visit(luci::CircleDepthwiseConv2D *node)
   {
     auto new_weights = luci::clone(weights);
     node->filter(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -491,7 +501,7 @@ void QuantizeWeights::visit(luci::CircleTransposeConv *node)
   {
     auto new_weights = luci::clone(weights);
     node->filter(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -505,7 +515,7 @@ void QuantizeWeights::visit(luci::CircleFullyConnected *node)
   {
     auto new_weights = luci::clone(weights);
     node->weights(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -20,26 +20,34 @@
 #include <luci/Pass/QuantizationParameters.h>
 #include <luci/IR/CircleNodeVisitor.h>
 
+#include <functional>
+#include <vector>
+
 namespace luci
 {
 
 /**
  * @brief QuantizeWeights quantizes tensors for weights
  * @details Find min/max values on the fly and then quantize
+ *          If 'deferred' is given, weights are cloned in visit() but quantization of them is
+ *          appended to 'deferred', so that the caller can run them for all nodes in parallel.
  */
 struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<void>
 {
-  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-    : input_type(input), output_type(output), granularity(gr)
+  QuantizeWeights(loco::DataType input, loco::DataType output, QuantizationGranularity gr,
+                  std::vector<std::function<void(void)>> *deferred = nullptr)
+    : input_type(input), output_type(output), granularity(gr), deferred(deferred)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
   QuantizationGranularity granularity;
+  std::vector<std::function<void(void)>> *deferred;
 
 private:
   void quantize_weights(luci::CircleConst *weights);
+  void quantize_or_defer(luci::CircleConst *weights);
 
   void visit(luci::CircleConv2D *node);
   void visit(luci::CircleDepthwiseConv2D *node);
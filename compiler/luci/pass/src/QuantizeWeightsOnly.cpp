@@ -16,11 +16,15 @@
 
 #include "QuantizeWeightsOnly.h"
 #include "QuantizationUtils.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/Service/Nodes/CircleConst.h>
 #include <luci/Log.h>
 
+#include <fp16.h>
+
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <limits>
 
@@ -50,35 +54,143 @@ void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vec
     compute_sym_scale(min[i], max[i], scaling_factor[i], nudged_min[i], nudged_max[i], out_type);
   }
 
+  const CircleConst *input = node;
   auto quantize = [&](uint32_t *indices, loco::TensorShape &dimension, int channel_dim_index) {
     int channel_idx = indices[channel_dim_index];
     const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-    auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
+    auto data = input->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
     data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
     data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
     quantized_values[cal_offset(dimension, indices)] =
       static_cast<int32_t>(std::round(data * scaling_factor_inv));
   };
 
-  iterate_per_channel(node, channel_dim_index, quantize);
+  parallel_iterate_per_channel(node, channel_dim_index, quantize);
 
   node->dtype(out_type);      // change the type of tensor
   node->size<out_type>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
+  ThreadPool::shared().parallel_for(
+    size, ThreadPool::kElementGrain, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+        node->at<out_type>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    });
+}
+
+// Number of elements in a block of GGML_Q4_0 and GGML_Q8_0
+constexpr uint32_t kBlockSize = 32;
+
+// NOTE Quantization of blocks follows the reference implementation of ggml
+//      Q8_0: x = q * d, q in [-127, 127]
+//      Q4_0: x = (q - 8) * d, q in [0, 15], element j and j + 16 share a byte (low, high nibble)
+void quantize_block_q8_0(const float *x, uint8_t *block)
+{
+  float amax = 0.0f;
+  for (uint32_t j = 0; j < kBlockSize; ++j)
+    amax = std::max(amax, std::fabs(x[j]));
+
+  const float d = amax / 127.0f;
+  const float id = d != 0.0f ? 1.0f / d : 0.0f;
+
+  const uint16_t d16 = fp16_ieee_from_fp32_value(d);
+  std::memcpy(block, &d16, sizeof(d16));
+  auto qs = reinterpret_cast<int8_t *>(block + sizeof(d16));
+  for (uint32_t j = 0; j < kBlockSize; ++j)
+    qs[j] = static_cast<int8_t>(std::round(x[j] * id));
+}
+
+void quantize_block_q4_0(const float *x, uint8_t *block)
+{
+  // value having the largest magnitude, with its sign
+  float amax = 0.0f;
+  float max = 0.0f;
+  for (uint32_t j = 0; j < kBlockSize; ++j)
+  {
+    if (amax < std::fabs(x[j]))
+    {
+      amax = std::fabs(x[j]);
+      max = x[j];
+    }
+  }
+
+  const float d = max / -8.0f;
+  const float id = d != 0.0f ? 1.0f / d : 0.0f;
+
+  const uint16_t d16 = fp16_ieee_from_fp32_value(d);
+  std::memcpy(block, &d16, sizeof(d16));
+  auto qs = block + sizeof(d16);
+  for (uint32_t j = 0; j < kBlockSize / 2; ++j)
   {
-    node->at<out_type>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    const auto q0 = std::min<int32_t>(15, static_cast<int8_t>(x[j] * id + 8.5f));
+    const auto q1 = std::min<int32_t>(15, static_cast<int8_t>(x[j + kBlockSize / 2] * id + 8.5f));
+    qs[j] = static_cast<uint8_t>(q0) | static_cast<uint8_t>(q1 << 4);
   }
 }
 
+// Quantize 'node' into blocks of out_type along the last dimension
+template <loco::DataType out_type> void sym_wquant_per_block(CircleConst *node)
+{
+  static_assert(out_type == loco::DataType::GGML_Q4_0 || out_type == loco::DataType::GGML_Q8_0,
+                "Block quantized type is required");
+  assert(node->dtype() == loco::DataType::FLOAT32);
+
+  constexpr uint32_t block_bytes =
+    sizeof(uint16_t) + (out_type == loco::DataType::GGML_Q4_0 ? kBlockSize / 2 : kBlockSize);
+
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  assert(size % kBlockSize == 0);
+  const uint32_t num_blocks = size / kBlockSize;
+
+  std::vector<uint8_t> blocks(num_blocks * block_bytes);
+  {
+    const luci::CircleConst *cnode = node;
+    const float *data = &cnode->at<loco::DataType::FLOAT32>(0);
+    ThreadPool::shared().parallel_for(
+      num_blocks, ThreadPool::kElementGrain / kBlockSize, [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b)
+        {
+          if (out_type == loco::DataType::GGML_Q4_0)
+            quantize_block_q4_0(data + b * kBlockSize, blocks.data() + b * block_bytes);
+          else
+            quantize_block_q8_0(data + b * kBlockSize, blocks.data() + b * block_bytes);
+        }
+      });
+  }
+
+  node->dtype(out_type); // change the type of tensor, shape is not changed
+  node->size<out_type>(blocks.size());
+  std::memcpy(&node->at<out_type>(0), blocks.data(), blocks.size());
+}
+
 } // namespace
 
 namespace luci
 {
 
+bool QuantizeWeightsOnly::block_quantizable(const luci::CircleConst *weights) const
+{
+  if (weights->dtype() != loco::DataType::FLOAT32)
+    return false;
+  if (weights->rank() != 2 || !weights->dim(1).known())
+    return false;
+  return weights->dim(1).value() % group_size == 0;
+}
+
 void QuantizeWeightsOnly::quantize_weights(luci::CircleConst *weights)
 {
   check_quant_unfriendly_values(weights);
 
+  if (granularity == QuantizationGranularity::GroupWise)
+  {
+    assert(group_size == kBlockSize);
+    if (output_type == loco::DataType::S4)
+      sym_wquant_per_block<loco::DataType::GGML_Q4_0>(weights);
+    else if (output_type == loco::DataType::S8)
+      sym_wquant_per_block<loco::DataType::GGML_Q8_0>(weights);
+    else
+      throw std::runtime_error("Group-wise quantization supports int4 and int8 only");
+    return;
+  }
+
   // Find min/max per channel-wise
   if (granularity == QuantizationGranularity::ChannelWise)
   {
@@ -132,17 +244,33 @@ void QuantizeWeightsOnly::quantize_weights(luci::CircleConst *weights)
     throw std::runtime_error("Weights-only quantization does not support layer-wise");
 }
 
+void QuantizeWeightsOnly::quantize_or_defer(luci::CircleConst *weights)
+{
+  if (deferred == nullptr)
+  {
+    quantize_weights(weights);
+    return;
+  }
+
+  QuantizeWeightsOnly qw(input_type, output_type, granularity, group_size);
+  deferred->emplace_back([qw, weights]() mutable { qw.quantize_weights(weights); });
+}
+
 void QuantizeWeightsOnly::visit(luci::CircleConv2D *node)
 {
   LOGGER(l);
   INFO(l) << "QuantizeWeightsOnly visits node: " << node->name() << std::endl;
 
+  // NOTE Block quantized convolution is not supported by the runtime
+  if (granularity == QuantizationGranularity::GroupWise)
+    return;
+
   auto weights = luci::must_cast<luci::CircleConst *>(node->filter());
   if (!is_quantized(weights))
   {
     auto new_weights = luci::clone(weights);
     node->filter(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -152,11 +280,16 @@ void QuantizeWeightsOnly::visit(luci::CircleFullyConnected *node)
   INFO(l) << "QuantizeWeightsOnly visit node: " << node->name() << std::endl;
 
   auto weights = luci::must_cast<luci::CircleConst *>(node->weights());
+  if (granularity == QuantizationGranularity::GroupWise && !block_quantizable(weights))
+  {
+    INFO(l) << "QuantizeWeightsOnly skips node: " << node->name() << std::endl;
+    return;
+  }
   if (!is_quantized(weights))
   {
     auto new_weights = luci::clone(weights);
     node->weights(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
@@ -165,15 +298,38 @@ void QuantizeWeightsOnly::visit(luci::CircleDepthwiseConv2D *node)
   LOGGER(l);
   INFO(l) << "QuantizeWeightsOnly visits node: " << node->name() << std::endl;
 
+  // NOTE Block quantized convolution is not supported by the runtime
+  if (granularity == QuantizationGranularity::GroupWise)
+    return;
+
   auto weights = luci::must_cast<luci::CircleConst *>(node->filter());
   if (!is_quantized(weights))
   {
     auto new_weights = luci::clone(weights);
     node->filter(new_weights);
-    quantize_weights(new_weights);
+    quantize_or_defer(new_weights);
   }
 }
 
+void QuantizeWeightsOnly::visit(luci::CircleGather *node)
+{
+  LOGGER(l);
+
+  // NOTE Only embedding table (gather rows of 2D constant) is quantized, by group-wise only
+  if (granularity != QuantizationGranularity::GroupWise)
+    return;
+
+  auto params = dynamic_cast<luci::CircleConst *>(node->params());
+  if (params == nullptr || node->axis() != 0 || !block_quantizable(params))
+    return;
+
+  INFO(l) << "QuantizeWeightsOnly visits node: " << node->name() << std::endl;
+
+  auto new_params = luci::clone(params);
+  node->params(new_params);
+  quantize_or_defer(new_params);
+}
+
 void QuantizeWeightsOnly::visit(luci::CircleNode *) {}
 
 } // namespace luci
@@ -20,30 +20,43 @@
 #include <luci/Pass/QuantizationParameters.h>
 #include <luci/IR/CircleNodeVisitor.h>
 
+#include <functional>
+#include <vector>
+
 namespace luci
 {
 
 /**
  * @brief QuantizeWeightsOnly quantizes tensors for weights
  * @details Find min/max values on the fly and then quantize
+ *          If 'deferred' is given, quantization is appended to it like QuantizeWeights does.
  */
 struct QuantizeWeightsOnly final : public luci::CircleNodeMutableVisitor<void>
 {
-  QuantizeWeightsOnly(loco::DataType input, loco::DataType output, QuantizationGranularity gr)
-    : input_type(input), output_type(output), granularity(gr)
+  QuantizeWeightsOnly(loco::DataType input, loco::DataType output, QuantizationGranularity gr,
+                      uint32_t group_size = 32,
+                      std::vector<std::function<void(void)>> *deferred = nullptr)
+    : input_type(input), output_type(output), granularity(gr), group_size(group_size),
+      deferred(deferred)
   {
   }
 
   loco::DataType input_type;
   loco::DataType output_type;
   QuantizationGranularity granularity;
+  uint32_t group_size;
+  std::vector<std::function<void(void)>> *deferred;
 
 private:
   void quantize_weights(luci::CircleConst *weights);
+  void quantize_or_defer(luci::CircleConst *weights);
+  // Return true if weights can be quantized into blocks along the last dimension
+  bool block_quantizable(const luci::CircleConst *weights) const;
 
   void visit(luci::CircleConv2D *node);
   void visit(luci::CircleDepthwiseConv2D *node);
   void visit(luci::CircleFullyConnected *node);
+  void visit(luci::CircleGather *node);
   void visit(luci::CircleNode *);
 };
 
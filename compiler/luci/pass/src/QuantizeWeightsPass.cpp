@@ -17,6 +17,7 @@
 #include "luci/Pass/QuantizeWeightsPass.h"
 #include "QuantizeWeightsOnly.h"
 #include "QuantizationUtils.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/Log.h>
 
@@ -31,13 +32,30 @@ bool QuantizeWeightsPass::run(loco::Graph *g)
   if (_ctx->input_model_dtype != loco::DataType::FLOAT32)
     throw std::runtime_error("Weights-only quantization supports float32 input only");
 
+  if (_ctx->granularity == QuantizationGranularity::GroupWise)
+  {
+    if (_ctx->output_model_dtype != loco::DataType::S4 &&
+        _ctx->output_model_dtype != loco::DataType::S8)
+      throw std::runtime_error("Group-wise quantization supports int4 and int8 only");
+    // NOTE Block formats of the runtime (GGML_Q4_0, GGML_Q8_0) have 32 elements in a group
+    if (_ctx->group_size != 32)
+      throw std::runtime_error("Group-wise quantization supports group size 32 only");
+  }
+
   // Quantize weights
+  // NOTE Graph is updated on this thread, and then weights of nodes are quantized in parallel
+  std::vector<std::function<void(void)>> deferred;
   for (auto node : loco::active_nodes(loco::output_nodes(g)))
   {
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    QuantizeWeightsOnly qw(_ctx->input_model_dtype, _ctx->output_model_dtype, _ctx->granularity);
+    QuantizeWeightsOnly qw(_ctx->input_model_dtype, _ctx->output_model_dtype, _ctx->granularity,
+                           _ctx->group_size, &deferred);
     circle_node->accept(&qw);
   }
+  ThreadPool::shared().parallel_for(deferred.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+      deferred[i]();
+  });
 
   INFO(l) << "QuantizeWeightsPass End" << std::endl;
   return false; // one time run
@@ -139,3 +139,127 @@ TEST_F(QuantizeWeightsPassTest, inf_weights_NEG)
   _conv_weight->at<loco::DataType::FLOAT32>(0) = std::numeric_limits<float>::max();
   EXPECT_THROW(pass.run(&_g), std::runtime_error);
 }
+
+namespace
+{
+
+struct QuantizeWeightsGroupWiseTest : public ::testing::Test
+{
+  /**
+   *        [CircleInput]
+   *              |
+   *     [CircleFullyConnected]
+   *              |
+   *        [CircleOutput]
+   */
+  void SetUp() override
+  {
+    auto graph_input = _g.inputs()->create();
+    auto graph_output = _g.outputs()->create();
+
+    auto input = _g.nodes()->create<luci::CircleInput>();
+    input->index(graph_input->index());
+    input->shape({1, K});
+    input->dtype(loco::DataType::FLOAT32);
+    input->name("input");
+
+    _weights = _g.nodes()->create<luci::CircleConst>();
+    _weights->dtype(loco::DataType::FLOAT32);
+    _weights->shape({N, K});
+    _weights->size<loco::DataType::FLOAT32>(N * K);
+    for (uint32_t i = 0; i < N * K; ++i)
+      _weights->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i % 17) - 8.0f;
+    _weights->name("weights");
+
+    _fc = _g.nodes()->create<luci::CircleFullyConnected>();
+    _fc->input(input);
+    _fc->weights(_weights);
+    _fc->bias(_g.nodes()->create<luci::CircleOutputExclude>());
+    _fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+    _fc->dtype(loco::DataType::FLOAT32);
+    _fc->shape({1, N});
+    _fc->name("fc");
+
+    auto output = _g.nodes()->create<luci::CircleOutput>();
+    output->index(graph_output->index());
+    output->from(_fc);
+    output->shape({1, N});
+    output->dtype(loco::DataType::FLOAT32);
+    output->name("output");
+  }
+
+  static constexpr uint32_t N = 2;
+  static constexpr uint32_t K = 64;
+
+  loco::Graph _g;
+  luci::CircleConst *_weights = nullptr;
+  luci::CircleFullyConnected *_fc = nullptr;
+};
+
+} // namespace
+
+TEST_F(QuantizeWeightsGroupWiseTest, q8_0)
+{
+  luci::QuantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                 luci::QuantizationGranularity::GroupWise);
+  pass.run(&_g);
+
+  auto weights = loco::must_cast<luci::CircleConst *>(_fc->weights());
+  EXPECT_EQ(loco::DataType::GGML_Q8_0, weights->dtype());
+  EXPECT_EQ(2, weights->rank());
+  EXPECT_EQ(K, weights->dim(1).value());
+  // fp16 scale and 32 int8 values per block
+  EXPECT_EQ(N * K / 32 * 34, weights->size<loco::DataType::GGML_Q8_0>());
+  EXPECT_EQ(nullptr, weights->quantparam());
+
+  // First block has values of -8 ~ 8, quantized with scale 8/127
+  auto qs = reinterpret_cast<const int8_t *>(&weights->at<loco::DataType::GGML_Q8_0>(2));
+  EXPECT_EQ(-127, qs[0]);
+  EXPECT_EQ(127, qs[16]);
+}
+
+TEST_F(QuantizeWeightsGroupWiseTest, q4_0)
+{
+  luci::QuantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::S4,
+                                 luci::QuantizationGranularity::GroupWise);
+  pass.run(&_g);
+
+  auto weights = loco::must_cast<luci::CircleConst *>(_fc->weights());
+  EXPECT_EQ(loco::DataType::GGML_Q4_0, weights->dtype());
+  // fp16 scale and 32 4bit values per block
+  EXPECT_EQ(N * K / 32 * 18, weights->size<loco::DataType::GGML_Q4_0>());
+}
+
+TEST_F(QuantizeWeightsGroupWiseTest, partial_group_NEG)
+{
+  _weights->shape({N * 2, K / 2 + 1});
+
+  luci::QuantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::S8,
+                                 luci::QuantizationGranularity::GroupWise);
+  pass.run(&_g);
+
+  // Weights not divisible into groups are kept as they are
+  EXPECT_EQ(_weights, _fc->weights());
+  EXPECT_EQ(loco::DataType::FLOAT32, _weights->dtype());
+}
+
+TEST_F(QuantizeWeightsGroupWiseTest, group_size_NEG)
+{
+  auto ctx = std::make_unique<luci::QuantizeWeightsPass::Context>();
+  {
+    ctx->input_model_dtype = loco::DataType::FLOAT32;
+    ctx->output_model_dtype = loco::DataType::S8;
+    ctx->granularity = luci::QuantizationGranularity::GroupWise;
+    ctx->group_size = 64;
+  }
+
+  luci::QuantizeWeightsPass pass(std::move(ctx));
+  EXPECT_THROW(pass.run(&_g), std::runtime_error);
+}
+
+TEST_F(QuantizeWeightsGroupWiseTest, output_s16_NEG)
+{
+  luci::QuantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::S16,
+                                 luci::QuantizationGranularity::GroupWise);
+  EXPECT_THROW(pass.run(&_g), std::runtime_error);
+}
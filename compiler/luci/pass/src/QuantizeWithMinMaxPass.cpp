@@ -24,6 +24,7 @@
 #include "QuantizationUtils.h"
 #include "ProgressReporter.h"
 #include "helpers/LayerInfoMap.h"
+#include "helpers/ThreadPool.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeVisitor.h>
@@ -662,12 +663,20 @@ bool QuantizeWithMinMaxPass::run(loco::Graph *g)
   phase_runner.run(phase);
 
   // Quantize weights
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  // NOTE Graph is updated on this thread, and then weights of nodes are quantized in parallel
   {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    QuantizeWeights qw(_ctx->input_model_dtype, quantize_dtype(circle_node),
-                       quantize_granularity(circle_node));
-    circle_node->accept(&qw);
+    std::vector<std::function<void(void)>> deferred;
+    for (auto node : loco::active_nodes(loco::output_nodes(g)))
+    {
+      auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+      QuantizeWeights qw(_ctx->input_model_dtype, quantize_dtype(circle_node),
+                         quantize_granularity(circle_node), &deferred);
+      circle_node->accept(&qw);
+    }
+    ThreadPool::shared().parallel_for(deferred.size(), 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i)
+        deferred[i]();
+    });
   }
 
   // Quantize bias
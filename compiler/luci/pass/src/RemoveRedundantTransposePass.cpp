@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveRedundantTransposePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
 
@@ -88,6 +90,20 @@ bool remove_consecutive_transpose_function(luci::CircleTranspose *target_node)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+  for (auto node : nodes)
+  {
+    if (auto transpose = dynamic_cast<luci::CircleTranspose *>(node))
+    {
+      if (remove_consecutive_transpose_function(transpose))
+        changed = true;
+    }
+  }
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -115,16 +131,12 @@ namespace luci
  */
 bool RemoveRedundantTransposePass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto transpose = dynamic_cast<luci::CircleTranspose *>(node))
-    {
-      if (remove_consecutive_transpose_function(transpose))
-        changed = true;
-    }
-  }
-  return changed;
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveRedundantTransposePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/RemoveUnnecessaryAddPass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 
@@ -65,6 +66,20 @@ bool remove_no_effect_add(luci::CircleNode *node)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+  for (auto node : nodes)
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (remove_no_effect_add(circle_node))
+    {
+      changed = true;
+    }
+  }
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -92,16 +107,12 @@ namespace luci
  **/
 bool RemoveUnnecessaryAddPass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_no_effect_add(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveUnnecessaryAddPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
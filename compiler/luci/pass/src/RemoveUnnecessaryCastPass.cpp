@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessaryCastPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -54,15 +56,10 @@ bool remove_unnecessary_cast(luci::CircleCast *cast)
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool RemoveUnnecessaryCastPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto cast_node = dynamic_cast<luci::CircleCast *>(node))
     {
@@ -73,4 +70,19 @@ bool RemoveUnnecessaryCastPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool RemoveUnnecessaryCastPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveUnnecessaryCastPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessaryReshapePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -53,6 +55,20 @@ bool remove_no_effect_reshape(luci::CircleNode *node)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+  for (auto node : nodes)
+  {
+    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+    if (remove_no_effect_reshape(circle_node))
+    {
+      changed = true;
+    }
+  }
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -79,16 +95,12 @@ namespace luci
 
 bool RemoveUnnecessaryReshapePass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_no_effect_reshape(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveUnnecessaryReshapePass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
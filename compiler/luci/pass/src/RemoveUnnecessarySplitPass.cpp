@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessarySplitPass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -42,15 +44,10 @@ bool remove_unnecessary_split(luci::CircleNode *node)
   return false;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
     if (remove_unnecessary_split(circle_node))
@@ -61,4 +58,19 @@ bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveUnnecessarySplitPass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
@@ -16,6 +16,8 @@
 
 #include "luci/Pass/RemoveUnnecessaryStridedSlicePass.h"
 
+#include "helpers/PatternCandidates.h"
+
 #include <luci/IR/CircleNodes.h>
 
 namespace
@@ -81,6 +83,19 @@ bool remove_no_effect_strided_slice(luci::CircleStridedSlice *target_node)
   return true;
 }
 
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
+{
+  bool changed = false;
+  for (auto node : nodes)
+  {
+    auto target_node = dynamic_cast<luci::CircleStridedSlice *>(node);
+    if (target_node != nullptr)
+      if (remove_no_effect_strided_slice(target_node))
+        changed = true;
+  }
+  return changed;
+}
+
 } // namespace
 
 namespace luci
@@ -110,15 +125,13 @@ namespace luci
  */
 bool RemoveUnnecessaryStridedSlicePass::run(loco::Graph *g)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto target_node = dynamic_cast<luci::CircleStridedSlice *>(node);
-    if (target_node != nullptr)
-      if (remove_no_effect_strided_slice(target_node))
-        changed = true;
-  }
-  return changed;
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool RemoveUnnecessaryStridedSlicePass::run(loco::Graph *,
+                                            const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
 }
 
 } // namespace luci
@@ -17,6 +17,7 @@
 #include "luci/Pass/TransformMinMaxToRelu6Pass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -109,16 +110,11 @@ template <loco::DataType DT> bool transform_min_max_pattern(luci::CircleMaximum
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
 
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto maxi = dynamic_cast<luci::CircleMaximum *>(node))
     {
@@ -130,4 +126,19 @@ bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool TransformMinMaxToRelu6Pass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
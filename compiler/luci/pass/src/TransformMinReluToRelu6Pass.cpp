@@ -17,6 +17,7 @@
 #include "luci/Pass/TransformMinReluToRelu6Pass.h"
 
 #include "helpers/NodeFiller.h"
+#include "helpers/PatternCandidates.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/Profile/CircleNodeOrigin.h>
@@ -99,16 +100,11 @@ template <loco::DataType DT> bool transform_min_relu_pattern(luci::CircleRelu *r
   return true;
 }
 
-} // namespace
-
-namespace luci
-{
-
-bool TransformMinReluToRelu6Pass::run(loco::Graph *g)
+bool run_for_nodes(const std::set<loco::Node *> &nodes)
 {
   bool changed = false;
 
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  for (auto node : nodes)
   {
     if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
     {
@@ -120,4 +116,19 @@ bool TransformMinReluToRelu6Pass::run(loco::Graph *g)
   return changed;
 }
 
+} // namespace
+
+namespace luci
+{
+
+bool TransformMinReluToRelu6Pass::run(loco::Graph *g)
+{
+  return run_for_nodes(loco::active_nodes(loco::output_nodes(g)));
+}
+
+bool TransformMinReluToRelu6Pass::run(loco::Graph *, const std::unordered_set<loco::Node *> &dirty)
+{
+  return run_for_nodes(pattern_candidates(dirty));
+}
+
 } // namespace luci
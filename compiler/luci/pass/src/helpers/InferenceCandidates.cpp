@@ -18,17 +18,60 @@
 
 #include <luci/IR/DeadNodeQueryService.h>
 
+#include <unordered_set>
+
+namespace
+{
+
+// Return the nodes in region ordered so that arguments in region come before their users
+std::vector<loco::Node *> region_postorder(const std::unordered_set<loco::Node *> &region)
+{
+  std::vector<loco::Node *> res;
+  std::unordered_set<loco::Node *> visited;
+  // Pair of node and the index of the next argument to visit
+  std::vector<std::pair<loco::Node *, uint32_t>> stack;
+
+  for (auto root : region)
+  {
+    if (not visited.insert(root).second)
+      continue;
+
+    stack.emplace_back(root, 0);
+    while (not stack.empty())
+    {
+      auto &top = stack.back();
+      auto node = top.first;
+
+      if (top.second < node->arity())
+      {
+        auto arg = node->arg(top.second++);
+        if (region.find(arg) != region.end() and visited.insert(arg).second)
+          stack.emplace_back(arg, 0);
+        continue;
+      }
+
+      res.emplace_back(node);
+      stack.pop_back();
+    }
+  }
+
+  return res;
+}
+
+} // namespace
+
 namespace luci
 {
 
 std::vector<loco::Node *> inference_candidates(loco::Graph *g)
 {
   auto candidates = loco::postorder_traversal(loco::output_nodes(g));
+  std::unordered_set<loco::Node *> visited(candidates.begin(), candidates.end());
 
   for (auto node : loco::all_nodes(g))
   {
     // already included as candidate
-    if (std::find(candidates.begin(), candidates.end(), node) != candidates.end())
+    if (visited.find(node) != visited.end())
       continue;
 
     // As the node is not used for both graph output and multiple output operation,
@@ -42,4 +85,35 @@ std::vector<loco::Node *> inference_candidates(loco::Graph *g)
   return candidates;
 }
 
+bool infer_incrementally(const std::unordered_set<loco::Node *> &dirty,
+                         const std::function<bool(loco::Node *)> &infer)
+{
+  bool changed = false;
+
+  std::unordered_set<loco::Node *> region = dirty;
+  while (not region.empty())
+  {
+    std::unordered_set<loco::Node *> next;
+
+    for (auto node : region_postorder(region))
+    {
+      if (not infer(node))
+        continue;
+
+      changed = true;
+
+      // Users in the region are inferenced after node as region is in postorder
+      for (auto succ : loco::succs(node))
+      {
+        if (region.find(succ) == region.end())
+          next.insert(succ);
+      }
+    }
+
+    region.swap(next);
+  }
+
+  return changed;
+}
+
 } // namespace luci
@@ -19,6 +19,8 @@
 
 #include <loco.h>
 
+#include <functional>
+#include <unordered_set>
 #include <vector>
 
 namespace luci
@@ -29,6 +31,16 @@ namespace luci
  */
 std::vector<loco::Node *> inference_candidates(loco::Graph *g);
 
+/**
+ * @brief Run 'infer' for dirty nodes, arguments first, and then for the users of the nodes whose
+ *        shape/dtype is updated, until no node is updated.
+ *
+ * @note  'infer' should return true if it updated the node.
+ *        Return true if any node is updated.
+ */
+bool infer_incrementally(const std::unordered_set<loco::Node *> &dirty,
+                         const std::function<bool(loco::Node *)> &infer);
+
 } // namespace luci
 
 #endif // __LUCI_INFERENCE_CANDIDATES_H__
@@ -120,3 +120,57 @@ TEST(LuciPassHelpersInferenceCandidates, inference_candidates_NEG)
   ASSERT_FALSE(contains(s, relu1));
   ASSERT_FALSE(contains(s, relu2));
 }
+
+TEST(LuciPassHelpersInferenceCandidates, infer_incrementally)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto relu1 = g->nodes()->create<luci::CircleRelu>();
+  auto relu2 = g->nodes()->create<luci::CircleRelu>();
+  auto relu3 = g->nodes()->create<luci::CircleRelu>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  relu1->features(input);
+  relu2->features(relu1);
+  relu3->features(relu2);
+  output->from(relu3);
+
+  // relu1 and relu2 are updated once
+  std::unordered_set<loco::Node *> to_update{relu1, relu2};
+  std::vector<loco::Node *> inferred;
+  auto infer = [&](loco::Node *node) {
+    inferred.emplace_back(node);
+    return to_update.erase(node) > 0;
+  };
+
+  ASSERT_TRUE(luci::infer_incrementally({relu3, relu1}, infer));
+
+  // relu2 is inferenced after relu1 is updated, and then relu3 after relu2 is updated
+  ASSERT_EQ(4, inferred.size());
+  EXPECT_TRUE(contains({inferred.at(0), inferred.at(1)}, relu1));
+  EXPECT_TRUE(contains({inferred.at(0), inferred.at(1)}, relu3));
+  EXPECT_EQ(relu2, inferred.at(2));
+  EXPECT_EQ(relu3, inferred.at(3));
+}
+
+TEST(LuciPassHelpersInferenceCandidates, infer_incrementally_NEG)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto relu = g->nodes()->create<luci::CircleRelu>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  relu->features(input);
+  output->from(relu);
+
+  uint32_t count = 0;
+  auto infer = [&](loco::Node *) {
+    count++;
+    return false;
+  };
+
+  ASSERT_FALSE(luci::infer_incrementally({relu}, infer));
+  ASSERT_EQ(1, count);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PatternCandidates.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <vector>
+
+namespace luci
+{
+
+std::set<loco::Node *> pattern_candidates(const std::unordered_set<loco::Node *> &dirty,
+                                          uint32_t hops)
+{
+  std::unordered_set<loco::Node *> visited(dirty.begin(), dirty.end());
+  std::vector<loco::Node *> frontier(dirty.begin(), dirty.end());
+
+  for (uint32_t hop = 0; hop < hops and not frontier.empty(); ++hop)
+  {
+    std::vector<loco::Node *> next;
+
+    auto visit = [&](loco::Node *node) {
+      if (node != nullptr and visited.insert(node).second)
+        next.emplace_back(node);
+    };
+
+    for (auto node : frontier)
+    {
+      for (uint32_t i = 0; i < node->arity(); ++i)
+        visit(node->arg(i));
+      for (auto succ : loco::succs(node))
+        visit(succ);
+    }
+
+    frontier.swap(next);
+  }
+
+  std::set<loco::Node *> candidates;
+  for (auto node : visited)
+  {
+    if (loco::succs(node).empty() and dynamic_cast<luci::CircleOutput *>(node) == nullptr)
+      continue;
+
+    candidates.insert(node);
+  }
+
+  return candidates;
+}
+
+} // namespace luci
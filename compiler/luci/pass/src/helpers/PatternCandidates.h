@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PATTERN_CANDIDATES_H__
+#define __LUCI_PATTERN_CANDIDATES_H__
+
+#include <loco.h>
+
+#include <set>
+#include <unordered_set>
+
+namespace luci
+{
+
+/**
+ * @brief Enumerate the nodes within 'hops' edges (in both directions) from dirty nodes, i.e.,
+ *        the nodes where a pattern spanning at most 'hops' edges can newly match.
+ *
+ * @note  As with loco::active_nodes(), nodes without any user except CircleOutput are excluded.
+ *        The result is the same as the active nodes of the region only when the graph has no
+ *        dead node.
+ */
+std::set<loco::Node *> pattern_candidates(const std::unordered_set<loco::Node *> &dirty,
+                                          uint32_t hops = 3);
+
+} // namespace luci
+
+#endif // __LUCI_PATTERN_CANDIDATES_H__
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PatternCandidates.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ *  [Input] - [Relu] - [Relu] - [Relu] - [Relu] - [Output]
+ *                                          \
+ *                                         [Relu] (no user)
+ */
+class PatternCandidatesTestGraph
+{
+public:
+  void init(void)
+  {
+    _g = loco::make_graph();
+
+    _input = _g->nodes()->create<luci::CircleInput>();
+    loco::Node *prev = _input;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      _relu[i] = _g->nodes()->create<luci::CircleRelu>();
+      _relu[i]->features(prev);
+      prev = _relu[i];
+    }
+
+    _unused = _g->nodes()->create<luci::CircleRelu>();
+    _unused->features(_relu[2]);
+
+    _output = _g->nodes()->create<luci::CircleOutput>();
+    _output->from(prev);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> _g;
+  luci::CircleInput *_input = nullptr;
+  luci::CircleRelu *_relu[4] = {nullptr};
+  luci::CircleRelu *_unused = nullptr;
+  luci::CircleOutput *_output = nullptr;
+};
+
+} // namespace
+
+TEST(LuciPassHelpersPatternCandidates, pattern_candidates)
+{
+  PatternCandidatesTestGraph g;
+  g.init();
+
+  auto s = luci::pattern_candidates({g._relu[0]}, 2);
+
+  ASSERT_EQ(4, s.size());
+  EXPECT_EQ(1, s.count(g._input));
+  EXPECT_EQ(1, s.count(g._relu[0]));
+  EXPECT_EQ(1, s.count(g._relu[1]));
+  EXPECT_EQ(1, s.count(g._relu[2]));
+}
+
+TEST(LuciPassHelpersPatternCandidates, pattern_candidates_output)
+{
+  PatternCandidatesTestGraph g;
+  g.init();
+
+  auto s = luci::pattern_candidates({g._relu[3]}, 1);
+
+  ASSERT_EQ(3, s.size());
+  EXPECT_EQ(1, s.count(g._relu[2]));
+  EXPECT_EQ(1, s.count(g._relu[3]));
+  EXPECT_EQ(1, s.count(g._output));
+}
+
+TEST(LuciPassHelpersPatternCandidates, pattern_candidates_unused_NEG)
+{
+  PatternCandidatesTestGraph g;
+  g.init();
+
+  auto s = luci::pattern_candidates({g._unused}, 1);
+
+  ASSERT_EQ(1, s.size());
+  EXPECT_EQ(1, s.count(g._relu[2]));
+  EXPECT_EQ(0, s.count(g._unused));
+}
@@ -98,7 +98,10 @@ QuantizationGranularity str_to_granularity(const std::string &str)
   if (to_lower_case(str).compare("channel") == 0)
     return QuantizationGranularity::ChannelWise;
 
-  throw std::runtime_error("Quantization granularity must be either 'layer' or 'channel'");
+  if (to_lower_case(str).compare("group") == 0)
+    return QuantizationGranularity::GroupWise;
+
+  throw std::runtime_error("Quantization granularity must be one of 'layer', 'channel' or 'group'");
 }
 
 } // namespace luci
@@ -47,6 +47,7 @@ TEST(StringsTest, str_to_granularity)
 {
   ASSERT_EQ(luci::QuantizationGranularity::LayerWise, luci::str_to_granularity("layer"));
   ASSERT_EQ(luci::QuantizationGranularity::ChannelWise, luci::str_to_granularity("channel"));
+  ASSERT_EQ(luci::QuantizationGranularity::GroupWise, luci::str_to_granularity("group"));
 
   EXPECT_THROW(luci::str_to_granularity("foo"), std::runtime_error);
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace
+{
+
+// True while the thread runs a part of parallel_for
+thread_local bool in_parallel_region = false;
+
+class ParallelRegionGuard final
+{
+public:
+  ParallelRegionGuard() : _prev(in_parallel_region) { in_parallel_region = true; }
+  ~ParallelRegionGuard() { in_parallel_region = _prev; }
+
+private:
+  bool _prev;
+};
+
+} // namespace
+
+namespace luci
+{
+
+ThreadPool::ThreadPool(uint32_t num_threads)
+{
+  for (uint32_t i = 1; i < num_threads; ++i)
+    _workers.emplace_back([this]() { work(); });
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _cv.notify_all();
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+ThreadPool &ThreadPool::shared(void)
+{
+  static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+  return pool;
+}
+
+void ThreadPool::work(void)
+{
+  while (true)
+  {
+    std::function<void(void)> job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [this]() { return _stop or not _jobs.empty(); });
+      if (_jobs.empty())
+        return;
+      job = std::move(_jobs.front());
+      _jobs.pop_front();
+    }
+    job();
+  }
+}
+
+void ThreadPool::parallel_for(size_t size, size_t grain,
+                              const std::function<void(size_t, size_t)> &func)
+{
+  if (size == 0)
+    return;
+
+  grain = std::max<size_t>(grain, 1);
+  const size_t num_threads = std::min<size_t>((size + grain - 1) / grain, this->num_threads());
+
+  if (num_threads <= 1 or in_parallel_region)
+  {
+    ParallelRegionGuard guard;
+    func(0, size);
+    return;
+  }
+
+  // A few chunks per thread to balance uneven work
+  const size_t max_chunks = num_threads * 4;
+  const size_t chunk_size = std::max(grain, (size + max_chunks - 1) / max_chunks);
+  const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+
+  // Threads take chunks one by one until all chunks are taken
+  std::atomic<size_t> next_chunk{0};
+  std::mutex state_mutex;
+  std::condition_variable state_cv;
+  size_t num_running = num_threads - 1;
+  std::exception_ptr error;
+
+  auto run_chunks = [&]() {
+    ParallelRegionGuard guard;
+    size_t chunk;
+    while ((chunk = next_chunk++) < num_chunks)
+    {
+      const size_t begin = chunk * chunk_size;
+      const size_t end = std::min(size, begin + chunk_size);
+      try
+      {
+        func(begin, end);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        if (not error)
+          error = std::current_exception();
+        // Skip remaining chunks
+        next_chunk = num_chunks;
+      }
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 1; i < num_threads; ++i)
+    {
+      _jobs.emplace_back([&]() {
+        run_chunks();
+        std::lock_guard<std::mutex> lock(state_mutex);
+        if (--num_running == 0)
+          state_cv.notify_one();
+      });
+    }
+  }
+  _cv.notify_all();
+
+  run_chunks();
+
+  // Wait for the jobs as they refer to the local variables
+  {
+    std::unique_lock<std::mutex> lock(state_mutex);
+    state_cv.wait(lock, [&]() { return num_running == 0; });
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+} // namespace luci
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PASS_HELPERS_THREAD_POOL_H__
+#define __LUCI_PASS_HELPERS_THREAD_POOL_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci
+{
+
+/**
+ * @brief ThreadPool runs loops of passes on multiple threads
+ *
+ * HOW TO USE:
+ *
+ *   ThreadPool::shared().parallel_for(size, grain, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; ++i)
+ *       out[i] = f(in[i]);
+ *   });
+ *
+ * NOTE parallel_for called inside of another parallel_for runs on the calling thread,
+ *      so that per-node and per-element loops can be nested without oversubscription.
+ */
+class ThreadPool final
+{
+public:
+  // 'num_threads' includes the thread calling parallel_for
+  explicit ThreadPool(uint32_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+public:
+  // Grain for loops doing a few operations per element, not worth a thread below this size
+  static constexpr size_t kElementGrain = 16384;
+
+public:
+  // Pool shared by passes in the process, having as many threads as hardware concurrency
+  static ThreadPool &shared(void);
+
+public:
+  uint32_t num_threads(void) const { return static_cast<uint32_t>(_workers.size()) + 1; }
+
+  /**
+   * @brief Call func(begin, end) for sub-ranges of [0, size) and wait for all of them
+   * @note  Each sub-range has 'grain' elements at least, except the last one.
+   *        If func throws, the first exception is rethrown after all sub-ranges finish.
+   */
+  void parallel_for(size_t size, size_t grain, const std::function<void(size_t, size_t)> &func);
+
+private:
+  void work(void);
+
+private:
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::function<void(void)>> _jobs;
+  bool _stop = false;
+};
+
+} // namespace luci
+
+#endif // __LUCI_PASS_HELPERS_THREAD_POOL_H__
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace luci;
+
+TEST(ThreadPoolTest, parallel_for)
+{
+  ThreadPool pool(4);
+
+  std::vector<int> values(1000, 0);
+  pool.parallel_for(values.size(), 16, [&](size_t begin, size_t end) {
+    EXPECT_LT(begin, end);
+    for (size_t i = begin; i < end; ++i)
+      values[i] += static_cast<int>(i);
+  });
+
+  for (size_t i = 0; i < values.size(); ++i)
+    EXPECT_EQ(static_cast<int>(i), values[i]);
+}
+
+TEST(ThreadPoolTest, grain)
+{
+  ThreadPool pool(4);
+
+  std::atomic<uint32_t> count{0};
+  pool.parallel_for(10, 100, [&](size_t begin, size_t end) {
+    EXPECT_EQ(0, begin);
+    EXPECT_EQ(10, end);
+    count++;
+  });
+  EXPECT_EQ(1, count);
+}
+
+TEST(ThreadPoolTest, nested)
+{
+  ThreadPool pool(4);
+
+  std::vector<std::vector<int>> values(8, std::vector<int>(100, 0));
+  pool.parallel_for(values.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      auto &row = values[i];
+      pool.parallel_for(row.size(), 1, [&](size_t b, size_t e) {
+        // Nested loop runs at once on the calling thread
+        EXPECT_EQ(0, b);
+        EXPECT_EQ(row.size(), e);
+        for (size_t j = b; j < e; ++j)
+          row[j] = 1;
+      });
+    }
+  });
+
+  for (auto &row : values)
+    for (auto v : row)
+      EXPECT_EQ(1, v);
+}
+
+TEST(ThreadPoolTest, shared)
+{
+  auto &pool = ThreadPool::shared();
+
+  EXPECT_EQ(&pool, &ThreadPool::shared());
+  EXPECT_LE(1, pool.num_threads());
+}
+
+TEST(ThreadPoolTest, empty_range)
+{
+  ThreadPool pool(2);
+
+  pool.parallel_for(0, 1, [&](size_t, size_t) { FAIL(); });
+  SUCCEED();
+}
+
+TEST(ThreadPoolTest, exception_NEG)
+{
+  ThreadPool pool(4);
+
+  auto func = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      if (i == 50)
+        throw std::runtime_error("Error");
+    }
+  };
+  EXPECT_THROW(pool.parallel_for(100, 1, func), std::runtime_error);
+
+  // Pool is still usable
+  std::atomic<size_t> sum{0};
+  pool.parallel_for(100, 1, [&](size_t begin, size_t end) { sum += end - begin; });
+  EXPECT_EQ(100, sum);
+}
@@ -174,7 +174,11 @@ struct TypeInferenceAlgorithm final : public luci::CircleNodeVisitor<loco::DataT
 
   loco::DataType visit(const luci::CircleGather *node) final
   {
-    return luci::dtype_get(node->params());
+    const auto dtype = luci::dtype_get(node->params());
+    // Rows of block quantized params are gathered as float32
+    if (dtype == loco::DataType::GGML_Q4_0 || dtype == loco::DataType::GGML_Q8_0)
+      return loco::DataType::FLOAT32;
+    return dtype;
   }
 
   loco::DataType visit(const luci::CircleGatherNd *node) final
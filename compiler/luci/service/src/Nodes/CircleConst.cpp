@@ -90,6 +90,14 @@ luci::CircleConst *clone_circleconst(const luci::CircleConst *node, loco::Graph
         copy_values<loco::DataType::BOOL>(node, cloned);
         break;
 
+      case loco::DataType::GGML_Q4_0:
+        copy_values<loco::DataType::GGML_Q4_0>(node, cloned);
+        break;
+
+      case loco::DataType::GGML_Q8_0:
+        copy_values<loco::DataType::GGML_Q8_0>(node, cloned);
+        break;
+
       default:
         throw oops::UserExn("Unsupported tensor dtype");
     }
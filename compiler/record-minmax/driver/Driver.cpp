@@ -149,12 +149,6 @@ int entry(const int argc, char **argv)
 
   RecordMinMax rmm(num_threads, std::move(computer));
 
-  // TODO: support parallel record for profile with random data
-  if (num_threads > 1 and not arser["--input_data"])
-  {
-    throw std::runtime_error("Input data must be given for parallel recording");
-  }
-
   // Initialize interpreter and observer
   rmm.initialize(input_model_path);
 
@@ -164,29 +158,10 @@ int entry(const int argc, char **argv)
 
     rmm.setInputDataPath(input_data_path);
 
-    // TODO: support parallel record from file and dir input data format
-    if (num_threads > 1 and not(input_data_format == "h5") and not(input_data_format == "hdf5"))
-    {
-      throw std::runtime_error("Parallel recording is used only for h5 now");
-    }
-
     if (input_data_format == "h5" || input_data_format == "hdf5")
     {
       // Profile min/max while executing the H5 data
-      if (num_threads == 1)
-      {
-        rmm.setDataSetFormat(DataSetFormat::H5);
-      }
-      else
-      {
-        INFO(l) << "Using parallel recording" << std::endl;
-        rmm.profileDataInParallel(input_data_path);
-
-        // Save profiled values to the model
-        rmm.saveModel(output_model_path);
-
-        return EXIT_SUCCESS;
-      }
+      rmm.setDataSetFormat(DataSetFormat::H5);
     }
     // input_data is a text file having a file path in each line.
     // Each data file is composed of inputs of a model, concatenated in
@@ -219,7 +194,15 @@ int entry(const int argc, char **argv)
     rmm.setDataSetFormat(DataSetFormat::RANDOM);
   }
 
-  rmm.profileData();
+  if (num_threads == 1)
+  {
+    rmm.profileData();
+  }
+  else
+  {
+    INFO(l) << "Using parallel recording" << std::endl;
+    rmm.profileDataInParallel();
+  }
 
   // Save profiled values to the model
   rmm.saveModel(output_model_path);
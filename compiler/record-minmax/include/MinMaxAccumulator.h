@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXACCUMULATOR_H__
+#define __RECORD_MINMAX_MINMAXACCUMULATOR_H__
+
+#include <luci/IR/CircleNode.h>
+
+#include <memory>
+#include <unordered_map>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  MinMaxAccumulator summarizes min/max values of a node over all records
+ *
+ *         Memory usage of an accumulator is bounded regardless of the number of records.
+ *         Accumulators are created by MinMaxComputer, which decides how min/max is summarized.
+ */
+class MinMaxAccumulator
+{
+public:
+  virtual ~MinMaxAccumulator() = default;
+
+  // Record min/max of a record
+  virtual void record(float min, float max) = 0;
+
+  // Merge other accumulator (created by the same computer) into this
+  virtual void merge(const MinMaxAccumulator &other) = 0;
+
+  virtual float min() const = 0;
+  virtual float max() const = 0;
+};
+
+using MinMaxAccumulatorMap =
+  std::unordered_map<const luci::CircleNode *, std::unique_ptr<MinMaxAccumulator>>;
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXACCUMULATOR_H__
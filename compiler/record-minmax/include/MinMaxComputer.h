@@ -17,6 +17,7 @@
 #ifndef __RECORD_MINMAX_MINMAXCOMPUTER_H__
 #define __RECORD_MINMAX_MINMAXCOMPUTER_H__
 
+#include "MinMaxAccumulator.h"
 #include "MinMaxVectors.h"
 
 #include <luci/IR/CircleNode.h>
@@ -38,8 +39,13 @@ public:
   virtual ~MinMaxComputer() = default;
 
   // Child class must implement this
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+  virtual std::unique_ptr<MinMaxAccumulator> create_accumulator() const = 0;
+
+  // Set quantparam of nodes with the min/max summarized by accumulators
+  void update_qparam(const MinMaxAccumulatorMap &accumulator_map);
+
+  // Set quantparam of nodes with the recorded min/max vectors
+  void update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
 };
 
 class PercentileComputer : public MinMaxComputer
@@ -50,8 +56,7 @@ public:
   {
   }
 
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+  std::unique_ptr<MinMaxAccumulator> create_accumulator() const override;
 
 private:
   float _min_percentile = 0.0;
@@ -66,8 +71,7 @@ public:
   {
   }
 
-  virtual void
-  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+  std::unique_ptr<MinMaxAccumulator> create_accumulator() const override;
 
 private:
   uint32_t _batch_size = 0;
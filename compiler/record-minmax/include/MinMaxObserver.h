@@ -20,47 +20,61 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
-#include "MinMaxVectors.h"
+#include "MinMaxAccumulator.h"
+#include "MinMaxComputer.h"
 
+#include <cassert>
 #include <vector>
-#include <unordered_map>
 
 namespace record_minmax
 {
 
+struct NodeMinMax
+{
+  const luci::CircleNode *node = nullptr;
+  float min = 0.0f;
+  float max = 0.0f;
+};
+
+// Min/max of nodes for a record, in the order of execution
+using NodeMinMaxList = std::vector<NodeMinMax>;
+
 class MinMaxMap
 {
 public:
-  // Record min/max of node
-  void recordMinMax(const luci::CircleNode *node, float min, float max)
+  explicit MinMaxMap(const MinMaxComputer *computer) : _computer(computer)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.push_back(min);
-    vectors.max_vector.push_back(max);
+    assert(_computer != nullptr); // FIX_CALLER_UNLESS
   }
 
-  void appendMinMaxVector(const luci::CircleNode *node, const MinMaxVectors &minmax_vector)
+  // Record min/max of node
+  void recordMinMax(const luci::CircleNode *node, float min, float max)
   {
-    MinMaxVectors &vectors = _minmax_map[node];
-    vectors.min_vector.insert(vectors.min_vector.end(), minmax_vector.min_vector.begin(),
-                              minmax_vector.min_vector.end());
-    vectors.max_vector.insert(vectors.max_vector.end(), minmax_vector.max_vector.begin(),
-                              minmax_vector.max_vector.end());
+    auto &accumulator = _minmax_map[node];
+    if (accumulator == nullptr)
+      accumulator = _computer->create_accumulator();
+
+    accumulator->record(min, max);
   }
 
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
+  // Record min/max of nodes for a record
+  void recordMinMax(const NodeMinMaxList &list)
   {
-    return &_minmax_map;
+    for (const auto &minmax : list)
+      recordMinMax(minmax.node, minmax.min, minmax.max);
   }
 
+  const MinMaxAccumulatorMap *getMap() const { return &_minmax_map; }
+
 private:
-  std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  const MinMaxComputer *_computer = nullptr;
+  MinMaxAccumulatorMap _minmax_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
-  MinMaxObserver()
+  explicit MinMaxObserver(const MinMaxComputer *computer) : _minmax_data(computer)
   {
     // Do nothing
   }
@@ -71,8 +85,12 @@ public:
   // Never return nullptr
   const MinMaxMap *minMaxData() { return &_minmax_data; }
 
+  // Append min/max to 'list' instead of recording them, until nullptr is given
+  void collectTo(NodeMinMaxList *list) { _collect_list = list; }
+
 private:
   MinMaxMap _minmax_data;
+  NodeMinMaxList *_collect_list = nullptr;
 };
 
 } // namespace record_minmax
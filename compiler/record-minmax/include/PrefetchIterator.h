@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_PREFETCH_ITERATOR_H__
+#define __RECORD_MINMAX_PREFETCH_ITERATOR_H__
+
+#include "DataBuffer.h"
+#include "DataSetIterator.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  PrefetchIterator reads records of another iterator in a background thread
+ *
+ *         At most queue_size records are kept in memory, so a large dataset is streamed
+ *         with bounded memory while reading overlaps with interpretation.
+ *         pop() is thread-safe and can be called from multiple consumer threads, which take
+ *         records from the queue as they become free. Each record is given with its index in
+ *         the dataset, so consumers can combine their results in the order of records.
+ *         An exception thrown while reading is rethrown from pop()/next().
+ */
+class PrefetchIterator final : public DataSetIterator
+{
+public:
+  PrefetchIterator(std::unique_ptr<DataSetIterator> &&iter, uint32_t queue_size);
+
+  ~PrefetchIterator();
+
+  bool hasNext() const override;
+
+  std::vector<DataBuffer> next() override;
+
+  bool check_type_shape() const override;
+
+  // Move the next record to 'record'. Return false if there is no more record.
+  bool pop(std::vector<DataBuffer> &record);
+
+  // Same as above, and set 'record_idx' to the index of the record in the dataset
+  bool pop(std::vector<DataBuffer> &record, uint32_t &record_idx);
+
+  // Stop reading, so that pop() of all consumers returns false
+  void stop();
+
+private:
+  void produce();
+
+private:
+  std::unique_ptr<DataSetIterator> _iter;
+  uint32_t _queue_size = 0;
+  bool _check_type_shape = false;
+
+  mutable std::mutex _mutex;
+  mutable std::condition_variable _not_empty;
+  std::condition_variable _not_full;
+  // Pairs of (index, record)
+  std::deque<std::pair<uint32_t, std::vector<DataBuffer>>> _queue;
+  bool _done = false;
+  bool _stop = false;
+  std::exception_ptr _error;
+
+  std::thread _producer;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_PREFETCH_ITERATOR_H__
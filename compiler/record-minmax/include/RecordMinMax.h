@@ -21,6 +21,7 @@
 #include <luci_interpreter/Interpreter.h>
 
 #include "DataSetIterator.h"
+#include "PrefetchIterator.h"
 #include "MinMaxObserver.h"
 #include "MinMaxComputer.h"
 
@@ -30,10 +31,6 @@
 namespace record_minmax
 {
 
-using Buffer = std::vector<char>;
-using Output = std::vector<Buffer>;
-using WholeOutput = std::vector<Output>;
-
 class RecordMinMax
 {
 public:
@@ -69,7 +66,7 @@ public:
 
   void profileData();
 
-  void profileDataInParallel(const std::string &input_data_path);
+  void profileDataInParallel();
 
   void saveModel(const std::string &output_model_path);
 
@@ -86,7 +83,8 @@ private:
 
   std::unique_ptr<DataSetIterator> createIterator();
 
-  WholeOutput importH5Data(const std::string &input_data_path);
+  // Create an iterator which streams records with a bounded prefetch queue
+  std::unique_ptr<PrefetchIterator> createPrefetchIterator();
 
   std::unique_ptr<luci::Module> _module;
 
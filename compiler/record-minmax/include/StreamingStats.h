@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_STREAMING_STATS_H__
+#define __RECORD_MINMAX_STREAMING_STATS_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief  QuantileSketch summarizes a stream of values with bounded memory
+ *
+ *         Values are kept as they are until the number of stored values exceeds the capacity.
+ *         Until then, percentile() returns the same value as getNthPercentile.
+ *         After that, values are compressed into weighted centroids (t-digest) so that
+ *         the memory usage does not depend on the number of added values.
+ *         Tails (small and large percentiles) are kept more accurately than the middle.
+ */
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(uint32_t capacity = 4096);
+
+public:
+  void add(float value);
+
+  void merge(const QuantileSketch &other);
+
+  // Return n-th percentile of added values (0.0 <= n <= 100.0)
+  float percentile(float percentile) const;
+
+  uint64_t count() const { return _count; }
+
+  // Return true if all added values are kept without compression
+  bool exact() const { return _exact; }
+
+  // Return the number of stored centroids (for debugging and testing)
+  size_t size() const { return _centroids.size(); }
+
+private:
+  void compress();
+
+private:
+  struct Centroid
+  {
+    double mean;
+    double weight;
+  };
+
+  uint32_t _capacity = 0;
+  std::vector<Centroid> _centroids;
+  uint64_t _count = 0;
+  bool _exact = true;
+  float _min = 0.0f;
+  float _max = 0.0f;
+};
+
+/**
+ * @brief  MovingAverage computes the same value as getMovingAverage for a stream of values
+ *         without storing them
+ *
+ *         Values are grouped in batches of batch_size. The first batch initializes the average
+ *         and each following batch updates it with alpha. The last (partial) batch is also used.
+ */
+class MovingAverage
+{
+public:
+  MovingAverage(float alpha, uint32_t batch_size, bool is_min);
+
+public:
+  void add(float value);
+
+  // Append other's stream after this stream
+  void merge(const MovingAverage &other);
+
+  float value() const;
+
+  bool empty() const { return not _initialized and _pending == 0; }
+
+private:
+  void flush();
+
+private:
+  float _alpha = 0.0f;
+  uint32_t _batch_size = 0;
+  bool _is_min = true;
+
+  // Min (or max) of the current batch and the number of values in it
+  float _batch_value = 0.0f;
+  uint32_t _pending = 0;
+
+  bool _initialized = false;
+  // Min (or max) of the first batch
+  float _first = 0.0f;
+  // Number of batches following the first batch
+  uint64_t _num_updates = 0;
+  float _avg = 0.0f;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_STREAMING_STATS_H__
@@ -15,39 +15,108 @@
  */
 
 #include "MinMaxComputer.h"
-#include "RecordFunction.h"
+#include "StreamingStats.h"
 
 #include <luci/IR/CircleQuantParam.h>
 
-namespace record_minmax
+#include <cassert>
+#include <stdexcept>
+
+namespace
 {
 
-void PercentileComputer::update_qparam(
-  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
+using namespace record_minmax;
+
+class PercentileAccumulator final : public MinMaxAccumulator
 {
-  if (minmax_map == nullptr)
-    throw std::invalid_argument("minmax_map is nullptr");
+public:
+  PercentileAccumulator(float min_percentile, float max_percentile)
+    : _min_percentile(min_percentile), _max_percentile(max_percentile)
+  {
+  }
 
-  for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
+  void record(float min, float max) override
   {
-    auto node = iter->first;
-    auto minmax = iter->second;
+    _min_sketch.add(min);
+    _max_sketch.add(max);
+  }
+
+  void merge(const MinMaxAccumulator &other) override
+  {
+    const auto &rhs = dynamic_cast<const PercentileAccumulator &>(other);
+    _min_sketch.merge(rhs._min_sketch);
+    _max_sketch.merge(rhs._max_sketch);
+  }
+
+  float min() const override { return _min_sketch.percentile(_min_percentile); }
+  float max() const override { return _max_sketch.percentile(_max_percentile); }
+
+private:
+  float _min_percentile = 0.0;
+  float _max_percentile = 0.0;
+  QuantileSketch _min_sketch;
+  QuantileSketch _max_sketch;
+};
+
+class MovingAvgAccumulator final : public MinMaxAccumulator
+{
+public:
+  MovingAvgAccumulator(uint32_t batch_size, float update_const)
+    : _min_avg(1 - update_const, batch_size, true), _max_avg(1 - update_const, batch_size, false)
+  {
+  }
+
+  void record(float min, float max) override
+  {
+    _min_avg.add(min);
+    _max_avg.add(max);
+  }
+
+  void merge(const MinMaxAccumulator &other) override
+  {
+    const auto &rhs = dynamic_cast<const MovingAvgAccumulator &>(other);
+    _min_avg.merge(rhs._min_avg);
+    _max_avg.merge(rhs._max_avg);
+  }
+
+  float min() const override { return _min_avg.value(); }
+  float max() const override { return _max_avg.value(); }
+
+private:
+  MovingAverage _min_avg;
+  MovingAverage _max_avg;
+};
+
+void set_minmax(const luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+
+  assert(node->quantparam() == nullptr);
+
+  auto mutable_node = const_cast<luci::CircleNode *>(node);
+  mutable_node->quantparam(std::move(quantparam));
+}
 
-    auto min = getNthPercentile(minmax.min_vector, _min_percentile);
-    auto max = getNthPercentile(minmax.max_vector, _max_percentile);
+} // namespace
 
-    auto quantparam = std::make_unique<luci::CircleQuantParam>();
-    quantparam->min.push_back(min);
-    quantparam->max.push_back(max);
+namespace record_minmax
+{
 
-    assert(node->quantparam() == nullptr);
+void MinMaxComputer::update_qparam(const MinMaxAccumulatorMap &accumulator_map)
+{
+  for (const auto &iter : accumulator_map)
+  {
+    const auto node = iter.first;
+    const auto &accumulator = iter.second;
+    assert(accumulator != nullptr); // FIX_CALLER_UNLESS
 
-    auto mutable_node = const_cast<luci::CircleNode *>(node);
-    mutable_node->quantparam(std::move(quantparam));
+    set_minmax(node, accumulator->min(), accumulator->max());
   }
 }
 
-void MovingAvgComputer::update_qparam(
+void MinMaxComputer::update_qparam(
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
 {
   if (minmax_map == nullptr)
@@ -56,22 +125,29 @@ void MovingAvgComputer::update_qparam(
   for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
   {
     auto node = iter->first;
-    auto minmax = iter->second;
-
-    auto min = getMovingAverage(minmax.min_vector, 1 - _update_const, _batch_size, true);
-    auto max = getMovingAverage(minmax.max_vector, 1 - _update_const, _batch_size, false);
+    const auto &minmax = iter->second;
 
-    auto quantparam = std::make_unique<luci::CircleQuantParam>();
-    quantparam->min.push_back(min);
-    quantparam->max.push_back(max);
+    if (minmax.min_vector.size() != minmax.max_vector.size())
+      throw std::invalid_argument("Sizes of min/max vectors are different");
 
-    assert(node->quantparam() == nullptr);
+    auto accumulator = create_accumulator();
+    for (size_t i = 0; i < minmax.min_vector.size(); ++i)
+      accumulator->record(minmax.min_vector[i], minmax.max_vector[i]);
 
-    auto mutable_node = const_cast<luci::CircleNode *>(node);
-    mutable_node->quantparam(std::move(quantparam));
+    set_minmax(node, accumulator->min(), accumulator->max());
   }
 }
 
+std::unique_ptr<MinMaxAccumulator> PercentileComputer::create_accumulator() const
+{
+  return std::make_unique<PercentileAccumulator>(_min_percentile, _max_percentile);
+}
+
+std::unique_ptr<MinMaxAccumulator> MovingAvgComputer::create_accumulator() const
+{
+  return std::make_unique<MovingAvgAccumulator>(_batch_size, _update_const);
+}
+
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile)
 {
   return std::make_unique<PercentileComputer>(min_percentile, max_percentile);
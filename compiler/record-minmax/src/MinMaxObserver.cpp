@@ -83,14 +83,14 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-
   float max = std::numeric_limits<float>::lowest();
   float min = std::numeric_limits<float>::max();
 
   bool all_nan = true;
-  for (auto number : buf)
+  for (int32_t i = 0; i < num_elements; ++i)
   {
+    const auto number = data[i];
+
     if (isnan(number))
       continue;
 
@@ -110,7 +110,10 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   if (all_nan)
     throw std::runtime_error("All values are NaN(Not a Number)");
 
-  _minmax_data.recordMinMax(node, min, max);
+  if (_collect_list != nullptr)
+    _collect_list->push_back({node, min, max});
+  else
+    _minmax_data.recordMinMax(node, min, max);
 }
 
 } // namespace record_minmax
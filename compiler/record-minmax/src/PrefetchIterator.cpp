@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PrefetchIterator.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+PrefetchIterator::PrefetchIterator(std::unique_ptr<DataSetIterator> &&iter, uint32_t queue_size)
+  : _iter(std::move(iter)), _queue_size(queue_size)
+{
+  if (_iter == nullptr)
+    throw std::invalid_argument("PrefetchIterator requires a dataset iterator");
+
+  if (_queue_size == 0)
+    throw std::invalid_argument("Prefetch queue size must be positive");
+
+  _check_type_shape = _iter->check_type_shape();
+
+  _producer = std::thread(&PrefetchIterator::produce, this);
+}
+
+PrefetchIterator::~PrefetchIterator()
+{
+  stop();
+
+  if (_producer.joinable())
+    _producer.join();
+}
+
+void PrefetchIterator::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _not_full.notify_all();
+  _not_empty.notify_all();
+}
+
+void PrefetchIterator::produce()
+{
+  try
+  {
+    for (uint32_t record_idx = 0;; ++record_idx)
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _not_full.wait(lock, [this]() { return _stop or _queue.size() < _queue_size; });
+        if (_stop)
+          break;
+      }
+
+      // Read outside of the lock so that consumers are not blocked by I/O
+      if (not _iter->hasNext())
+        break;
+
+      auto record = _iter->next();
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.emplace_back(record_idx, std::move(record));
+      }
+      _not_empty.notify_one();
+    }
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _error = std::current_exception();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _not_empty.notify_all();
+}
+
+bool PrefetchIterator::hasNext() const
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _not_empty.wait(lock, [this]() { return not _queue.empty() or _done or _stop; });
+
+  // Let the next pop() report the error
+  return not _queue.empty() or _error != nullptr;
+}
+
+std::vector<DataBuffer> PrefetchIterator::next()
+{
+  std::vector<DataBuffer> record;
+  if (not pop(record))
+    throw std::runtime_error("No more record in the dataset");
+
+  return record;
+}
+
+bool PrefetchIterator::pop(std::vector<DataBuffer> &record)
+{
+  uint32_t record_idx = 0;
+  return pop(record, record_idx);
+}
+
+bool PrefetchIterator::pop(std::vector<DataBuffer> &record, uint32_t &record_idx)
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _not_empty.wait(lock, [this]() { return not _queue.empty() or _done or _stop; });
+
+    if (_stop)
+      return false;
+
+    if (_queue.empty())
+    {
+      assert(_done);
+      if (_error != nullptr)
+        std::rethrow_exception(_error);
+
+      return false;
+    }
+
+    record_idx = _queue.front().first;
+    record = std::move(_queue.front().second);
+    _queue.pop_front();
+  }
+  _not_full.notify_one();
+
+  return true;
+}
+
+bool PrefetchIterator::check_type_shape() const { return _check_type_shape; }
+
+} // namespace record_minmax
@@ -28,7 +28,14 @@
 #include <luci/CircleFileExpContract.h>
 #include <luci/Log.h>
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 using Shape = std::vector<loco::Dimension>;
 using DataType = loco::DataType;
@@ -36,16 +43,8 @@ using DataType = loco::DataType;
 namespace
 {
 
-// Max h5 file size for parallel recording in bytes = 1 GB
-const long h5_max_size_bytes = 1000000000;
-
-long getH5FileSize(const std::string &input_data_path)
-{
-  std::ifstream in_file(input_data_path, std::ios::binary);
-  in_file.seekg(0, std::ios::end);
-
-  return in_file.tellg();
-}
+// Maximum number of records prefetched per interpreter
+const uint32_t prefetch_records_per_thread = 4;
 
 /**
  * @brief  verifyTypeShape checks the type and the shape of CircleInput
@@ -67,6 +66,106 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
   }
 }
 
+/**
+ * @brief  writeRecord writes a record to the input tensors of interpreter
+ *         This throws an exception if the record does not match the inputs
+ */
+void writeRecord(luci_interpreter::Interpreter *interpreter,
+                 const std::vector<loco::Node *> &input_nodes,
+                 const std::vector<record_minmax::DataBuffer> &record, bool check_type_shape)
+{
+  const auto num_inputs = input_nodes.size();
+  if (num_inputs != record.size())
+    throw std::runtime_error("Wrong number of inputs.");
+
+  for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+  {
+    const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+    assert(input_node->index() == input_idx);
+
+    const auto &input_data = record.at(input_idx);
+
+    if (check_type_shape)
+    {
+      // Check the type and the shape of the input data is valid
+      verifyTypeShape(input_node, input_data.dtype, input_data.shape);
+    }
+
+    interpreter->writeInputTensor(input_node, input_data.data.data(), input_data.data.size());
+  }
+}
+
+struct ThreadStat
+{
+  uint32_t num_records = 0;
+  // Time spent on writing inputs and interpretation
+  std::chrono::duration<double> busy{0};
+  // Time from the start to the end of the thread
+  std::chrono::duration<double> elapsed{0};
+};
+
+/**
+ * @brief  printThreadStats prints throughput of each thread and of all threads
+ *         This is used to size the number of threads of a calibration job
+ */
+void printThreadStats(const std::vector<ThreadStat> &stats)
+{
+  double max_elapsed = 0.0;
+  uint32_t num_records = 0;
+  for (uint32_t t = 0; t < stats.size(); ++t)
+  {
+    const auto &stat = stats[t];
+    const double elapsed = stat.elapsed.count();
+    const double busy = stat.busy.count();
+
+    std::cout << "Thread " << t << ": " << stat.num_records << " records, " << std::fixed
+              << std::setprecision(2) << (busy > 0 ? stat.num_records / busy : 0.0)
+              << " records/s, busy " << (elapsed > 0 ? busy * 100.0 / elapsed : 0.0) << "%"
+              << std::defaultfloat << std::endl;
+
+    max_elapsed = std::max(max_elapsed, elapsed);
+    num_records += stat.num_records;
+  }
+
+  std::cout << "Total throughput: " << std::fixed << std::setprecision(2)
+            << (max_elapsed > 0 ? num_records / max_elapsed : 0.0) << " records/s"
+            << std::defaultfloat << std::endl;
+}
+
+/**
+ * @brief  OrderedMinMax records min/max of records to a map in the order of records,
+ *         while the records are finished by multiple threads in any order
+ */
+class OrderedMinMax
+{
+public:
+  explicit OrderedMinMax(record_minmax::MinMaxMap *map) : _map(map)
+  {
+    assert(_map != nullptr); // FIX_CALLER_UNLESS
+  }
+
+  // Keep 'list' of 'record_idx', and record all lists which are ready in order
+  void record(uint32_t record_idx, record_minmax::NodeMinMaxList &&list)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.emplace(record_idx, std::move(list));
+
+    while (not _pending.empty() and _pending.begin()->first == _next_idx)
+    {
+      _map->recordMinMax(_pending.begin()->second);
+      _pending.erase(_pending.begin());
+      _next_idx++;
+    }
+  }
+
+private:
+  std::mutex _mutex;
+  record_minmax::MinMaxMap *_map = nullptr;
+  // Lists of records finished before a previous record
+  std::map<uint32_t, record_minmax::NodeMinMaxList> _pending;
+  uint32_t _next_idx = 0;
+};
+
 } // namespace
 
 namespace record_minmax
@@ -91,7 +190,7 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    auto observer = std::make_unique<MinMaxObserver>(_minmax_computer.get());
 
     interpreter->attachObserver(observer.get());
 
@@ -100,64 +199,6 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
 }
 
-WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
-{
-  try
-  {
-    dio::hdf5::HDF5Importer importer(input_data_path);
-    importer.importGroup("value");
-
-    bool is_raw_data = importer.isRawData();
-
-    const auto num_records = importer.numData();
-    if (num_records == 0)
-      throw std::runtime_error("The input data file does not contain any record.");
-
-    const auto input_nodes = loco::input_nodes(_module->graph());
-    const auto num_inputs = input_nodes.size();
-
-    WholeOutput whole_output(num_records);
-
-    // Read inputs to whole_output
-    for (int i = 0; i < num_records; ++i)
-    {
-      if (num_inputs != static_cast<uint32_t>(importer.numInputs(i)))
-        throw std::runtime_error("Wrong number of inputs.");
-
-      for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
-      {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-        assert(input_node->index() == input_idx);
-        checkInputDimension(input_node);
-        Buffer input_data(getTensorSize(input_node));
-
-        if (!is_raw_data)
-        {
-          DataType dtype;
-          Shape shape;
-          importer.readTensor(i, input_idx, &dtype, &shape, input_data.data(), input_data.size());
-
-          // Check the type and the shape of the input data is valid
-          verifyTypeShape(input_node, dtype, shape);
-        }
-        else
-        {
-          // Skip type/shape check for raw data
-          importer.readTensor(i, input_idx, input_data.data(), input_data.size());
-        }
-        whole_output[i].emplace_back(std::move(input_data));
-      }
-    }
-
-    return whole_output;
-  }
-  catch (const H5::Exception &e)
-  {
-    H5::Exception::printErrorStack();
-    throw std::runtime_error("HDF5 error occurred.");
-  }
-}
-
 std::unique_ptr<DataSetIterator> RecordMinMax::createIterator()
 {
   assert(_data_set_format != DataSetFormat::UNKNOWN); // FIX_CALLER_UNLESS
@@ -187,6 +228,13 @@ std::unique_ptr<DataSetIterator> RecordMinMax::createIterator()
   return iterator;
 }
 
+std::unique_ptr<PrefetchIterator> RecordMinMax::createPrefetchIterator()
+{
+  const uint32_t queue_size = prefetch_records_per_thread * _threads_size;
+
+  return std::make_unique<PrefetchIterator>(createIterator(), queue_size);
+}
+
 void RecordMinMax::profileData()
 {
   assert(getDataSetFormat() != DataSetFormat::UNKNOWN); // FIX_CALLER_UNLESS
@@ -198,9 +246,7 @@ void RecordMinMax::profileData()
     checkInputDimension(input_cnode);
   }
 
-  const auto num_inputs = input_nodes.size();
-
-  auto iter = createIterator();
+  auto iter = createPrefetchIterator();
 
   bool check_type_shape = iter->check_type_shape();
 
@@ -208,32 +254,12 @@ void RecordMinMax::profileData()
     throw std::runtime_error("The input data file does not contain any record.");
 
   uint32_t record_idx = 0;
-  while (iter->hasNext())
+  std::vector<DataBuffer> record;
+  while (iter->pop(record))
   {
-    const auto &record = iter->next();
-
-    if (num_inputs != record.size())
-      throw std::runtime_error("Wrong number of inputs.");
-
     std::cout << "Recording " << record_idx << "'th data" << std::endl;
 
-    // Write input data to interpreter
-    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
-    {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
-
-      const auto input_data = record.at(input_idx);
-
-      if (check_type_shape)
-      {
-        // Check the type and the shape of the input data is valid
-        verifyTypeShape(input_node, input_data.dtype, input_data.shape);
-      }
-
-      getInterpreter()->writeInputTensor(input_node, input_data.data.data(),
-                                         input_data.data.size());
-    }
+    writeRecord(getInterpreter(), input_nodes, record, check_type_shape);
 
     getInterpreter()->interpret();
 
@@ -242,93 +268,105 @@ void RecordMinMax::profileData()
 
   std::cout << "Recording finished. Number of recorded data: " << record_idx << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  _minmax_computer->update_qparam(*getObserver()->minMaxData()->getMap());
 }
 
-void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
+void RecordMinMax::profileDataInParallel()
 {
   LOGGER(l);
 
+  assert(getDataSetFormat() != DataSetFormat::UNKNOWN); // FIX_CALLER_UNLESS
   assert(_interpreters.size() == _threads_size);
   assert(_observers.size() == _threads_size);
 
-  const long h5_file_size = getH5FileSize(input_data_path);
-
-  if (h5_file_size > h5_max_size_bytes)
-    throw std::runtime_error("H5 file size is too large for parallel recording");
-
-  WholeOutput whole_output;
-  try
-  {
-    whole_output = importH5Data(input_data_path);
-  }
-  catch (const std::bad_alloc &e)
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  for (auto input_node : input_nodes)
   {
-    throw std::runtime_error("Out of memory during h5 data load.");
+    const auto *input_cnode = loco::must_cast<const luci::CircleInput *>(input_node);
+    checkInputDimension(input_cnode);
   }
 
-  const auto num_records = whole_output.size();
-  const auto input_nodes = loco::input_nodes(_module->graph());
+  // Records are streamed to the threads, so the whole dataset is never loaded in memory
+  auto iter = createPrefetchIterator();
 
-  // Start parallel part
-  INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
+  const bool check_type_shape = iter->check_type_shape();
 
-  const auto run_threads = num_records < _threads_size ? num_records : _threads_size;
+  if (not iter->hasNext())
+    throw std::runtime_error("The input data file does not contain any record.");
 
-  const auto records_batch = static_cast<uint32_t>(num_records / run_threads);
+  // Start parallel part
+  INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
 
-  auto interpret_batch = [&whole_output, &input_nodes](int first_record, int last_record,
-                                                       luci_interpreter::Interpreter *interpreter) {
-    for (int record_index = first_record; record_index < last_record; ++record_index)
+  // Threads take records from the queue whenever they are free, so a slow record does not
+  // stall the others. Accumulators like moving average depend on the order of records, so
+  // min/max of each record is collected by its thread and recorded in the order of records.
+  // This gives the same result as profileData() for any number of threads.
+  MinMaxMap minmax_map(_minmax_computer.get());
+  OrderedMinMax ordered_minmax(&minmax_map);
+
+  std::vector<ThreadStat> stats(_threads_size);
+  std::vector<std::exception_ptr> errors(_threads_size);
+
+  auto interpret_records = [&](uint32_t thread_idx) {
+    auto interpreter = _interpreters[thread_idx].get();
+    auto observer = _observers[thread_idx].get();
+    auto &stat = stats[thread_idx];
+    const auto start = std::chrono::steady_clock::now();
+
+    NodeMinMaxList minmax_list;
+    observer->collectTo(&minmax_list);
+    try
     {
-      for (uint32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
+      std::vector<DataBuffer> record;
+      uint32_t record_idx = 0;
+      while (iter->pop(record, record_idx))
       {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+        const auto begin = std::chrono::steady_clock::now();
 
-        const auto &cur_input_data = whole_output[record_index][input_idx];
-        interpreter->writeInputTensor(input_node, cur_input_data.data(), cur_input_data.size());
+        writeRecord(interpreter, input_nodes, record, check_type_shape);
+        interpreter->interpret();
+
+        stat.busy += std::chrono::steady_clock::now() - begin;
+        stat.num_records++;
+
+        ordered_minmax.record(record_idx, std::move(minmax_list));
+        minmax_list.clear();
       }
-      interpreter->interpret();
     }
+    catch (...)
+    {
+      errors[thread_idx] = std::current_exception();
+      // Stop the others, which may be waiting for records
+      iter->stop();
+    }
+    observer->collectTo(nullptr);
+    stat.elapsed = std::chrono::steady_clock::now() - start;
   };
 
   std::vector<std::thread> threads;
-  for (uint32_t t = 0; t < run_threads; ++t)
-  {
-    if (t < run_threads - 1)
-    {
-      threads.emplace_back(interpret_batch, records_batch * t, records_batch * (t + 1),
-                           _interpreters[t].get());
-    }
-    else
-    {
-      threads.emplace_back(interpret_batch, records_batch * t, num_records, _interpreters[t].get());
-    }
-  }
+  for (uint32_t t = 0; t < _threads_size; ++t)
+    threads.emplace_back(interpret_records, t);
 
-  for (uint32_t i = 0; i < run_threads; ++i)
-    threads.at(i).join();
+  for (auto &thread : threads)
+    thread.join();
 
   // End parallel part
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
-
-  for (const auto &obs : _observers)
+  for (const auto &error : errors)
   {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
-    {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
-
-      main_min_max_map.appendMinMaxVector(node, minmax);
-    }
+    if (error != nullptr)
+      std::rethrow_exception(error);
   }
 
+  uint32_t num_records = 0;
+  for (const auto &stat : stats)
+    num_records += stat.num_records;
+
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(main_min_max_map.getMap());
+  printThreadStats(stats);
+
+  _minmax_computer->update_qparam(*minmax_map.getMap());
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingStats.h"
+#include "RecordFunction.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+QuantileSketch::QuantileSketch(uint32_t capacity) : _capacity(capacity)
+{
+  if (_capacity < 16)
+    throw std::invalid_argument("QuantileSketch capacity must be at least 16");
+
+  _centroids.reserve(_capacity + 1);
+}
+
+void QuantileSketch::add(float value)
+{
+  if (std::isnan(value))
+    return;
+
+  if (_count == 0)
+  {
+    _min = value;
+    _max = value;
+  }
+  else
+  {
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+  }
+
+  _centroids.push_back({value, 1.0});
+  _count++;
+
+  if (_centroids.size() > _capacity)
+    compress();
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+  if (other._count == 0)
+    return;
+
+  if (_count == 0)
+  {
+    _min = other._min;
+    _max = other._max;
+  }
+  else
+  {
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+  }
+
+  _centroids.insert(_centroids.end(), other._centroids.begin(), other._centroids.end());
+  _count += other._count;
+  _exact = _exact and other._exact;
+
+  if (_centroids.size() > _capacity)
+    compress();
+}
+
+// Merge neighboring centroids while the merged weight does not exceed the t-digest size limit
+// Centroids near the tails are allowed to be small, so that small/large percentiles are accurate.
+void QuantileSketch::compress()
+{
+  std::sort(_centroids.begin(), _centroids.end(),
+            [](const Centroid &a, const Centroid &b) { return a.mean < b.mean; });
+
+  const double total = static_cast<double>(_count);
+  const double compression = static_cast<double>(_capacity) / 16.0;
+
+  std::vector<Centroid> merged;
+  merged.reserve(_capacity + 1);
+  merged.push_back(_centroids.front());
+
+  // Sum of weights before merged.back()
+  double cumulative = 0.0;
+  for (size_t i = 1; i < _centroids.size(); ++i)
+  {
+    auto &last = merged.back();
+    const auto &curr = _centroids[i];
+
+    const double weight = last.weight + curr.weight;
+    const double q = (cumulative + weight / 2.0) / total;
+    const double limit = 4.0 * total * q * (1.0 - q) / compression;
+
+    if (weight <= limit)
+    {
+      last.mean += (curr.mean - last.mean) * curr.weight / weight;
+      last.weight = weight;
+    }
+    else
+    {
+      cumulative += last.weight;
+      merged.push_back(curr);
+    }
+  }
+
+  _centroids = std::move(merged);
+  _exact = false;
+}
+
+float QuantileSketch::percentile(float percentile) const
+{
+  if (percentile < 0 || percentile > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (_count == 0)
+    throw std::runtime_error("Percentile must take a non-empty sketch as an argument");
+
+  if (_exact)
+  {
+    std::vector<float> values;
+    values.reserve(_centroids.size());
+    for (const auto &c : _centroids)
+      values.push_back(static_cast<float>(c.mean));
+
+    return getNthPercentile(values, percentile);
+  }
+
+  if (percentile == 0.0)
+    return _min;
+
+  if (percentile == 100.0)
+    return _max;
+
+  auto sorted = _centroids;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const Centroid &a, const Centroid &b) { return a.mean < b.mean; });
+
+  const double target = static_cast<double>(_count) * percentile / 100.0;
+
+  // Interpolate linearly between the centers (cumulative weight at the middle) of centroids
+  double prev_center = 0.0;
+  double prev_mean = _min;
+  double cumulative = 0.0;
+  for (const auto &c : sorted)
+  {
+    const double center = cumulative + c.weight / 2.0;
+    if (target < center)
+    {
+      const double fraction = (target - prev_center) / (center - prev_center);
+      return static_cast<float>(prev_mean + fraction * (c.mean - prev_mean));
+    }
+    prev_center = center;
+    prev_mean = c.mean;
+    cumulative += c.weight;
+  }
+
+  const double fraction = (target - prev_center) / (cumulative - prev_center);
+  return static_cast<float>(prev_mean + fraction * (_max - prev_mean));
+}
+
+MovingAverage::MovingAverage(float alpha, uint32_t batch_size, bool is_min)
+  : _alpha(alpha), _batch_size(batch_size), _is_min(is_min)
+{
+  if (alpha < 0.0 || alpha > 1.0)
+    throw std::invalid_argument("Alpha of moving average must be ranged from 0 to 1");
+
+  if (batch_size == 0)
+    throw std::invalid_argument("Batch size of moving average must be positive");
+}
+
+void MovingAverage::add(float value)
+{
+  if (_pending == 0)
+    _batch_value = value;
+  else if (_is_min)
+    _batch_value = value < _batch_value ? value : _batch_value;
+  else
+    _batch_value = value > _batch_value ? value : _batch_value;
+
+  _pending++;
+
+  if (_pending == _batch_size)
+    flush();
+}
+
+void MovingAverage::flush()
+{
+  if (_pending == 0)
+    return;
+
+  if (not _initialized)
+  {
+    _first = _batch_value;
+    _avg = _batch_value;
+    _initialized = true;
+  }
+  else
+  {
+    _avg = _avg * _alpha + _batch_value * (1.0 - _alpha);
+    _num_updates++;
+  }
+
+  _pending = 0;
+}
+
+// Let b_1 .. b_m be batch values of other. Continuing this stream with them gives
+//   avg' = avg * alpha^m + sum_i (b_i * (1 - alpha) * alpha^(m-i))
+// and other.avg = b_1 * alpha^(m-1) + sum_{i>1} (b_i * (1 - alpha) * alpha^(m-i)), so
+//   avg' = alpha^m * (avg - b_1) + other.avg
+void MovingAverage::merge(const MovingAverage &other)
+{
+  assert(_alpha == other._alpha);           // FIX_CALLER_UNLESS
+  assert(_is_min == other._is_min);         // FIX_CALLER_UNLESS
+  assert(_batch_size == other._batch_size); // FIX_CALLER_UNLESS
+
+  MovingAverage rhs = other;
+  rhs.flush();
+
+  if (not rhs._initialized)
+    return;
+
+  flush();
+
+  if (not _initialized)
+  {
+    *this = rhs;
+    return;
+  }
+
+  const auto num_batches = rhs._num_updates + 1;
+  const double decay = std::pow(static_cast<double>(_alpha), static_cast<double>(num_batches));
+  _avg = static_cast<float>(decay * (_avg - rhs._first) + rhs._avg);
+  _num_updates += num_batches;
+}
+
+float MovingAverage::value() const
+{
+  if (empty())
+    throw std::runtime_error("Moving average of an empty stream is not defined");
+
+  MovingAverage copy = *this;
+  copy.flush();
+  return copy._avg;
+}
+
+} // namespace record_minmax
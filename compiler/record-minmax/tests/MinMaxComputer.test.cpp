@@ -73,3 +73,64 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, percentile_accumulator)
+{
+  auto computer = make_percentile_computer(0.0, 100.0);
+
+  luci::CircleAdd node;
+  MinMaxAccumulatorMap accumulator_map;
+  {
+    auto accumulator = computer->create_accumulator();
+    accumulator->record(1.0, 4.0);
+    accumulator->record(-2.0, 3.0);
+
+    auto other = computer->create_accumulator();
+    other->record(0.5, 6.0);
+    accumulator->merge(*other);
+
+    accumulator_map[&node] = std::move(accumulator);
+  }
+
+  computer->update_qparam(accumulator_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(-2.0, node.quantparam()->min[0]);
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, moving_avg_accumulator)
+{
+  auto computer = make_moving_avg_computer(1, 0.5);
+
+  luci::CircleAdd node;
+  MinMaxAccumulatorMap accumulator_map;
+  {
+    auto accumulator = computer->create_accumulator();
+    accumulator->record(1.0, 4.0);
+    accumulator->record(3.0, 6.0);
+    accumulator_map[&node] = std::move(accumulator);
+  }
+
+  computer->update_qparam(accumulator_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(2.0, node.quantparam()->min[0]);
+  EXPECT_FLOAT_EQ(5.0, node.quantparam()->max[0]);
+}
+
+TEST(MinMaxComputerTest, vector_size_mismatch_NEG)
+{
+  auto computer = make_percentile_computer(0.0, 100.0);
+
+  luci::CircleAdd node;
+  MinMaxVectors minmax;
+  {
+    minmax.min_vector = {1.0, 2.0};
+    minmax.max_vector = {4.0};
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  min_max_map.insert({&node, minmax});
+
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PrefetchIterator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+namespace
+{
+
+// Iterator generating 'num_data' records, each having a single byte of its index
+class FakeIterator final : public DataSetIterator
+{
+public:
+  FakeIterator(uint32_t num_data, bool throw_at_end = false)
+    : _num_data(num_data), _throw_at_end(throw_at_end)
+  {
+  }
+
+  bool hasNext() const override { return _throw_at_end or _curr_idx < _num_data; }
+
+  std::vector<DataBuffer> next() override
+  {
+    if (_curr_idx == _num_data)
+      throw std::runtime_error("Failed to read");
+
+    DataBuffer buf;
+    buf.data.push_back(static_cast<char>(_curr_idx++));
+    return {buf};
+  }
+
+  bool check_type_shape() const override { return true; }
+
+private:
+  uint32_t _num_data = 0;
+  bool _throw_at_end = false;
+  uint32_t _curr_idx = 0;
+};
+
+} // namespace
+
+TEST(PrefetchIteratorTest, in_order)
+{
+  PrefetchIterator iter(std::make_unique<FakeIterator>(10), 2);
+
+  EXPECT_TRUE(iter.check_type_shape());
+
+  uint32_t idx = 0;
+  while (iter.hasNext())
+  {
+    auto record = iter.next();
+    ASSERT_EQ(1, record.size());
+    EXPECT_EQ(idx++, static_cast<uint32_t>(record[0].data[0]));
+  }
+  EXPECT_EQ(10, idx);
+}
+
+TEST(PrefetchIteratorTest, multiple_consumers)
+{
+  PrefetchIterator iter(std::make_unique<FakeIterator>(100), 4);
+
+  std::atomic<uint32_t> count{0};
+  auto consume = [&]() {
+    std::vector<DataBuffer> record;
+    while (iter.pop(record))
+      count++;
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < 4; ++i)
+    threads.emplace_back(consume);
+  for (auto &t : threads)
+    t.join();
+
+  EXPECT_EQ(100, count);
+}
+
+TEST(PrefetchIteratorTest, record_index)
+{
+  PrefetchIterator iter(std::make_unique<FakeIterator>(100), 6);
+
+  std::vector<std::vector<uint32_t>> indices(3);
+  auto consume = [&](uint32_t consumer) {
+    std::vector<DataBuffer> record;
+    uint32_t record_idx = 0;
+    while (iter.pop(record, record_idx))
+    {
+      EXPECT_EQ(record_idx, static_cast<uint32_t>(record[0].data[0]));
+      indices[consumer].push_back(record_idx);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < 3; ++i)
+    threads.emplace_back(consume, i);
+  for (auto &t : threads)
+    t.join();
+
+  // Each record is taken by exactly one consumer
+  std::vector<uint32_t> all;
+  for (const auto &consumer_indices : indices)
+    all.insert(all.end(), consumer_indices.begin(), consumer_indices.end());
+  std::sort(all.begin(), all.end());
+
+  ASSERT_EQ(100, all.size());
+  for (uint32_t i = 0; i < all.size(); ++i)
+    EXPECT_EQ(i, all[i]);
+}
+
+TEST(PrefetchIteratorTest, stop)
+{
+  PrefetchIterator iter(std::make_unique<FakeIterator>(100), 2);
+
+  std::vector<DataBuffer> record;
+  EXPECT_TRUE(iter.pop(record));
+
+  iter.stop();
+
+  EXPECT_FALSE(iter.pop(record));
+}
+
+TEST(PrefetchIteratorTest, error_NEG)
+{
+  PrefetchIterator iter(std::make_unique<FakeIterator>(1, true), 2);
+
+  std::vector<DataBuffer> record;
+  EXPECT_TRUE(iter.pop(record));
+  EXPECT_THROW(iter.pop(record), std::runtime_error);
+}
+
+TEST(PrefetchIteratorTest, zero_queue_NEG)
+{
+  EXPECT_THROW(PrefetchIterator(std::make_unique<FakeIterator>(1), 0), std::invalid_argument);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StreamingStats.h"
+#include "RecordFunction.h"
+
+#include <vector>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+using namespace record_minmax;
+
+TEST(QuantileSketchTest, exact)
+{
+  std::vector<float> input{8.5, -3.25, 65.5, 0.0, 17.75, 99.0, 16.5, 25.0, -74.5, 29.5};
+
+  QuantileSketch sketch;
+  for (auto v : input)
+    sketch.add(v);
+
+  EXPECT_TRUE(sketch.exact());
+  EXPECT_EQ(input.size(), sketch.count());
+  for (float p : {0.0f, 1.0f, 3.14f, 50.0f, 99.0f, 100.0f})
+    EXPECT_FLOAT_EQ(getNthPercentile(input, p), sketch.percentile(p));
+}
+
+TEST(QuantileSketchTest, compressed)
+{
+  const uint32_t num_values = 100000;
+
+  QuantileSketch sketch(256);
+  for (uint32_t i = 0; i < num_values; ++i)
+    sketch.add(static_cast<float>((i * 7919) % num_values));
+
+  EXPECT_FALSE(sketch.exact());
+  EXPECT_LE(sketch.size(), 256);
+  EXPECT_EQ(num_values, sketch.count());
+
+  EXPECT_FLOAT_EQ(0.0f, sketch.percentile(0));
+  EXPECT_FLOAT_EQ(num_values - 1, sketch.percentile(100));
+  // Error is relative to the range of values
+  EXPECT_NEAR(num_values * 0.01, sketch.percentile(1), num_values * 0.001);
+  EXPECT_NEAR(num_values * 0.5, sketch.percentile(50), num_values * 0.01);
+  EXPECT_NEAR(num_values * 0.99, sketch.percentile(99), num_values * 0.001);
+}
+
+TEST(QuantileSketchTest, merge)
+{
+  QuantileSketch sketch1(64);
+  QuantileSketch sketch2(64);
+  for (uint32_t i = 0; i < 1000; ++i)
+  {
+    sketch1.add(static_cast<float>(i));
+    sketch2.add(static_cast<float>(i + 1000));
+  }
+
+  sketch1.merge(sketch2);
+
+  EXPECT_EQ(2000, sketch1.count());
+  EXPECT_FLOAT_EQ(0.0f, sketch1.percentile(0));
+  EXPECT_FLOAT_EQ(1999.0f, sketch1.percentile(100));
+  EXPECT_NEAR(1000.0f, sketch1.percentile(50), 40.0f);
+}
+
+TEST(QuantileSketchTest, empty_NEG)
+{
+  QuantileSketch sketch;
+
+  EXPECT_THROW(sketch.percentile(50), std::runtime_error);
+}
+
+TEST(QuantileSketchTest, out_of_boundary_NEG)
+{
+  QuantileSketch sketch;
+  sketch.add(1.0);
+
+  EXPECT_THROW(sketch.percentile(-1), std::runtime_error);
+  EXPECT_THROW(sketch.percentile(101), std::runtime_error);
+}
+
+TEST(MovingAverageTest, same_as_vector)
+{
+  std::vector<float> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  MovingAverage min_avg(0.5, 4, true);
+  MovingAverage max_avg(0.5, 4, false);
+  for (auto v : input)
+  {
+    min_avg.add(v);
+    max_avg.add(v);
+  }
+
+  EXPECT_FLOAT_EQ(getMovingAverage(input, 0.5, 4, true), min_avg.value());
+  EXPECT_FLOAT_EQ(getMovingAverage(input, 0.5, 4, false), max_avg.value());
+}
+
+TEST(MovingAverageTest, merge)
+{
+  std::vector<float> input{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8};
+
+  MovingAverage whole(0.9, 2, false);
+  MovingAverage first(0.9, 2, false);
+  MovingAverage second(0.9, 2, false);
+  for (uint32_t i = 0; i < input.size(); ++i)
+  {
+    whole.add(input[i]);
+    if (i < 6)
+      first.add(input[i]);
+    else
+      second.add(input[i]);
+  }
+
+  first.merge(second);
+
+  EXPECT_NEAR(whole.value(), first.value(), 1e-5);
+}
+
+TEST(MovingAverageTest, empty_NEG)
+{
+  MovingAverage avg(0.5, 4, true);
+
+  EXPECT_THROW(avg.value(), std::runtime_error);
+}
+
+TEST(MovingAverageTest, invalid_batch_NEG)
+{
+  EXPECT_THROW(MovingAverage(0.5, 0, true), std::invalid_argument);
+}
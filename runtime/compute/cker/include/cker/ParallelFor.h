@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_PARALLEL_FOR_H__
+#define __NNFW_CKER_PARALLEL_FOR_H__
+
+#include "cker/CpuBackendThreadpool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Rough costs of processing one element, in units of a simple arithmetic operation
+constexpr int64_t kParallelForCostCopy = 1;
+constexpr int64_t kParallelForCostArithmetic = 2;
+constexpr int64_t kParallelForCostIndexed = 8;
+constexpr int64_t kParallelForCostTranscendental = 16;
+
+// Minimum cost assigned to a thread, which amortizes waking it up
+constexpr int64_t kParallelForMinCostPerThread = 1 << 15;
+
+template <typename Fn> struct ParallelForTask : cpu_backend_threadpool::Task
+{
+  ParallelForTask(const Fn &fn, int begin, int end) : _fn{fn}, _begin{begin}, _end{end} {}
+
+  void Run() override { _fn(_begin, _end); }
+
+private:
+  const Fn &_fn;
+  int _begin;
+  int _end;
+};
+
+/**
+ * @brief Run fn(begin, end) on disjoint ranges which cover [0, size) in threads of ruy_context
+ *
+ * The number of threads is chosen so that each thread gets at least
+ * kParallelForMinCostPerThread of work. fn is called once on the calling thread with the whole
+ * range if ruy_context is null or the work is too small to be split.
+ *
+ * @param size          Number of units
+ * @param cost_per_unit Rough cost of one unit (e.g. elements in a row * cost of an element)
+ * @param ruy_context   Context which owns the thread pool, or nullptr to run serially
+ * @param fn            Callable of void(int begin, int end)
+ */
+template <typename Fn>
+inline void ParallelFor(int size, int64_t cost_per_unit, ruy::Context *ruy_context, const Fn &fn)
+{
+  if (size <= 0)
+    return;
+
+  const int64_t max_threads =
+    (ruy_context == nullptr) ? 1 : std::max(1, ruy_context->max_num_threads());
+  const int64_t total_cost = static_cast<int64_t>(size) * std::max<int64_t>(cost_per_unit, 1);
+  const int thread_count = static_cast<int>(
+    std::min({max_threads, static_cast<int64_t>(size), total_cost / kParallelForMinCostPerThread}));
+
+  if (thread_count <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<ParallelForTask<Fn>> tasks;
+  tasks.reserve(thread_count);
+  int begin = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    const int end = begin + (size - begin) / (thread_count - i);
+    tasks.emplace_back(fn, begin, end);
+    begin = end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_PARALLEL_FOR_H__
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -364,6 +365,57 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+// Same as above, but slices along the first dimension of the output are split among threads of
+// ruy_context. Each slice is broadcast by the kernels above with its own broadcast parameters.
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BroadcastBinaryArithmeticOp(const BinaryArithmeticOpParam &params,
+                                        const Shape &input1_shape, const T *input1_data,
+                                        const Shape &input2_shape, const T *input2_data,
+                                        const Shape &output_shape, T *output_data,
+                                        ruy::Context *ruy_context)
+{
+  const int rank = output_shape.DimensionsCount();
+  const int outer_size = rank > 0 ? output_shape.Dims(0) : 1;
+  const int inner_size = rank > 0 ? FlatSizeSkipDim(output_shape, 0) : 1;
+  const Shape extended_input1_shape = Shape::ExtendedShape(rank, input1_shape);
+  const Shape extended_input2_shape = Shape::ExtendedShape(rank, input2_shape);
+
+  // An input broadcast along the first dimension is used as a whole for every slice
+  const auto slice = [](const Shape &shape, const T *data, int begin, int end, Shape *sliced) {
+    sliced->ReplaceWith(shape);
+    if (shape.Dims(0) == 1)
+      return data;
+    sliced->SetDim(0, end - begin);
+    return data + static_cast<size_t>(begin) * FlatSizeSkipDim(shape, 0);
+  };
+
+  ParallelFor(
+    outer_size, inner_size * kParallelForCostArithmetic, ruy_context, [&](int begin, int end) {
+      BinaryArithmeticOpParam slice_params = params;
+      if (begin == 0 && end == outer_size)
+      {
+        BroadcastBinaryArithmeticOp<op_type>(slice_params, input1_shape, input1_data, input2_shape,
+                                             input2_data, output_shape, output_data);
+        return;
+      }
+
+      Shape slice1_shape, slice2_shape, slice_output_shape;
+      const T *slice1_data = slice(extended_input1_shape, input1_data, begin, end, &slice1_shape);
+      const T *slice2_data = slice(extended_input2_shape, input2_data, begin, end, &slice2_shape);
+      slice_output_shape.ReplaceWith(output_shape);
+      slice_output_shape.SetDim(0, end - begin);
+      T *slice_output_data = output_data + static_cast<size_t>(begin) * inner_size;
+
+      if (ProcessBroadcastShapes(slice1_shape, slice2_shape, &slice_params))
+        BroadcastBinaryArithmeticOp<op_type>(slice_params, slice1_shape, slice1_data,
+                                             slice2_shape, slice2_data, slice_output_shape,
+                                             slice_output_data);
+      else
+        BinaryArithmeticOp<op_type>(slice_params, slice1_shape, slice1_data, slice2_shape,
+                                    slice2_data, slice_output_shape, slice_output_data);
+    });
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BLOCK_QUANT_H__
+#define __NNFW_CKER_BLOCK_QUANT_H__
+
+#include "cker/neon/neon_check.h"
+#include "cker/x86/avx2_check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Block quantization types, binary compatible with ggml Q4_0 and Q8_0
+//   Q4_0 : x = (q - 8) * d, q is 4bit unsigned.
+//          Element j is low nibble of qs[j] and element j + 16 is high nibble of qs[j].
+//   Q8_0 : x = q * d, q is 8bit signed.
+// d is IEEE 754 half precision float.
+enum class BlockQuantType
+{
+  Q4_0,
+  Q8_0,
+};
+
+namespace block_quant
+{
+
+constexpr int kBlockSize = 32;
+
+struct BlockQ4_0
+{
+  uint16_t d;
+  uint8_t qs[kBlockSize / 2];
+};
+
+struct BlockQ8_0
+{
+  uint16_t d;
+  int8_t qs[kBlockSize];
+};
+
+static_assert(sizeof(BlockQ4_0) == sizeof(uint16_t) + kBlockSize / 2, "Wrong Q4_0 block size");
+static_assert(sizeof(BlockQ8_0) == sizeof(uint16_t) + kBlockSize, "Wrong Q8_0 block size");
+
+inline size_t RowSize(BlockQuantType type, int elements)
+{
+  const size_t blocks = elements / kBlockSize;
+  return blocks * (type == BlockQuantType::Q4_0 ? sizeof(BlockQ4_0) : sizeof(BlockQ8_0));
+}
+
+inline float FP16ToFP32(uint16_t h)
+{
+  const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+  uint32_t exp = (h >> 10) & 0x1fu;
+  uint32_t mant = h & 0x3ffu;
+
+  uint32_t bits;
+  if (exp == 0)
+  {
+    if (mant == 0)
+    {
+      bits = sign;
+    }
+    else
+    {
+      // subnormal
+      exp = 127 - 15 + 1;
+      while ((mant & 0x400u) == 0)
+      {
+        mant <<= 1;
+        exp--;
+      }
+      bits = sign | (exp << 23) | ((mant & 0x3ffu) << 13);
+    }
+  }
+  else if (exp == 0x1f)
+  {
+    bits = sign | 0x7f800000u | (mant << 13);
+  }
+  else
+  {
+    bits = sign | ((exp + 127 - 15) << 23) | (mant << 13);
+  }
+
+  float f;
+  std::memcpy(&f, &bits, sizeof(f));
+  return f;
+}
+
+// All fp16 values converted to fp32, to keep the conversion out of the kernel loops
+inline const float *FP16ToFP32Table()
+{
+  static const std::vector<float> table = [] {
+    std::vector<float> t(1 << 16);
+    for (uint32_t h = 0; h < t.size(); ++h)
+      t[h] = FP16ToFP32(static_cast<uint16_t>(h));
+    return t;
+  }();
+  return table.data();
+}
+
+// Round to nearest even
+inline uint16_t FP32ToFP16(float f)
+{
+  uint32_t x;
+  std::memcpy(&x, &f, sizeof(x));
+
+  const uint16_t sign = (x >> 16) & 0x8000u;
+  const uint32_t abs = x & 0x7fffffffu;
+
+  // Inf or NaN
+  if (abs >= 0x7f800000u)
+    return sign | 0x7c00u | (abs > 0x7f800000u ? 0x200u : 0u);
+
+  // Overflow to Inf (>= 65520)
+  if (abs >= 0x477ff000u)
+    return sign | 0x7c00u;
+
+  // Subnormal or zero (< 2^-14)
+  if (abs < 0x38800000u)
+  {
+    float v;
+    std::memcpy(&v, &abs, sizeof(v));
+    return sign | static_cast<uint16_t>(std::nearbyint(v * 16777216.0f /* 2^24 */));
+  }
+
+  const uint32_t mant = abs & 0x7fffffu;
+  uint32_t h = (((abs >> 23) - 127 + 15) << 10) | (mant >> 13);
+  const uint32_t rem = mant & 0x1fffu;
+  if (rem > 0x1000u || (rem == 0x1000u && (h & 1u)))
+    h++;
+
+  return sign | static_cast<uint16_t>(h);
+}
+
+// 'k' should be a multiple of kBlockSize
+inline void QuantizeRowQ8_0(const float *x, BlockQ8_0 *y, int k)
+{
+  const int nb = k / kBlockSize;
+  for (int i = 0; i < nb; ++i)
+  {
+    const float *xb = x + i * kBlockSize;
+
+    float amax = 0.0f;
+    for (int j = 0; j < kBlockSize; ++j)
+      amax = std::max(amax, std::fabs(xb[j]));
+
+    const float d = amax / 127.0f;
+    const float id = d != 0.0f ? 1.0f / d : 0.0f;
+
+    y[i].d = FP32ToFP16(d);
+    for (int j = 0; j < kBlockSize; ++j)
+      y[i].qs[j] = static_cast<int8_t>(std::round(xb[j] * id));
+  }
+}
+
+// 'k' should be a multiple of kBlockSize
+inline void QuantizeRowQ4_0(const float *x, BlockQ4_0 *y, int k)
+{
+  const int nb = k / kBlockSize;
+  for (int i = 0; i < nb; ++i)
+  {
+    const float *xb = x + i * kBlockSize;
+
+    // value having the largest magnitude, with its sign
+    float amax = 0.0f;
+    float max = 0.0f;
+    for (int j = 0; j < kBlockSize; ++j)
+    {
+      if (amax < std::fabs(xb[j]))
+      {
+        amax = std::fabs(xb[j]);
+        max = xb[j];
+      }
+    }
+
+    const float d = max / -8.0f;
+    const float id = d != 0.0f ? 1.0f / d : 0.0f;
+
+    y[i].d = FP32ToFP16(d);
+    for (int j = 0; j < kBlockSize / 2; ++j)
+    {
+      const float x0 = xb[j] * id;
+      const float x1 = xb[j + kBlockSize / 2] * id;
+
+      const uint8_t q0 = std::min<int>(15, static_cast<int8_t>(x0 + 8.5f));
+      const uint8_t q1 = std::min<int>(15, static_cast<int8_t>(x1 + 8.5f));
+
+      y[i].qs[j] = q0 | (q1 << 4);
+    }
+  }
+}
+
+inline void DequantizeRowQ4_0(const BlockQ4_0 *x, float *y, int k)
+{
+  const int nb = k / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+  for (int i = 0; i < nb; ++i)
+  {
+    const float d = fp16[x[i].d];
+    float *yb = y + i * kBlockSize;
+    for (int j = 0; j < kBlockSize / 2; ++j)
+    {
+      yb[j] = ((x[i].qs[j] & 0x0f) - 8) * d;
+      yb[j + kBlockSize / 2] = ((x[i].qs[j] >> 4) - 8) * d;
+    }
+  }
+}
+
+inline void DequantizeRowQ8_0(const BlockQ8_0 *x, float *y, int k)
+{
+  const int nb = k / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+  for (int i = 0; i < nb; ++i)
+  {
+    const float d = fp16[x[i].d];
+    float *yb = y + i * kBlockSize;
+    for (int j = 0; j < kBlockSize; ++j)
+      yb[j] = x[i].qs[j] * d;
+  }
+}
+
+#ifdef USE_X86_AVX2_DISPATCH
+// Unpack 32 4bit values into 32 bytes: elements 0~15 from low nibbles, 16~31 from high nibbles
+CKER_TARGET_AVX2 inline __m256i BytesFromNibbles32(const uint8_t *rsi)
+{
+  const __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rsi));
+  const __m256i bytes =
+    _mm256_insertf128_si256(_mm256_castsi128_si256(tmp), _mm_srli_epi16(tmp, 4), 1);
+  return _mm256_and_si256(_mm256_set1_epi8(0x0f), bytes);
+}
+
+// Multiply signed 8bit pairs and sum them into 8 floats
+CKER_TARGET_AVX2 inline __m256 MulSumI8Pairs(const __m256i x, const __m256i y)
+{
+  // maddubs requires unsigned lhs, so move the sign of x to y
+  const __m256i ax = _mm256_sign_epi8(x, x);
+  const __m256i sy = _mm256_sign_epi8(y, x);
+  const __m256i dot = _mm256_maddubs_epi16(ax, sy);
+  const __m256i summed = _mm256_madd_epi16(_mm256_set1_epi16(1), dot);
+  return _mm256_cvtepi32_ps(summed);
+}
+
+CKER_TARGET_AVX2 inline float HorizontalSum(const __m256 x)
+{
+  __m128 res = _mm_add_ps(_mm256_extractf128_ps(x, 1), _mm256_castps256_ps128(x));
+  res = _mm_add_ps(res, _mm_movehl_ps(res, res));
+  res = _mm_add_ss(res, _mm_movehdup_ps(res));
+  return _mm_cvtss_f32(res);
+}
+
+CKER_TARGET_AVX2 inline float VecDotQ4_0Q8_0Avx2(int n, const BlockQ4_0 *x, const BlockQ8_0 *y)
+{
+  const int nb = n / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+
+  __m256 acc = _mm256_setzero_ps();
+  for (int i = 0; i < nb; ++i)
+  {
+    const __m256 d = _mm256_set1_ps(fp16[x[i].d] * fp16[y[i].d]);
+    const __m256i qx = _mm256_sub_epi8(BytesFromNibbles32(x[i].qs), _mm256_set1_epi8(8));
+    const __m256i qy = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y[i].qs));
+    acc = _mm256_fmadd_ps(d, MulSumI8Pairs(qx, qy), acc);
+  }
+  return HorizontalSum(acc);
+}
+
+CKER_TARGET_AVX2 inline float VecDotQ8_0Q8_0Avx2(int n, const BlockQ8_0 *x, const BlockQ8_0 *y)
+{
+  const int nb = n / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+
+  __m256 acc = _mm256_setzero_ps();
+  for (int i = 0; i < nb; ++i)
+  {
+    const __m256 d = _mm256_set1_ps(fp16[x[i].d] * fp16[y[i].d]);
+    const __m256i qx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x[i].qs));
+    const __m256i qy = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(y[i].qs));
+    acc = _mm256_fmadd_ps(d, MulSumI8Pairs(qx, qy), acc);
+  }
+  return HorizontalSum(acc);
+}
+#endif // USE_X86_AVX2_DISPATCH
+
+#ifdef USE_NEON
+inline int32x4_t DotI8x16(int32x4_t acc, const int8x16_t a, const int8x16_t b)
+{
+#if defined(__ARM_FEATURE_DOTPROD)
+  return vdotq_s32(acc, a, b);
+#else
+  const int16x8_t lo = vmull_s8(vget_low_s8(a), vget_low_s8(b));
+  const int16x8_t hi = vmull_s8(vget_high_s8(a), vget_high_s8(b));
+  return vaddq_s32(acc, vaddq_s32(vpaddlq_s16(lo), vpaddlq_s16(hi)));
+#endif
+}
+
+inline float HorizontalSum(const float32x4_t x)
+{
+#if defined(__aarch64__)
+  return vaddvq_f32(x);
+#else
+  const float32x2_t sum = vadd_f32(vget_low_f32(x), vget_high_f32(x));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#endif
+}
+#endif // USE_NEON
+
+// Portable version of VecDotQ4_0Q8_0, using NEON if available
+inline float VecDotQ4_0Q8_0Generic(int n, const BlockQ4_0 *x, const BlockQ8_0 *y)
+{
+  const int nb = n / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+
+#if defined(USE_NEON)
+  float32x4_t acc = vdupq_n_f32(0.0f);
+  const uint8x16_t m4b = vdupq_n_u8(0x0f);
+  const int8x16_t s8b = vdupq_n_s8(8);
+  for (int i = 0; i < nb; ++i)
+  {
+    const uint8x16_t v0 = vld1q_u8(x[i].qs);
+    const int8x16_t lo = vsubq_s8(vreinterpretq_s8_u8(vandq_u8(v0, m4b)), s8b);
+    const int8x16_t hi = vsubq_s8(vreinterpretq_s8_u8(vshrq_n_u8(v0, 4)), s8b);
+
+    const int8x16_t y0 = vld1q_s8(y[i].qs);
+    const int8x16_t y1 = vld1q_s8(y[i].qs + kBlockSize / 2);
+
+    const int32x4_t p = DotI8x16(DotI8x16(vdupq_n_s32(0), lo, y0), hi, y1);
+    acc = vmlaq_n_f32(acc, vcvtq_f32_s32(p), fp16[x[i].d] * fp16[y[i].d]);
+  }
+  return HorizontalSum(acc);
+#else
+  float sum = 0.0f;
+  for (int i = 0; i < nb; ++i)
+  {
+    int32_t sumi = 0;
+    for (int j = 0; j < kBlockSize / 2; ++j)
+    {
+      const int v0 = (x[i].qs[j] & 0x0f) - 8;
+      const int v1 = (x[i].qs[j] >> 4) - 8;
+      sumi += v0 * y[i].qs[j] + v1 * y[i].qs[j + kBlockSize / 2];
+    }
+    sum += sumi * fp16[x[i].d] * fp16[y[i].d];
+  }
+  return sum;
+#endif
+}
+
+// Portable version of VecDotQ8_0Q8_0, using NEON if available
+inline float VecDotQ8_0Q8_0Generic(int n, const BlockQ8_0 *x, const BlockQ8_0 *y)
+{
+  const int nb = n / kBlockSize;
+  const float *fp16 = FP16ToFP32Table();
+
+#if defined(USE_NEON)
+  float32x4_t acc = vdupq_n_f32(0.0f);
+  for (int i = 0; i < nb; ++i)
+  {
+    const int8x16_t x0 = vld1q_s8(x[i].qs);
+    const int8x16_t x1 = vld1q_s8(x[i].qs + kBlockSize / 2);
+    const int8x16_t y0 = vld1q_s8(y[i].qs);
+    const int8x16_t y1 = vld1q_s8(y[i].qs + kBlockSize / 2);
+
+    const int32x4_t p = DotI8x16(DotI8x16(vdupq_n_s32(0), x0, y0), x1, y1);
+    acc = vmlaq_n_f32(acc, vcvtq_f32_s32(p), fp16[x[i].d] * fp16[y[i].d]);
+  }
+  return HorizontalSum(acc);
+#else
+  float sum = 0.0f;
+  for (int i = 0; i < nb; ++i)
+  {
+    int32_t sumi = 0;
+    for (int j = 0; j < kBlockSize; ++j)
+      sumi += x[i].qs[j] * y[i].qs[j];
+    sum += sumi * fp16[x[i].d] * fp16[y[i].d];
+  }
+  return sum;
+#endif
+}
+
+// Dot product of 'n' elements, 'n' should be a multiple of kBlockSize
+inline float VecDotQ4_0Q8_0(int n, const BlockQ4_0 *x, const BlockQ8_0 *y)
+{
+#ifdef USE_X86_AVX2_DISPATCH
+  if (x86::HasAvx2())
+    return VecDotQ4_0Q8_0Avx2(n, x, y);
+#endif
+  return VecDotQ4_0Q8_0Generic(n, x, y);
+}
+
+// Dot product of 'n' elements, 'n' should be a multiple of kBlockSize
+inline float VecDotQ8_0Q8_0(int n, const BlockQ8_0 *x, const BlockQ8_0 *y)
+{
+#ifdef USE_X86_AVX2_DISPATCH
+  if (x86::HasAvx2())
+    return VecDotQ8_0Q8_0Avx2(n, x, y);
+#endif
+  return VecDotQ8_0Q8_0Generic(n, x, y);
+}
+
+} // namespace block_quant
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_BLOCK_QUANT_H__
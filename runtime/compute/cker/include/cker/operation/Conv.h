@@ -23,6 +23,7 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/WinogradConv.h"
 #include <iostream>
 #include <vector>
 
@@ -55,15 +56,26 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+    : _modified_filter_data(), _winograd_filter_data(), _winograd_workspace(), _im2col_data(),
+      _im2col_shape(4), _use_winograd(false), _need_im2col(false), _prepared(false)
+  {
+  }
 
   void prepareF32(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
-                  bool &is_replaced_weights, uint32_t dilationWidthFactor,
-                  uint32_t dilationHeightFactor)
+                  bool &is_replaced_weights, uint32_t strideWidth, uint32_t strideHeight,
+                  uint32_t dilationWidthFactor, uint32_t dilationHeightFactor)
   {
     if (!_prepared)
     {
-      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      if (optimized::IsWinogradConvSupported(filter_shape, strideWidth, strideHeight,
+                                             dilationWidthFactor, dilationHeightFactor))
+      {
+        optimized::TransformWinogradFilter(filter_shape, filter_data, _winograd_filter_data);
+        _use_winograd = true;
+        is_replaced_weights = true;
+      }
+      else if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
       {
         transposeFilter(filter_shape, filter_data, is_replaced_weights);
       }
@@ -87,8 +99,32 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
-                            params.dilation_height_factor))
+    // Keep the workspace over calls so that it is not allocated on every inference
+    const size_t winograd_size =
+      winogradBufferSize(input_shape, filter_shape, output_shape, nullptr);
+    if (_winograd_workspace.size() < winograd_size)
+      _winograd_workspace.resize(winograd_size);
+
+    (*this)(params, input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+            output_shape, output_data, nullptr, _winograd_workspace.data());
+  }
+
+  // ruy_context provides threads for the Winograd kernel, which runs serially if it is null.
+  // winograd_workspace is a workspace of at least winogradBufferSize() bytes for the same
+  // ruy_context, which is owned by the caller
+  void operator()(const ConvParams &params, const Shape &input_shape, const float *input_data,
+                  const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
+                  const float *bias_data, const Shape &output_shape, float *output_data,
+                  ruy::Context *ruy_context, uint8_t *winograd_workspace)
+  {
+    if (_use_winograd)
+    {
+      optimized::WinogradConv(params, input_shape, input_data, filter_shape,
+                              _winograd_filter_data.data(), bias_data, output_shape, output_data,
+                              winograd_workspace, ruy_context);
+    }
+    else if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
+                                 params.dilation_height_factor))
     {
       bool transposed_in_execution = false;
       if (!_prepared)
@@ -109,9 +145,21 @@ public:
     }
   }
 
-  void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
-                  const Shape &filter_shape, const uint8_t *filter_data, const Shape &bias_shape,
-                  const int32_t *bias_data, const Shape &output_shape, uint8_t *output_data)
+  // Returns the size in bytes of Winograd workspace which the float kernel needs, or 0 if the
+  // kernel does not use Winograd.
+  size_t winogradBufferSize(const Shape &input_shape, const Shape &filter_shape,
+                            const Shape &output_shape, ruy::Context *ruy_context) const
+  {
+    if (!_use_winograd)
+      return 0;
+
+    return optimized::WinogradWorkspaceSize(input_shape, filter_shape, output_shape, ruy_context);
+  }
+
+  // Returns the size in bytes of im2col workspace which the quantized kernel needs.
+  // Shapes are used only if the kernel is not prepared.
+  size_t im2colBufferSize(const ConvParams &params, const Shape &input_shape,
+                          const Shape &filter_shape, const Shape &output_shape)
   {
     if (!_prepared)
     {
@@ -121,10 +169,30 @@ public:
                        params.dilation_height_factor);
     }
 
-    int im2col_size = _need_im2col ? _im2col_shape.FlatSize() : 1;
-    std::vector<uint8_t> im2col_data(im2col_size);
+    return _need_im2col ? _im2col_shape.FlatSize() : 0;
+  }
+
+  void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
+                  const Shape &filter_shape, const uint8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, uint8_t *output_data)
+  {
+    // Keep the workspace over calls so that it is not allocated on every inference
+    const size_t im2col_size = im2colBufferSize(params, input_shape, filter_shape, output_shape);
+    if (_im2col_data.size() < im2col_size)
+      _im2col_data.resize(im2col_size);
+
+    (*this)(params, input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+            output_shape, output_data, _im2col_data.data());
+  }
+
+  // im2col_data is a workspace of at least im2colBufferSize() bytes, which is owned by the caller
+  void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
+                  const Shape &filter_shape, const uint8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, uint8_t *output_data,
+                  uint8_t *im2col_data)
+  {
     optimized::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                    bias_data, output_shape, output_data, _im2col_shape, im2col_data.data());
+                    bias_data, output_shape, output_data, _im2col_shape, im2col_data);
   }
 
   void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
@@ -189,7 +257,11 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  std::vector<float> _winograd_filter_data;
+  std::vector<uint8_t> _winograd_workspace;
+  std::vector<uint8_t> _im2col_data;
   Shape _im2col_shape;
+  bool _use_winograd;
   bool _need_im2col;
   bool _prepared;
   // Per channel output multiplier and shift.
@@ -18,9 +18,10 @@
 #ifndef __NNFW_CKER_ELU_H__
 #define __NNFW_CKER_ELU_H__
 
+#include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 
-#include <cmath>
+#include <Eigen/Core>
 
 namespace nnfw
 {
@@ -30,12 +31,9 @@ namespace cker
 inline void ELU(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                 float *output_data)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < flat_size; ++i)
-  {
-    const float val = input_data[i];
-    output_data[i] = val < 0.0 ? std::exp(val) - 1 : val;
-  }
+  const auto input = MapAsVector(input_data, input_shape).array();
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = (input < 0.f).select(input.exp() - 1.f, input);
 }
 
 } // namespace cker
@@ -22,6 +22,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <Eigen/Core>
+#include <limits>
 
 namespace nnfw
 {
@@ -59,11 +60,9 @@ inline void Abs(const Shape &input_shape, const float *input_data, const Shape &
 inline void Rsqrt(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                   float *output_data)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = 1.f / std::sqrt(input_data[i]);
-  }
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = input_map.array().rsqrt();
 }
 
 template <typename T>
@@ -80,11 +79,9 @@ inline void Neg(const Shape &input_shape, const T *input_data, const Shape &outp
 inline void Log(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                 float *output_data)
 {
-  const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = std::log(input_data[i]);
-  }
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = input_map.array().log();
 }
 
 inline void Floor(const Shape &input_shape, const float *input_data, const Shape &output_shape,
@@ -101,12 +98,12 @@ inline void Floor(const Shape &input_shape, const float *input_data, const Shape
 inline void Sqrt(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                  float *output_data)
 {
-  const int flat_size = MatchingFlatSize(input_shape, output_shape);
-
-  for (int i = 0; i < flat_size; i++)
-  {
-    output_data[i] = std::sqrt(input_data[i]);
-  }
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  // Fast math sqrt of Eigen multiplies by an approximate rsqrt, which gives NaN for +inf
+  const auto input = input_map.array();
+  output_map.array() =
+    (input == std::numeric_limits<float>::infinity()).select(input, input.sqrt());
 }
 
 inline void Square(const Shape &input_shape, const float *input_data, const Shape &output_shape,
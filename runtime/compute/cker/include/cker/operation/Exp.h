@@ -18,9 +18,11 @@
 #ifndef __NNFW_CKER_EXP_H__
 #define __NNFW_CKER_EXP_H__
 
+#include "cker/eigen/Utils.h"
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 
-#include <cmath>
+#include <Eigen/Core>
 
 namespace nnfw
 {
@@ -29,12 +31,20 @@ namespace cker
 
 inline void Exp(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                 float *output_data)
+{
+  auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map.array() = input_map.array().exp();
+}
+
+inline void Exp(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                float *output_data, ruy::Context *ruy_context)
 {
   const int size = MatchingFlatSize(input_shape, output_shape);
-  for (int i = 0; i < size; i++)
-  {
-    output_data[i] = std::exp(input_data[i]);
-  }
+  ParallelFor(size, kParallelForCostTranscendental, ruy_context, [&](int begin, int end) {
+    const Shape shape{end - begin};
+    Exp(shape, input_data + begin, shape, output_data + begin);
+  });
 }
 
 } // namespace cker
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_FULLY_CONNECTED_BLOCK_QUANT_H__
+#define __NNFW_CKER_FULLY_CONNECTED_BLOCK_QUANT_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/operation/BlockQuant.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+// Input quantized to Q8_0 blocks, kept between runs to avoid allocation
+struct FCBlockQuantTempArena
+{
+  std::vector<block_quant::BlockQ8_0> quantized_input;
+};
+
+namespace block_quant
+{
+
+// Compute output[:, unit_start:unit_end] with quantized input of 'batches' rows
+inline void FullyConnectedBlockQuantImpl(const FullyConnectedParams &params,
+                                         BlockQuantType weights_type, const uint8_t *weights_data,
+                                         const float *bias_data, const BlockQ8_0 *input_data,
+                                         int batches, int input_size, int num_units,
+                                         float *output_data, int unit_start, int unit_end)
+{
+  const size_t weights_row_size = RowSize(weights_type, input_size);
+  const int input_blocks = input_size / kBlockSize;
+
+  for (int unit = unit_start; unit < unit_end; ++unit)
+  {
+    const uint8_t *weights_row = weights_data + unit * weights_row_size;
+    const float bias = bias_data ? bias_data[unit] : 0.0f;
+
+    for (int b = 0; b < batches; ++b)
+    {
+      const BlockQ8_0 *input_row = input_data + b * input_blocks;
+
+      float dot;
+      if (weights_type == BlockQuantType::Q4_0)
+        dot = VecDotQ4_0Q8_0(input_size, reinterpret_cast<const BlockQ4_0 *>(weights_row),
+                             input_row);
+      else
+        dot = VecDotQ8_0Q8_0(input_size, reinterpret_cast<const BlockQ8_0 *>(weights_row),
+                             input_row);
+
+      output_data[b * num_units + unit] = ActivationFunctionWithMinMax(
+        dot + bias, params.float_activation_min, params.float_activation_max);
+    }
+  }
+}
+
+struct FullyConnectedBlockQuantTask : cpu_backend_threadpool::Task
+{
+  FullyConnectedBlockQuantTask(const FullyConnectedParams &params, BlockQuantType weights_type,
+                               const uint8_t *weights_data, const float *bias_data,
+                               const BlockQ8_0 *input_data, int batches, int input_size,
+                               int num_units, float *output_data, int unit_start, int unit_end)
+    : params_(params), weights_type_(weights_type), weights_data_(weights_data),
+      bias_data_(bias_data), input_data_(input_data), batches_(batches), input_size_(input_size),
+      num_units_(num_units), output_data_(output_data), unit_start_(unit_start),
+      unit_end_(unit_end)
+  {
+  }
+
+  void Run() override
+  {
+    FullyConnectedBlockQuantImpl(params_, weights_type_, weights_data_, bias_data_, input_data_,
+                                 batches_, input_size_, num_units_, output_data_, unit_start_,
+                                 unit_end_);
+  }
+
+private:
+  const FullyConnectedParams &params_;
+  BlockQuantType weights_type_;
+  const uint8_t *weights_data_;
+  const float *bias_data_;
+  const BlockQ8_0 *input_data_;
+  int batches_;
+  int input_size_;
+  int num_units_;
+  float *output_data_;
+  int unit_start_;
+  int unit_end_;
+};
+
+} // namespace block_quant
+
+// FullyConnected with float input and block quantized weights of [num_units, input_size]
+// Input is quantized to Q8_0 and dot products are computed on quantized values, like ggml does.
+inline void FullyConnectedBlockQuant(const FullyConnectedParams &params, const Shape &input_shape,
+                                     const float *input_data, BlockQuantType weights_type,
+                                     const Shape &weights_shape, const uint8_t *weights_data,
+                                     const Shape &, const float *bias_data,
+                                     [[maybe_unused]] const Shape &output_shape,
+                                     float *output_data,
+                                     FCBlockQuantTempArena &temp_arena,
+                                     ruy::Context *ruy_context)
+{
+  using namespace block_quant;
+
+  const int input_size = weights_shape.Dims(weights_shape.DimensionsCount() - 1);
+  const int num_units = weights_shape.Dims(0);
+  const int batches = input_shape.FlatSize() / input_size;
+
+  if (input_size % kBlockSize != 0)
+    throw std::runtime_error{"FullyConnected: input size should be a multiple of block size"};
+  assert(output_shape.FlatSize() == batches * num_units);
+
+  // Quantize input once, to be shared by all the threads
+  auto &quantized_input = temp_arena.quantized_input;
+  quantized_input.resize(batches * input_size / kBlockSize);
+  for (int b = 0; b < batches; ++b)
+    QuantizeRowQ8_0(input_data + b * input_size,
+                    quantized_input.data() + b * input_size / kBlockSize, input_size);
+
+  // NOTE Each thread computes a range of output units, which is the best for GEMV
+  constexpr int kMinUnitsPerThread = 16;
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int thread_count = std::max(1, std::min(max_threads, num_units / kMinUnitsPerThread));
+
+  if (thread_count == 1)
+  {
+    FullyConnectedBlockQuantImpl(params, weights_type, weights_data, bias_data,
+                                 quantized_input.data(), batches, input_size, num_units,
+                                 output_data, 0, num_units);
+    return;
+  }
+
+  std::vector<FullyConnectedBlockQuantTask> tasks;
+  tasks.reserve(thread_count);
+  int unit_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int unit_end = unit_start + (num_units - unit_start) / (thread_count - i);
+    tasks.emplace_back(params, weights_type, weights_data, bias_data, quantized_input.data(),
+                       batches, input_size, num_units, output_data, unit_start, unit_end);
+    unit_start = unit_end;
+  }
+  cpu_backend_threadpool::Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_FULLY_CONNECTED_BLOCK_QUANT_H__
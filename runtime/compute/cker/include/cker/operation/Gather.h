@@ -21,6 +21,9 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/BlockQuant.h"
+
+#include <stdexcept>
 
 namespace nnfw
 {
@@ -67,6 +70,37 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
   }
 }
 
+// Gather rows of block quantized 2D input on axis 0, dequantizing them into float
+template <typename CoordsT>
+inline void GatherBlockQuant(BlockQuantType input_type, const Shape &input_shape,
+                             const uint8_t *input_data, const Shape &coords_shape,
+                             const CoordsT *coords_data, const Shape &, float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  const int axis_size = input_shape.Dims(0);
+  const int row_elements = input_shape.Dims(1);
+  const int coords_count = coords_shape.FlatSize();
+  const size_t row_size = block_quant::RowSize(input_type, row_elements);
+
+  if (row_elements % block_quant::kBlockSize != 0)
+    throw std::runtime_error{"Gather: row size should be a multiple of block size"};
+
+  for (int i = 0; i < coords_count; ++i)
+  {
+    if (coords_data[i] < 0 || coords_data[i] >= axis_size)
+      throw std::runtime_error{"Gather: index is out of range"};
+
+    const uint8_t *row = input_data + coords_data[i] * row_size;
+    float *output_row = output_data + i * row_elements;
+    if (input_type == BlockQuantType::Q4_0)
+      block_quant::DequantizeRowQ4_0(reinterpret_cast<const block_quant::BlockQ4_0 *>(row),
+                                     output_row, row_elements);
+    else
+      block_quant::DequantizeRowQ8_0(reinterpret_cast<const block_quant::BlockQ8_0 *>(row),
+                                     output_row, row_elements);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_LOGISTIC_H__
 #define __NNFW_CKER_LOGISTIC_H__
 
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
@@ -38,6 +39,16 @@ inline void Logistic(const Shape &input_shape, const float *input_data, const Sh
   output_map.array() = input_map.array().unaryExpr(Eigen::internal::scalar_logistic_op<float>());
 }
 
+inline void Logistic(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                     float *output_data, ruy::Context *ruy_context)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  ParallelFor(size, kParallelForCostTranscendental, ruy_context, [&](int begin, int end) {
+    const Shape shape{end - begin};
+    Logistic(shape, input_data + begin, shape, output_data + begin);
+  });
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,11 +18,15 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -114,10 +118,13 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
 }
 #endif // NEON
 
+// If ruy_context is given, rows (reduction along the last axis only) or slices along the first
+// dimension (if it is not reduced) are split among its threads.
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
-                       Out reducer(const Out current, const In in), Out *output_data)
+                       Out reducer(const Out current, const In in), Out *output_data,
+                       ruy::Context *ruy_context = nullptr)
 {
   const auto input_dims = input_shape.DimsData();
   const auto input_num_dims = input_shape.DimensionsCount();
@@ -132,20 +139,45 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
-      {
-        if (r_idx == 0)
-        {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
-        {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
-        }
-      }
-    }
+    ParallelFor(input_size, reduce_size * kParallelForCostCopy, ruy_context,
+                [&](int begin, int end) {
+                  for (int idx = begin; idx < end; idx++)
+                  {
+                    for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+                    {
+                      if (r_idx == 0)
+                      {
+                        output_data[idx] = input_data[idx * reduce_size];
+                      }
+                      else
+                      {
+                        output_data[idx] =
+                          reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+                      }
+                    }
+                  }
+                });
+    return true;
+  }
+
+  // Slices along the first dimension are reduced into different outputs if it is not reduced
+  const bool first_dim_reduced = std::find(axis, axis + num_axis, 0) != axis + num_axis;
+  if (ruy_context != nullptr && input_num_dims > 1 && !first_dim_reduced)
+  {
+    ParallelFor(input_dims[0], FlatSizeSkipDim(input_shape, 0) * kParallelForCostIndexed,
+                ruy_context, [&](int begin, int end) {
+                  std::vector<int> iter(input_num_dims, 0);
+                  iter[0] = begin;
+                  do
+                  {
+                    size_t input_offset =
+                      ReducedOutputOffset(input_num_dims, input_dims, iter.data(), 0, nullptr);
+                    size_t output_offset =
+                      ReducedOutputOffset(input_num_dims, input_dims, iter.data(), num_axis, axis);
+                    output_data[output_offset] =
+                      reducer(output_data[output_offset], input_data[input_offset]);
+                  } while (NextIndex(input_num_dims, input_dims, iter.data()) && iter[0] < end);
+                });
     return true;
   }
 
@@ -250,7 +282,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -266,7 +299,8 @@ public:
     }
 
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
-                            num_resolved_axis, temp_index_data(), reducer, output_data);
+                            num_resolved_axis, temp_index_data(), reducer, output_data,
+                            ruy_context);
   }
 
   // Computes the mean of elements across dimensions given in axis.
@@ -278,7 +312,8 @@ public:
                                  int32_t output_zero_point, float output_scale,
                                  const Shape &output_shape, const std::vector<int> &axes,
                                  bool /*keep_dims*/, U *temp_sum, bool compute_sum,
-                                 U reducer(const U current, const T in))
+                                 U reducer(const U current, const T in),
+                                 ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     size_t num_outputs = 1;
@@ -306,7 +341,7 @@ public:
     }
 
     if (!ReduceImpl<T, U>(input_data, input_shape, output_shape, resolved_axis_data(),
-                          num_resolved_axis, temp_index_data(), reducer, temp_sum))
+                          num_resolved_axis, temp_index_data(), reducer, temp_sum, ruy_context))
     {
       return false;
     }
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RESIZEBILINEAR_H__
 #define __NNFW_CKER_RESIZEBILINEAR_H__
 
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <cmath>
@@ -66,26 +67,36 @@ inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t
   }
 }
 
-inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
-                              int32_t depth, int32_t output_height, int32_t output_width,
-                              const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
+// Upsample the input rows [row_begin, row_end), counted across batches, to two output rows each
+inline void ResizeBilinear2x2Rows(int32_t row_begin, int32_t row_end, int32_t input_height,
+                                  int32_t input_width, int32_t depth, int32_t output_width,
+                                  const Shape &input_shape, const float *input_data,
+                                  const Shape &output_shape, float *output_data)
 {
-  for (int b = 0; b < batches; b++)
+  for (int row = row_begin; row < row_end; row++)
   {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
+    const int b = row / input_height;
+    const int y0 = row % input_height;
+    const int y = 2 * y0;
+    for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
     {
-      for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
-      {
-        int32_t x1 = std::min(x0 + 1, input_width - 1);
-        int32_t y1 = std::min(y0 + 1, input_height - 1);
-        ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
-                                output_shape, output_data);
-      }
+      int32_t x1 = std::min(x0 + 1, input_width - 1);
+      int32_t y1 = std::min(y0 + 1, input_height - 1);
+      ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
+                              output_shape, output_data);
     }
   }
 }
 
+inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
+                              int32_t depth, int32_t, int32_t output_width,
+                              const Shape &input_shape, const float *input_data,
+                              const Shape &output_shape, float *output_data)
+{
+  ResizeBilinear2x2Rows(0, batches * input_height, input_height, input_width, depth, output_width,
+                        input_shape, input_data, output_shape, output_data);
+}
+
 inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
                                  float *output_ptr)
 {
@@ -115,58 +126,71 @@ inline void ComputeInterpolationValues(const float value, const float scale,
   *upper_bound = std::min(static_cast<int32_t>(std::ceil(*scaled_value)), input_size - 1);
 }
 
-inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t input_width,
-                                  int32_t depth, int32_t output_height, int32_t output_width,
-                                  float height_scale, float width_scale, const Shape &input_shape,
-                                  const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+// Resize the output rows [row_begin, row_end), counted across batches
+inline void ResizeBilinearGenericRows(int32_t row_begin, int32_t row_end, int32_t input_height,
+                                      int32_t input_width, int32_t depth, int32_t output_height,
+                                      int32_t output_width, float height_scale, float width_scale,
+                                      const Shape &input_shape, const float *input_data,
+                                      float *output_data, const bool half_pixel_centers)
 {
-  memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
+  const int32_t row_size = output_width * depth;
+  memset(output_data + row_begin * row_size, 0, (row_end - row_begin) * row_size * sizeof(float));
 
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
+  int32_t output_offset = row_begin * row_size;
+  for (int row = row_begin; row < row_end; ++row)
   {
-    for (int y = 0; y < output_height; ++y)
+    const int b = row / output_height;
+    const int y = row % output_height;
+
+    float input_y;
+    int32_t y0, y1;
+    ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
+                               &y1);
+    for (int x = 0; x < output_width; ++x)
     {
-      float input_y;
-      int32_t y0, y1;
-      ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
-                                 &y1);
-      for (int x = 0; x < output_width; ++x)
-      {
-        float input_x;
-        int32_t x0, x1;
-        ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
-                                   &x1);
-        float *output_ptr = &output_data[output_offset];
-
-        // Run kernel on the 4 corners of the bilinear resize algorithm.
-        int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
-        float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
-        const float *input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y0, x1, 0);
-        scale = (1 - (input_y - y0)) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x0, 0);
-        scale = (input_y - y0) * (1 - (input_x - x0));
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        input_offset = Offset(input_shape, b, y1, x1, 0);
-        scale = (input_y - y0) * (input_x - x0);
-        input_ptr = &input_data[input_offset];
-        ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
-
-        output_offset += depth;
-      }
+      float input_x;
+      int32_t x0, x1;
+      ComputeInterpolationValues(x, width_scale, half_pixel_centers, input_width, &input_x, &x0,
+                                 &x1);
+      float *output_ptr = &output_data[output_offset];
+
+      // Run kernel on the 4 corners of the bilinear resize algorithm.
+      int32_t input_offset = Offset(input_shape, b, y0, x0, 0);
+      float scale = (1 - (input_y - y0)) * (1 - (input_x - x0));
+      const float *input_ptr = &input_data[input_offset];
+      ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+      input_offset = Offset(input_shape, b, y0, x1, 0);
+      scale = (1 - (input_y - y0)) * (input_x - x0);
+      input_ptr = &input_data[input_offset];
+      ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+      input_offset = Offset(input_shape, b, y1, x0, 0);
+      scale = (input_y - y0) * (1 - (input_x - x0));
+      input_ptr = &input_data[input_offset];
+      ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+      input_offset = Offset(input_shape, b, y1, x1, 0);
+      scale = (input_y - y0) * (input_x - x0);
+      input_ptr = &input_data[input_offset];
+      ResizeBilinearKernel(input_ptr, depth, scale, output_ptr);
+
+      output_offset += depth;
     }
   }
 }
 
+inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t input_width,
+                                  int32_t depth, int32_t output_height, int32_t output_width,
+                                  float height_scale, float width_scale, const Shape &input_shape,
+                                  const float *input_data, float *output_data,
+                                  const bool half_pixel_centers)
+{
+  ResizeBilinearGenericRows(0, batches * output_height, input_height, input_width, depth,
+                            output_height, output_width, height_scale, width_scale, input_shape,
+                            input_data, output_data, half_pixel_centers);
+}
+
 template <typename T>
 inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_height,
                                               int32_t input_width, int32_t depth,
@@ -210,8 +234,10 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
   }
 }
 
+// If ruy_context is given, output rows are split among its threads
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
   int32_t input_height = input_shape.Dims(1);
@@ -222,8 +248,11 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
   if (!params.align_corners && !params.half_pixel_centers &&
       params.output_height == 2 * input_height && params.output_width == 2 * input_width)
   {
-    ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+    const int64_t row_cost = 2 * params.output_width * depth * kParallelForCostArithmetic;
+    ParallelFor(batches * input_height, row_cost, ruy_context, [&](int begin, int end) {
+      ResizeBilinear2x2Rows(begin, end, input_height, input_width, depth, params.output_width,
+                            input_shape, input_data, output_shape, output_data);
+    });
   }
   else
   {
@@ -238,9 +267,13 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
       width_scale = static_cast<float>(input_width - 1) / (params.output_width - 1);
     }
 
-    ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
-                          params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+    // Each output element accumulates 4 corners
+    const int64_t row_cost = params.output_width * depth * 4 * kParallelForCostArithmetic;
+    ParallelFor(batches * params.output_height, row_cost, ruy_context, [&](int begin, int end) {
+      ResizeBilinearGenericRows(begin, end, input_height, input_width, depth, params.output_height,
+                                params.output_width, height_scale, width_scale, input_shape,
+                                input_data, output_data, params.half_pixel_centers);
+    });
   }
 }
 
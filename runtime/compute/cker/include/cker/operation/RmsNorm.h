@@ -20,8 +20,9 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/eigen/Utils.h"
 
-#include <cmath>
+#include <Eigen/Core>
 #include <stdexcept>
 
 namespace nnfw
@@ -33,70 +34,27 @@ inline void RmsNorm(const RmsNormParams &params, const Shape &input_shape, const
                     const Shape &gamma_shape, const float *gamma_data, const Shape &output_shape,
                     float *output_data)
 {
-  bool single_gamma = gamma_shape.DimensionsCount() == 1 && gamma_shape.Dims(0) == 1;
+  const bool single_gamma = gamma_shape.DimensionsCount() == 1 && gamma_shape.Dims(0) == 1;
 
-  if (input_shape.DimensionsCount() == 4)
-  {
-    const int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
-    const int32_t heights = MatchingDim(input_shape, 1, output_shape, 1);
-    const int32_t widths = MatchingDim(input_shape, 2, output_shape, 2);
-    const int32_t channels = MatchingDim(input_shape, 3, output_shape, 3);
-
-    for (int32_t batch = 0; batch < batches; batch++)
-    {
-      for (int32_t height = 0; height < heights; height++)
-      {
-        for (int32_t width = 0; width < widths; width++)
-        {
-          // normalize over last-axis
-          double square_sum = 0.0f;
-          for (int32_t channel = 0; channel < channels; channel++)
-          {
-            double input_val = input_data[Offset(input_shape, batch, height, width, channel)];
-            square_sum += (input_val * input_val);
-          }
-          double rms = std::sqrt((square_sum / channels) + params.epsilon);
-          for (int32_t channel = 0; channel < channels; channel++)
-          {
-            double gamma = (single_gamma ? gamma_data[0] : gamma_data[channel]);
-            output_data[Offset(output_shape, batch, height, width, channel)] =
-              gamma * (input_data[Offset(input_shape, batch, height, width, channel)] / rms);
-          }
-        }
-      }
-    }
-  }
-  else if (input_shape.DimensionsCount() == 3)
-  {
-    const int32_t heights = MatchingDim(input_shape, 0, output_shape, 0);
-    const int32_t widths = MatchingDim(input_shape, 1, output_shape, 1);
-    const int32_t channels = MatchingDim(input_shape, 2, output_shape, 2);
-
-    for (int32_t height = 0; height < heights; height++)
-    {
-      for (int32_t width = 0; width < widths; width++)
-      {
-        // normalize over last-axis
-        double square_sum = 0.0f;
-        for (int32_t channel = 0; channel < channels; channel++)
-        {
-          double input_val = input_data[(height * widths + width) * channels + channel];
-          square_sum += (input_val * input_val);
-        }
-        double rms = std::sqrt((square_sum / channels) + params.epsilon);
-        for (int32_t channel = 0; channel < channels; channel++)
-        {
-          double gamma = (single_gamma ? gamma_data[0] : gamma_data[channel]);
-          output_data[(height * widths + width) * channels + channel] =
-            gamma * (input_data[(height * widths + width) * channels + channel] / rms);
-        }
-      }
-    }
-  }
-  else
+  const int dims_count = input_shape.DimensionsCount();
+  if (dims_count != 3 && dims_count != 4)
   {
     throw std::runtime_error("cker::RmsNorm: Unsupported input shape");
   }
+  MatchingFlatSize(input_shape, output_shape);
+  const int channels = MatchingDim(input_shape, dims_count - 1, output_shape, dims_count - 1);
+
+  // Each column is a vector to be normalized over last-axis
+  const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
+  auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
+
+  const Eigen::Array<float, 1, Eigen::Dynamic> inv_rms =
+    (in_mat.array().square().colwise().mean() + params.epsilon).rsqrt();
+  out_mat.array() = in_mat.array().rowwise() * inv_rms;
+  if (single_gamma)
+    out_mat.array() *= gamma_data[0];
+  else
+    out_mat.array().colwise() *= Eigen::Map<const Eigen::ArrayXf>(gamma_data, channels);
 }
 
 } // namespace cker
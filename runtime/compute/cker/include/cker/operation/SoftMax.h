@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
@@ -84,28 +85,15 @@ inline void Softmax(const float *in, const int input_size, const int batch_size,
   // For each batch
   for (int b = 0; b < batch_size; b++)
   {
-    // Find the max coeff.
-    float max_coeff = in[0];
-    for (int i = 1; i < input_size; i++)
-    {
-      if (in[i] > max_coeff)
-        max_coeff = in[i];
-    }
+    const Eigen::Map<const Eigen::ArrayXf> in_array(in, input_size);
+    Eigen::Map<Eigen::ArrayXf> out_array(out, input_size);
 
-    // Compute the normalized sum of exps.
-    float exp_sum = 0.0;
-    for (int i = 0; i < input_size; i++)
-    {
-      out[i] = std::exp((in[i] - max_coeff) * beta);
-      exp_sum += out[i];
-    }
+    // Compute exps with the max coeff removed for numerical stability.
+    const float max_coeff = in_array.maxCoeff();
+    out_array = ((in_array - max_coeff) * beta).exp();
 
     // Divide by the sum of exps.
-    float reciprocal_sum_exp = 1.f / exp_sum;
-    for (int i = 0; i < input_size; i++)
-    {
-      out[i] *= reciprocal_sum_exp;
-    }
+    out_array *= 1.f / out_array.sum();
 
     // Advance in and out pointers for the next batch.
     in += input_size;
@@ -113,6 +101,17 @@ inline void Softmax(const float *in, const int input_size, const int batch_size,
   }
 }
 
+// Same as above, but batches are split among threads of ruy_context
+inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
+                    float *out, ruy::Context *ruy_context)
+{
+  ParallelFor(batch_size, input_size * kParallelForCostTranscendental, ruy_context,
+              [&](int begin, int end) {
+                Softmax(in + begin * input_size, input_size, end - begin, beta,
+                        out + begin * input_size);
+              });
+}
+
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
                     const Shape &output_shape, float *output_data)
 {
@@ -131,6 +130,22 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   out_mat.array().rowwise() *= scale;
 }
 
+// Same as above, but rows along the last dimension are split among threads of ruy_context
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
+                    const Shape &output_shape, float *output_data, ruy::Context *ruy_context)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  ParallelFor(outer_size, depth * kParallelForCostTranscendental, ruy_context,
+              [&](int begin, int end) {
+                const Shape shape{end - begin, depth};
+                Softmax(params, shape, input_data + begin * depth, shape,
+                        output_data + begin * depth);
+              });
+}
+
 template <typename T> inline int32_t QuantizeSoftmaxOutput(float prob_rescaled, int32_t zero_point)
 {
   const int32_t prob_rnd = static_cast<int32_t>(std::round(prob_rescaled));
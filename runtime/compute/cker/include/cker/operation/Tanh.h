@@ -19,6 +19,7 @@
 #define __NNFW_CKER_TANH_H__
 
 #include "cker/eigen/Utils.h"
+#include "cker/ParallelFor.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <Eigen/Core>
@@ -36,6 +37,16 @@ inline void Tanh(const Shape &input_shape, const float *input_data, const Shape
   output_map.array() = input_map.array().tanh();
 }
 
+inline void Tanh(const Shape &input_shape, const float *input_data, const Shape &output_shape,
+                 float *output_data, ruy::Context *ruy_context)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  ParallelFor(size, kParallelForCostTranscendental, ruy_context, [&](int begin, int end) {
+    const Shape shape{end - begin};
+    Tanh(shape, input_data + begin, shape, output_data + begin);
+  });
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -22,6 +22,7 @@
 #include <limits>
 #include <utility>
 #include "cker/neon/neon_check.h"
+#include "cker/x86/avx2_check.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
@@ -440,6 +441,12 @@ struct BinaryOpFuncAddFloat
     return vaddq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_add_ps(a, b);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float calculate(const float a, const float b) { return a + b; }
 };
 
@@ -451,6 +458,12 @@ struct BinaryOpFuncSubFloat
     return vsubq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_sub_ps(a, b);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float calculate(const float a, const float b) { return a - b; }
 };
 
@@ -462,6 +475,12 @@ struct BinaryOpFuncMulFloat
     return vmulq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_mul_ps(a, b);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float calculate(const float a, const float b) { return a * b; }
 };
 
@@ -475,6 +494,12 @@ struct BinaryOpFuncDivFloat
   }
 #endif // __aarch64__
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_div_ps(a, b);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float calculate(const float a, const float b) { return a / b; }
 };
 
@@ -484,6 +509,12 @@ template <class BASEOPERATOR> struct BinaryOpFuncSwapArgs
   {
     return BASEOPERATOR::calculate(b, a);
   }
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return BASEOPERATOR::calculate(b, a);
+  }
+#endif // USE_X86_AVX2_DISPATCH
 };
 
 struct BinaryOpActivationFloatNone
@@ -500,6 +531,16 @@ struct BinaryOpActivationFloatNone
     return value;
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value, const __m256 &)
+  {
+    return value;
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &)
+  {
+    return value;
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -525,6 +566,16 @@ struct BinaryOpActivationFloatMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value, const __m256 &)
+  {
+    return value;
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -548,6 +599,17 @@ struct BinaryOpActivationFloatMinMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_AVX2_DISPATCH
+  CKER_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value,
+                                                     const __m256 &ceilingParam)
+  {
+    return _mm256_min_ps(value, ceilingParam);
+  }
+  CKER_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+#endif // USE_X86_AVX2_DISPATCH
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     return std::min(value, ceilingParam);
@@ -667,24 +729,102 @@ inline void BinaryOpScalarBroadcast(int size, const BinaryArithmeticOpParam &par
   }
 }
 
+#ifdef USE_X86_AVX2_DISPATCH
+// AVX2 versions of BinaryOpElementwise and BinaryOpScalarBroadcast, used if the CPU supports AVX2
+template <class OPERATOR, class ACTIVATION>
+CKER_TARGET_AVX2 inline void
+BinaryOpElementwiseAvx2(int size, const BinaryArithmeticOpParam &params, const float *input1_data,
+                        const float *input2_data, float *output_data)
+{
+  int i = 0;
+  const auto activation_min = _mm256_set1_ps(params.float_activation_min);
+  const auto activation_max = _mm256_set1_ps(params.float_activation_max);
+  for (; i <= size - 16; i += 16)
+  {
+    auto x0 =
+      OPERATOR::calculate(_mm256_loadu_ps(input1_data + i), _mm256_loadu_ps(input2_data + i));
+    auto x1 = OPERATOR::calculate(_mm256_loadu_ps(input1_data + i + 8),
+                                  _mm256_loadu_ps(input2_data + i + 8));
+    x0 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x0, activation_min), activation_max);
+    x1 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x1, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x0);
+    _mm256_storeu_ps(output_data + i + 8, x1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    auto x =
+      OPERATOR::calculate(_mm256_loadu_ps(input1_data + i), _mm256_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  for (; i < size; i++)
+  {
+    auto x = OPERATOR::calculate(input1_data[i], input2_data[i]);
+    output_data[i] = ACTIVATION::applyCeiling(
+      ACTIVATION::applyFloor(x, params.float_activation_min), params.float_activation_max);
+  }
+}
+
+template <class OPERATOR, class ACTIVATION>
+CKER_TARGET_AVX2 inline void
+BinaryOpScalarBroadcastAvx2(int size, const BinaryArithmeticOpParam &params,
+                            const float broadcast_value, const float *input2_data,
+                            float *output_data)
+{
+  int i = 0;
+  const auto activation_min = _mm256_set1_ps(params.float_activation_min);
+  const auto activation_max = _mm256_set1_ps(params.float_activation_max);
+  const auto broadcast_value_dup = _mm256_set1_ps(broadcast_value);
+  for (; i <= size - 16; i += 16)
+  {
+    auto x0 = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i));
+    auto x1 = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i + 8));
+    x0 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x0, activation_min), activation_max);
+    x1 = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x1, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x0);
+    _mm256_storeu_ps(output_data + i + 8, x1);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    auto x = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  for (; i < size; i++)
+  {
+    auto x = OPERATOR::calculate(broadcast_value, input2_data[i]);
+    output_data[i] = ACTIVATION::applyCeiling(
+      ACTIVATION::applyFloor(x, params.float_activation_min), params.float_activation_max);
+  }
+}
+#endif // USE_X86_AVX2_DISPATCH
+
 using BinaryOpImplFloatFuncs =
   std::pair<void (*)(int, const BinaryArithmeticOpParam &, const float *, const float *, float *),
             void (*)(int, const BinaryArithmeticOpParam &, const float, const float *, float *)>;
 
+template <class FUNC, class ACTIVATION> inline BinaryOpImplFloatFuncs getBinaryOpImplFloat()
+{
+#ifdef USE_X86_AVX2_DISPATCH
+  if (x86::HasAvx2())
+    return BinaryOpImplFloatFuncs(BinaryOpElementwiseAvx2<FUNC, ACTIVATION>,
+                                  BinaryOpScalarBroadcastAvx2<FUNC, ACTIVATION>);
+#endif // USE_X86_AVX2_DISPATCH
+  return BinaryOpImplFloatFuncs(BinaryOpElementwise<FUNC, ACTIVATION>,
+                                BinaryOpScalarBroadcast<FUNC, ACTIVATION>);
+}
+
 template <class FUNC>
 inline BinaryOpImplFloatFuncs
 getBinaryOpWithActivationImplFloat(const BinaryArithmeticOpParam &params)
 {
   if (params.float_activation_max == std::numeric_limits<float>::max())
     if (params.float_activation_min == std::numeric_limits<float>::lowest())
-      return BinaryOpImplFloatFuncs(BinaryOpElementwise<FUNC, BinaryOpActivationFloatNone>,
-                                    BinaryOpScalarBroadcast<FUNC, BinaryOpActivationFloatNone>);
+      return getBinaryOpImplFloat<FUNC, BinaryOpActivationFloatNone>();
     else
-      return BinaryOpImplFloatFuncs(BinaryOpElementwise<FUNC, BinaryOpActivationFloatMax>,
-                                    BinaryOpScalarBroadcast<FUNC, BinaryOpActivationFloatMax>);
+      return getBinaryOpImplFloat<FUNC, BinaryOpActivationFloatMax>();
   else
-    return BinaryOpImplFloatFuncs(BinaryOpElementwise<FUNC, BinaryOpActivationFloatMinMax>,
-                                  BinaryOpScalarBroadcast<FUNC, BinaryOpActivationFloatMinMax>);
+    return getBinaryOpImplFloat<FUNC, BinaryOpActivationFloatMinMax>();
 }
 
 template <typename T>
@@ -22,6 +22,7 @@
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
+#include "cker/x86/avx2_check.h"
 
 namespace nnfw
 {
@@ -1012,6 +1013,52 @@ inline void FloatDepthwiseConvAccumRowGeneric(int stride, int dilation_factor, i
   }
 }
 
+#ifdef USE_X86_AVX2_DISPATCH
+// AVX2 version of FloatDepthwiseConvAccumRowGeneric for depth_multiplier == 1, any stride.
+// Accumulates 8 channels at a time with FMA, used if the CPU supports AVX2.
+CKER_TARGET_AVX2 inline void
+FloatDepthwiseConvAccumRowAvx2(int stride, int dilation_factor, int input_depth, int input_width,
+                               const float *input_data, int pad_width, int depth_multiplier,
+                               int filter_width, const float *filter_data, int out_x_buffer_start,
+                               int out_x_buffer_end, int output_depth, float *acc_buffer)
+{
+  assert(depth_multiplier == 1);
+  (void)depth_multiplier;
+  const float *filter_base_ptr = filter_data;
+  for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+  {
+    const int out_x_loop_start =
+      std::max(out_x_buffer_start, (pad_width - dilation_factor * filter_x + stride - 1) / stride);
+    const int out_x_loop_end =
+      std::min(out_x_buffer_end,
+               (pad_width + input_width - dilation_factor * filter_x + stride - 1) / stride);
+
+    float *acc_buffer_ptr = acc_buffer + (out_x_loop_start - out_x_buffer_start) * output_depth;
+    const int in_x_origin = (out_x_loop_start * stride) - pad_width + dilation_factor * filter_x;
+    const float *input_ptr = input_data + in_x_origin * input_depth;
+    const int input_ptr_increment = stride * input_depth;
+    for (int out_x = out_x_loop_start; out_x < out_x_loop_end; out_x++)
+    {
+      int ic = 0;
+      for (; ic <= input_depth - 8; ic += 8)
+      {
+        const __m256 acc = _mm256_fmadd_ps(_mm256_loadu_ps(filter_base_ptr + ic),
+                                           _mm256_loadu_ps(input_ptr + ic),
+                                           _mm256_loadu_ps(acc_buffer_ptr + ic));
+        _mm256_storeu_ps(acc_buffer_ptr + ic, acc);
+      }
+      for (; ic < input_depth; ++ic)
+      {
+        acc_buffer_ptr[ic] += filter_base_ptr[ic] * input_ptr[ic];
+      }
+      acc_buffer_ptr += output_depth;
+      input_ptr += input_ptr_increment;
+    }
+    filter_base_ptr += output_depth;
+  }
+}
+#endif // USE_X86_AVX2_DISPATCH
+
 // Initializes the accumulator buffer with bias values.
 inline void DepthwiseConvInitAccBuffer(int num_output_pixels, int output_depth,
                                        const float *bias_data, float *acc_buffer)
@@ -1118,6 +1165,13 @@ inline void DepthwiseConvImpl(const DepthwiseConvParams &params, const Shape &in
 
 #undef TFMINI_USE_DEPTHWISECONV_KERNEL
 
+#ifdef USE_X86_AVX2_DISPATCH
+  if (!row_accum_func && depth_multiplier == 1 && x86::HasAvx2())
+  {
+    row_accum_func = FloatDepthwiseConvAccumRowAvx2;
+  }
+#endif // USE_X86_AVX2_DISPATCH
+
   // No matching fast kernel found, use slow fallback.
   if (!row_accum_func)
   {
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/ParallelFor.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+// Float Conv with 3x3 filter, stride 1 and no dilation by Winograd F(2x2, 3x3)
+//
+// Each 2x2 output tile is computed from a 4x4 input tile d as
+//   Y = A^T [(G g G^T) . (B^T d B)] A
+// which takes 16 multiplications per pair of input and output channels instead of 36.
+// Products of a block of tiles are summed over input channels by 16 independent GEMMs.
+
+constexpr int kWinogradInputTile = 4;
+constexpr int kWinogradOutputTile = 2;
+constexpr int kWinogradTileElements = kWinogradInputTile * kWinogradInputTile;
+
+// Transforming tiles costs more than it saves if there are only a few channels
+constexpr int kWinogradMinDepth = 8;
+
+inline bool IsWinogradConvSupported(const Shape &filter_shape, uint32_t stride_width,
+                                    uint32_t stride_height, uint32_t dilation_width_factor,
+                                    uint32_t dilation_height_factor)
+{
+  return filter_shape.DimensionsCount() == 4 && filter_shape.Dims(1) == 3 &&
+         filter_shape.Dims(2) == 3 && filter_shape.Dims(0) >= kWinogradMinDepth &&
+         filter_shape.Dims(3) >= kWinogradMinDepth && stride_width == 1 && stride_height == 1 &&
+         dilation_width_factor == 1 && dilation_height_factor == 1;
+}
+
+// Transform OHWI filter into 16 row-major matrices of [input_depth x output_depth]
+inline void TransformWinogradFilter(const Shape &filter_shape, const float *filter_data,
+                                    std::vector<float> &transformed)
+{
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+  transformed.resize(kWinogradTileElements * input_depth * output_depth);
+
+  for (int oc = 0; oc < output_depth; ++oc)
+  {
+    for (int ic = 0; ic < input_depth; ++ic)
+    {
+      float g[3][3];
+      for (int y = 0; y < 3; ++y)
+        for (int x = 0; x < 3; ++x)
+          g[y][x] = filter_data[Offset(filter_shape, oc, y, x, ic)];
+
+      // t = G g
+      float t[4][3];
+      for (int x = 0; x < 3; ++x)
+      {
+        t[0][x] = g[0][x];
+        t[1][x] = 0.5f * (g[0][x] + g[1][x] + g[2][x]);
+        t[2][x] = 0.5f * (g[0][x] - g[1][x] + g[2][x]);
+        t[3][x] = g[2][x];
+      }
+
+      // u = t G^T
+      for (int y = 0; y < 4; ++y)
+      {
+        const float u[4] = {t[y][0], 0.5f * (t[y][0] + t[y][1] + t[y][2]),
+                            0.5f * (t[y][0] - t[y][1] + t[y][2]), t[y][2]};
+        for (int x = 0; x < 4; ++x)
+          transformed[((y * 4 + x) * input_depth + ic) * output_depth + oc] = u[x];
+      }
+    }
+  }
+}
+
+// Number of tiles transformed at once, which keeps a block of transformed tiles in cache
+inline int WinogradTileBlockSize(int input_depth, int output_depth)
+{
+  return std::max(1, std::min(128, (1 << 14) / (input_depth + output_depth)));
+}
+
+// Number of floats of workspace for each slot, which processes one block of tiles at a time
+inline size_t WinogradSlotSize(int block_size, int input_depth, int output_depth)
+{
+  // Transformed input and output of a block, and a tile being transformed
+  return kWinogradTileElements * block_size * (input_depth + output_depth) +
+         kWinogradTileElements * std::max(input_depth, output_depth);
+}
+
+// Number of slots, which run on different threads of ruy_context
+inline int WinogradNumSlots(int num_blocks, ruy::Context *ruy_context)
+{
+  const int max_threads =
+    (ruy_context == nullptr) ? 1 : std::max(1, ruy_context->max_num_threads());
+  return std::min(max_threads, num_blocks);
+}
+
+inline int WinogradNumTiles(const Shape &output_shape)
+{
+  const int tiles_y = (output_shape.Dims(1) + kWinogradOutputTile - 1) / kWinogradOutputTile;
+  const int tiles_x = (output_shape.Dims(2) + kWinogradOutputTile - 1) / kWinogradOutputTile;
+  return output_shape.Dims(0) * tiles_y * tiles_x;
+}
+
+// Returns the size in bytes of workspace which WinogradConv needs
+inline size_t WinogradWorkspaceSize(const Shape &input_shape, const Shape &filter_shape,
+                                    const Shape &output_shape, ruy::Context *ruy_context)
+{
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int block_size = WinogradTileBlockSize(input_depth, output_depth);
+  const int num_blocks = (WinogradNumTiles(output_shape) + block_size - 1) / block_size;
+  return WinogradNumSlots(num_blocks, ruy_context) *
+         WinogradSlotSize(block_size, input_depth, output_depth) * sizeof(float);
+}
+
+/**
+ * @brief Run Winograd F(2x2, 3x3) Conv
+ *
+ * @param transformed_filter Filter transformed by TransformWinogradFilter
+ * @param workspace          Buffer of at least WinogradWorkspaceSize() bytes
+ * @param ruy_context        Context whose threads process blocks of tiles, or nullptr
+ */
+inline void WinogradConv(const ConvParams &params, const Shape &input_shape,
+                         const float *input_data, const Shape &filter_shape,
+                         const float *transformed_filter, const float *bias_data,
+                         const Shape &output_shape, float *output_data, uint8_t *workspace,
+                         ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+
+  const int tiles_y = (output_height + kWinogradOutputTile - 1) / kWinogradOutputTile;
+  const int tiles_x = (output_width + kWinogradOutputTile - 1) / kWinogradOutputTile;
+  const int tiles_per_batch = tiles_y * tiles_x;
+  const int num_tiles = batches * tiles_per_batch;
+  if (num_tiles == 0)
+    return;
+
+  const int block_size = WinogradTileBlockSize(input_depth, output_depth);
+  const int num_blocks = (num_tiles + block_size - 1) / block_size;
+  // Each slot has its own part of workspace and processes every num_slots-th block
+  const int num_slots = WinogradNumSlots(num_blocks, ruy_context);
+  const size_t input_block_size = kWinogradTileElements * block_size * input_depth;
+  const size_t output_block_size = kWinogradTileElements * block_size * output_depth;
+  const size_t slot_size = WinogradSlotSize(block_size, input_depth, output_depth);
+  float *workspace_data = reinterpret_cast<float *>(workspace);
+
+  using Matrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  const auto run_block = [&](int block, float *transformed_input, float *transformed_output,
+                             float *tile_buffer) {
+    const int tile_begin = block * block_size;
+    const int tile_count = std::min(block_size, num_tiles - tile_begin);
+
+    // Transform input tiles: v = B^T d B
+    float *d = tile_buffer;
+    for (int t = 0; t < tile_count; ++t)
+    {
+      const int tile = tile_begin + t;
+      const int b = tile / tiles_per_batch;
+      const int in_y_origin = (tile % tiles_per_batch) / tiles_x * kWinogradOutputTile - pad_height;
+      const int in_x_origin = (tile % tiles_x) * kWinogradOutputTile - pad_width;
+
+      // Gather the tile into d[16][input_depth], filling paddings with zeros
+      for (int y = 0; y < 4; ++y)
+      {
+        for (int x = 0; x < 4; ++x)
+        {
+          const int in_y = in_y_origin + y;
+          const int in_x = in_x_origin + x;
+          float *dst = d + (y * 4 + x) * input_depth;
+          if (in_y >= 0 && in_y < input_height && in_x >= 0 && in_x < input_width)
+            std::memcpy(dst, input_data + Offset(input_shape, b, in_y, in_x, 0),
+                        input_depth * sizeof(float));
+          else
+            std::fill(dst, dst + input_depth, 0.f);
+        }
+      }
+
+      // Columns first: bd = B^T d, then rows: v = bd B
+      for (int x = 0; x < 4; ++x)
+      {
+        float *d0 = d + x * input_depth;
+        float *d1 = d0 + 4 * input_depth;
+        float *d2 = d1 + 4 * input_depth;
+        float *d3 = d2 + 4 * input_depth;
+        for (int c = 0; c < input_depth; ++c)
+        {
+          const float v0 = d0[c] - d2[c];
+          const float v1 = d1[c] + d2[c];
+          const float v2 = d2[c] - d1[c];
+          const float v3 = d1[c] - d3[c];
+          d0[c] = v0;
+          d1[c] = v1;
+          d2[c] = v2;
+          d3[c] = v3;
+        }
+      }
+      for (int y = 0; y < 4; ++y)
+      {
+        const float *d0 = d + y * 4 * input_depth;
+        const float *d1 = d0 + input_depth;
+        const float *d2 = d1 + input_depth;
+        const float *d3 = d2 + input_depth;
+        float *v0 = transformed_input + ((y * 4 + 0) * block_size + t) * input_depth;
+        float *v1 = transformed_input + ((y * 4 + 1) * block_size + t) * input_depth;
+        float *v2 = transformed_input + ((y * 4 + 2) * block_size + t) * input_depth;
+        float *v3 = transformed_input + ((y * 4 + 3) * block_size + t) * input_depth;
+        for (int c = 0; c < input_depth; ++c)
+        {
+          v0[c] = d0[c] - d2[c];
+          v1[c] = d1[c] + d2[c];
+          v2[c] = d2[c] - d1[c];
+          v3[c] = d1[c] - d3[c];
+        }
+      }
+    }
+
+    // Multiply elementwise and sum over input channels
+    for (int e = 0; e < kWinogradTileElements; ++e)
+    {
+      Eigen::Map<const Matrix> v(transformed_input + e * block_size * input_depth, tile_count,
+                                 input_depth);
+      Eigen::Map<const Matrix> u(transformed_filter + e * input_depth * output_depth, input_depth,
+                                 output_depth);
+      Eigen::Map<Matrix> m(transformed_output + e * block_size * output_depth, tile_count,
+                           output_depth);
+      m.noalias() = v * u;
+    }
+
+    // Transform output tiles: Y = A^T m A
+    float *am = tile_buffer;
+    for (int t = 0; t < tile_count; ++t)
+    {
+      const int tile = tile_begin + t;
+      const int b = tile / tiles_per_batch;
+      const int out_y_origin = (tile % tiles_per_batch) / tiles_x * kWinogradOutputTile;
+      const int out_x_origin = (tile % tiles_x) * kWinogradOutputTile;
+
+      // Columns first: am[2][4][output_depth] = A^T m
+      for (int x = 0; x < 4; ++x)
+      {
+        const float *m0 = transformed_output + ((0 * 4 + x) * block_size + t) * output_depth;
+        const float *m1 = transformed_output + ((1 * 4 + x) * block_size + t) * output_depth;
+        const float *m2 = transformed_output + ((2 * 4 + x) * block_size + t) * output_depth;
+        const float *m3 = transformed_output + ((3 * 4 + x) * block_size + t) * output_depth;
+        float *am0 = am + x * output_depth;
+        float *am1 = am0 + 4 * output_depth;
+        for (int c = 0; c < output_depth; ++c)
+        {
+          am0[c] = m0[c] + m1[c] + m2[c];
+          am1[c] = m1[c] - m2[c] - m3[c];
+        }
+      }
+
+      // Then rows: Y = am A
+      for (int y = 0; y < kWinogradOutputTile && out_y_origin + y < output_height; ++y)
+      {
+        const float *am0 = am + y * 4 * output_depth;
+        const float *am1 = am0 + output_depth;
+        const float *am2 = am1 + output_depth;
+        const float *am3 = am2 + output_depth;
+        float *out0 = output_data + Offset(output_shape, b, out_y_origin + y, out_x_origin, 0);
+        for (int c = 0; c < output_depth; ++c)
+        {
+          const float bias = bias_data ? bias_data[c] : 0.f;
+          out0[c] = ActivationFunctionWithMinMax(am0[c] + am1[c] + am2[c] + bias, activation_min,
+                                                 activation_max);
+        }
+        if (out_x_origin + 1 < output_width)
+        {
+          float *out1 = out0 + output_depth;
+          for (int c = 0; c < output_depth; ++c)
+          {
+            const float bias = bias_data ? bias_data[c] : 0.f;
+            out1[c] = ActivationFunctionWithMinMax(am1[c] - am2[c] - am3[c] + bias,
+                                                   activation_min, activation_max);
+          }
+        }
+      }
+    }
+  };
+
+  const int64_t cost_per_slot = static_cast<int64_t>(num_blocks / num_slots) * block_size *
+                                kWinogradTileElements * input_depth * output_depth;
+  ParallelFor(num_slots, cost_per_slot, ruy_context, [&](int begin, int end) {
+    for (int slot = begin; slot < end; ++slot)
+    {
+      float *transformed_input = workspace_data + slot * slot_size;
+      float *transformed_output = transformed_input + input_block_size;
+      float *tile_buffer = transformed_output + output_block_size;
+      for (int block = slot; block < num_blocks; block += num_slots)
+        run_block(block, transformed_input, transformed_output, tile_buffer);
+    }
+  });
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
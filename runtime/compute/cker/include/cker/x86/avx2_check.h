@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_AVX2_CHECK_H__
+#define __NNFW_CKER_X86_AVX2_CHECK_H__
+
+// x86 builds target a baseline ISA (SSE4), so AVX2 kernels are compiled for AVX2 by function
+// attribute and selected at runtime only if the CPU supports them.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+  !defined(CKER_DISABLE_X86_AVX2)
+#define USE_X86_AVX2_DISPATCH
+#include <immintrin.h>
+
+// Compile a function with AVX2 and FMA regardless of the baseline ISA
+#define CKER_TARGET_AVX2 __attribute__((target("avx2,fma")))
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+inline bool HasAvx2()
+{
+  static const bool has_avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return has_avx2;
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif
+
+#endif // __NNFW_CKER_X86_AVX2_CHECK_H__
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedBlockQuant.h>
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace nnfw::cker;
+using namespace nnfw::cker::block_quant;
+
+namespace
+{
+
+std::vector<float> makeInput(int size, float scale)
+{
+  std::vector<float> v(size);
+  for (int i = 0; i < size; ++i)
+    v[i] = scale * std::sin(0.37f * i + 0.1f);
+  return v;
+}
+
+} // namespace
+
+TEST(CKer_Operation, BlockQuant_FP16)
+{
+  // Values exactly representable in fp16, including the smallest subnormal
+  for (float f : {0.0f, 1.0f, -2.5f, 0.0001220703125f, 5.9604644775390625e-08f, 65504.0f})
+    EXPECT_FLOAT_EQ(f, FP16ToFP32(FP32ToFP16(f))) << f;
+  EXPECT_NEAR(0.1f, FP16ToFP32(FP32ToFP16(0.1f)), 1e-4f);
+}
+
+TEST(CKer_Operation, BlockQuant_FP16Table)
+{
+  const float *table = FP16ToFP32Table();
+  for (uint32_t h = 0; h < (1u << 16); ++h)
+  {
+    const float expected = FP16ToFP32(static_cast<uint16_t>(h));
+    uint32_t lhs, rhs;
+    std::memcpy(&lhs, &table[h], sizeof(lhs));
+    std::memcpy(&rhs, &expected, sizeof(rhs));
+    ASSERT_EQ(lhs, rhs) << h;
+  }
+}
+
+TEST(CKer_Operation, BlockQuant_RoundTrip)
+{
+  const int k = 64;
+  auto input = makeInput(k, 3.0f);
+
+  // Q8_0
+  {
+    std::vector<BlockQ8_0> blocks(k / kBlockSize);
+    std::vector<float> output(k);
+    QuantizeRowQ8_0(input.data(), blocks.data(), k);
+    DequantizeRowQ8_0(blocks.data(), output.data(), k);
+    for (int i = 0; i < k; ++i)
+      EXPECT_NEAR(input[i], output[i], 3.0f / 127);
+  }
+  // Q4_0
+  {
+    std::vector<BlockQ4_0> blocks(k / kBlockSize);
+    std::vector<float> output(k);
+    QuantizeRowQ4_0(input.data(), blocks.data(), k);
+    DequantizeRowQ4_0(blocks.data(), output.data(), k);
+    for (int i = 0; i < k; ++i)
+      EXPECT_NEAR(input[i], output[i], 3.0f / 8);
+  }
+}
+
+TEST(CKer_Operation, BlockQuant_VecDot)
+{
+  const int k = 128;
+  auto x = makeInput(k, 2.0f);
+  auto y = makeInput(k, -1.5f);
+  for (int i = 0; i < k; ++i)
+    y[i] += 0.05f * i / k;
+
+  std::vector<BlockQ8_0> y_q8(k / kBlockSize);
+  QuantizeRowQ8_0(y.data(), y_q8.data(), k);
+
+  // Compare with the dot product of dequantized values
+  auto reference = [&](const std::vector<float> &dequantized) {
+    std::vector<float> y_deq(k);
+    DequantizeRowQ8_0(y_q8.data(), y_deq.data(), k);
+    float sum = 0.0f;
+    for (int i = 0; i < k; ++i)
+      sum += dequantized[i] * y_deq[i];
+    return sum;
+  };
+
+  {
+    std::vector<BlockQ8_0> x_q8(k / kBlockSize);
+    std::vector<float> x_deq(k);
+    QuantizeRowQ8_0(x.data(), x_q8.data(), k);
+    DequantizeRowQ8_0(x_q8.data(), x_deq.data(), k);
+    EXPECT_NEAR(reference(x_deq), VecDotQ8_0Q8_0(k, x_q8.data(), y_q8.data()), 1e-3f);
+  }
+  {
+    std::vector<BlockQ4_0> x_q4(k / kBlockSize);
+    std::vector<float> x_deq(k);
+    QuantizeRowQ4_0(x.data(), x_q4.data(), k);
+    DequantizeRowQ4_0(x_q4.data(), x_deq.data(), k);
+    EXPECT_NEAR(reference(x_deq), VecDotQ4_0Q8_0(k, x_q4.data(), y_q8.data()), 1e-3f);
+  }
+}
+
+#ifdef USE_X86_AVX2_DISPATCH
+TEST(CKer_Operation, BlockQuant_VecDotAvx2)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP();
+
+  const int k = 256;
+  auto x = makeInput(k, 2.0f);
+  auto y = makeInput(k, -1.5f);
+
+  std::vector<BlockQ8_0> x_q8(k / kBlockSize);
+  std::vector<BlockQ4_0> x_q4(k / kBlockSize);
+  std::vector<BlockQ8_0> y_q8(k / kBlockSize);
+  QuantizeRowQ8_0(x.data(), x_q8.data(), k);
+  QuantizeRowQ4_0(x.data(), x_q4.data(), k);
+  QuantizeRowQ8_0(y.data(), y_q8.data(), k);
+
+  EXPECT_NEAR(VecDotQ8_0Q8_0Generic(k, x_q8.data(), y_q8.data()),
+              VecDotQ8_0Q8_0Avx2(k, x_q8.data(), y_q8.data()), 1e-3f);
+  EXPECT_NEAR(VecDotQ4_0Q8_0Generic(k, x_q4.data(), y_q8.data()),
+              VecDotQ4_0Q8_0Avx2(k, x_q4.data(), y_q8.data()), 1e-3f);
+}
+#endif // USE_X86_AVX2_DISPATCH
+
+TEST(CKer_Operation, FullyConnectedBlockQuant)
+{
+  const int batches = 2;
+  const int input_size = 64;
+  const int num_units = 3;
+
+  auto input = makeInput(batches * input_size, 1.0f);
+  auto weights = makeInput(num_units * input_size, 0.5f);
+  std::vector<float> bias{0.5f, -1.0f, 0.0f};
+
+  std::vector<BlockQ8_0> weights_q8(num_units * input_size / kBlockSize);
+  QuantizeRowQ8_0(weights.data(), weights_q8.data(), num_units * input_size);
+
+  FullyConnectedParams params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> output(batches * num_units);
+  FCBlockQuantTempArena arena;
+  FullyConnectedBlockQuant(params, Shape{batches, input_size}, input.data(), BlockQuantType::Q8_0,
+                           Shape{num_units, input_size},
+                           reinterpret_cast<const uint8_t *>(weights_q8.data()), Shape{num_units},
+                           bias.data(), Shape{batches, num_units}, output.data(), arena, nullptr);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int u = 0; u < num_units; ++u)
+    {
+      float expected = bias[u];
+      for (int i = 0; i < input_size; ++i)
+        expected += input[b * input_size + i] * weights[u * input_size + i];
+      EXPECT_NEAR(expected, output[b * num_units + u], 0.05f);
+    }
+  }
+}
+
+TEST(CKer_Operation, neg_FullyConnectedBlockQuant_PartialBlock)
+{
+  std::vector<float> input(16);
+  std::vector<uint8_t> weights(sizeof(BlockQ8_0));
+  std::vector<float> output(1);
+  FullyConnectedParams params;
+  FCBlockQuantTempArena arena;
+
+  EXPECT_THROW(FullyConnectedBlockQuant(params, Shape{1, 16}, input.data(), BlockQuantType::Q8_0,
+                                        Shape{1, 16}, weights.data(), Shape{}, nullptr, Shape{1, 1},
+                                        output.data(), arena, nullptr),
+               std::runtime_error);
+}
+
+TEST(CKer_Operation, GatherBlockQuant)
+{
+  const int rows = 4;
+  const int cols = 32;
+  auto input = makeInput(rows * cols, 1.0f);
+
+  std::vector<BlockQ4_0> input_q4(rows * cols / kBlockSize);
+  QuantizeRowQ4_0(input.data(), input_q4.data(), rows * cols);
+  std::vector<float> dequantized(rows * cols);
+  DequantizeRowQ4_0(input_q4.data(), dequantized.data(), rows * cols);
+
+  std::vector<int32_t> indices{3, 0, 3};
+  std::vector<float> output(indices.size() * cols);
+  GatherBlockQuant<int32_t>(BlockQuantType::Q4_0, Shape{rows, cols},
+                            reinterpret_cast<const uint8_t *>(input_q4.data()),
+                            Shape{static_cast<int>(indices.size())}, indices.data(),
+                            Shape{static_cast<int>(indices.size()), cols}, output.data());
+
+  for (size_t i = 0; i < indices.size(); ++i)
+    for (int c = 0; c < cols; ++c)
+      EXPECT_FLOAT_EQ(dequantized[indices[i] * cols + c], output[i * cols + c]);
+}
+
+TEST(CKer_Operation, neg_GatherBlockQuant_OutOfRange)
+{
+  std::vector<BlockQ8_0> input(2);
+  std::vector<int32_t> indices{2};
+  std::vector<float> output(32);
+
+  EXPECT_THROW(GatherBlockQuant<int32_t>(BlockQuantType::Q8_0, Shape{2, 32},
+                                         reinterpret_cast<const uint8_t *>(input.data()), Shape{1},
+                                         indices.data(), Shape{1, 32}, output.data()),
+               std::runtime_error);
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/ParallelFor.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> makeInput(int size)
+{
+  std::vector<float> input(size);
+  for (int i = 0; i < size; ++i)
+    input[i] = static_cast<float>(i % 37) / 8.f - 2.f;
+  return input;
+}
+
+} // namespace
+
+TEST(CKer_Operation, ParallelFor)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Large enough to be split among all threads
+  const int size = 4 * nnfw::cker::kParallelForMinCostPerThread;
+  std::vector<std::atomic<int>> visited(size);
+  std::atomic<int> calls{0};
+
+  nnfw::cker::ParallelFor(size, 1, &ruy_context, [&](int begin, int end) {
+    calls++;
+    for (int i = begin; i < end; ++i)
+      visited[i]++;
+  });
+
+  EXPECT_EQ(calls, 4);
+  for (int i = 0; i < size; ++i)
+    ASSERT_EQ(visited[i], 1);
+}
+
+TEST(CKer_Operation, ParallelFor_serial)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  std::vector<std::pair<int, int>> ranges;
+  const auto fn = [&](int begin, int end) { ranges.emplace_back(begin, end); };
+
+  // Too small to be split
+  nnfw::cker::ParallelFor(100, 1, &ruy_context, fn);
+  // Without thread pool
+  nnfw::cker::ParallelFor(1 << 20, nnfw::cker::kParallelForCostTranscendental, nullptr, fn);
+  // Nothing to do
+  nnfw::cker::ParallelFor(0, 1, &ruy_context, fn);
+
+  ASSERT_EQ(ranges.size(), 2);
+  EXPECT_EQ(ranges[0], std::make_pair(0, 100));
+  EXPECT_EQ(ranges[1], std::make_pair(0, 1 << 20));
+}
+
+TEST(CKer_Operation, ParallelFor_Softmax)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const int batch = 256;
+  const int depth = 1024;
+  nnfw::cker::Shape shape{batch, depth};
+  std::vector<float> input(batch * depth);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(i % 37) / 8.f - 2.f;
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.f;
+
+  std::vector<float> expected(input.size());
+  std::vector<float> output(input.size());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, expected.data());
+  nnfw::cker::Softmax(params, shape, input.data(), shape, output.data(), &ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation, ParallelFor_Reduce)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const nnfw::cker::Shape input_shape{64, 32, 64};
+  const auto input = makeInput(input_shape.FlatSize());
+  const auto sum = [](const float current, const float in) -> float { return in + current; };
+
+  // Along the last axis, and along the middle axis which leaves the first dimension to split
+  for (const auto &axes : {std::vector<int>{2}, std::vector<int>{1}})
+  {
+    nnfw::cker::Shape output_shape{input_shape};
+    output_shape.SetDim(axes[0], 1);
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::Reduce reduce;
+    reduce.prepare(input_shape.DimensionsCount(), axes.size());
+    ASSERT_TRUE(reduce.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                            expected.data(), axes, true, 0.f, sum));
+    ASSERT_TRUE(reduce.ReduceGeneric<float>(input_shape, input.data(), output_shape, output.data(),
+                                            axes, true, 0.f, sum, &ruy_context));
+
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+TEST(CKer_Operation, ParallelFor_BroadcastBinaryArithmetic)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  // Broadcast along the first dimension, along the others, from a lower rank, and only along the
+  // first dimension which is split into slices without broadcast
+  const std::vector<std::pair<nnfw::cker::Shape, nnfw::cker::Shape>> shapes{
+    {{64, 32, 64}, {1, 32, 64}},
+    {{64, 32, 64}, {64, 1, 1}},
+    {{64, 32, 64}, {64}},
+    {{4, 128, 256}, {1, 128, 256}}};
+
+  for (const auto &[input1_shape, input2_shape] : shapes)
+  {
+    const auto input1 = makeInput(input1_shape.FlatSize());
+    const auto input2 = makeInput(input2_shape.FlatSize());
+    const auto &output_shape = input1_shape;
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::BinaryArithmeticOpParam params;
+    params.float_activation_min = std::numeric_limits<float>::lowest();
+    params.float_activation_max = std::numeric_limits<float>::max();
+    ASSERT_TRUE(nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params));
+
+    nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
+      params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape,
+      expected.data());
+    nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::SUB>(
+      params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape,
+      output.data(), &ruy_context);
+
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+TEST(CKer_Operation, ParallelFor_ResizeBilinear)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  const nnfw::cker::Shape input_shape{2, 32, 32, 16};
+  const auto input = makeInput(input_shape.FlatSize());
+
+  // 2x2 upsample and generic resize
+  for (int output_size : {64, 50})
+  {
+    nnfw::cker::ResizeBilinearParams params;
+    params.output_height = output_size;
+    params.output_width = output_size;
+    params.align_corners = false;
+    params.half_pixel_centers = false;
+
+    const nnfw::cker::Shape output_shape{2, output_size, output_size, 16};
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::ResizeBilinear(params, input_shape, input.data(), output_shape, expected.data());
+    nnfw::cker::ResizeBilinear(params, input_shape, input.data(), output_shape, output.data(),
+                               &ruy_context);
+
+    for (size_t i = 0; i < output.size(); ++i)
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
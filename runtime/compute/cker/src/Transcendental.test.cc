@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/ELU.h>
+#include <cker/operation/Elementwise.h>
+#include <cker/operation/Exp.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/RmsNorm.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Tanh.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+// Vectorized kernels are compared with scalar functions of the standard library
+
+namespace
+{
+
+// Evenly spaced values in [begin, end]
+std::vector<float> range(float begin, float end, int count)
+{
+  std::vector<float> values(count);
+  for (int i = 0; i < count; ++i)
+    values[i] = begin + (end - begin) * i / (count - 1);
+  return values;
+}
+
+void expectNearRelative(const std::vector<float> &output, const std::vector<float> &input,
+                        const std::function<float(float)> &reference, float tolerance)
+{
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    const float expected = reference(input[i]);
+    if (std::isnan(expected))
+      EXPECT_TRUE(std::isnan(output[i])) << "input: " << input[i];
+    else if (std::isinf(expected))
+      EXPECT_EQ(output[i], expected) << "input: " << input[i];
+    else
+      EXPECT_NEAR(output[i], expected, tolerance * std::max(1.f, std::abs(expected)))
+        << "input: " << input[i];
+  }
+}
+
+// Special values, repeated so that they are computed in every lane of packets and in the tail
+std::vector<float> specialValues(const std::vector<float> &values)
+{
+  std::vector<float> input;
+  for (int i = 0; i < 5; ++i)
+    input.insert(input.end(), values.begin(), values.end());
+  return input;
+}
+
+constexpr float kInf = std::numeric_limits<float>::infinity();
+constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+
+// Values of the kernel and the reference may both underflow, but the kernel may stop at the
+// smallest normal number instead of reaching a denormal number or zero
+void expectUnderflow(const std::vector<float> &output)
+{
+  for (const float value : output)
+  {
+    EXPECT_GE(value, 0.f);
+    EXPECT_LE(value, std::numeric_limits<float>::min());
+  }
+}
+
+} // namespace
+
+// NOTE Denormal inputs are not checked. Vectorized math of Eigen may flush them to zero or treat
+//      them as the smallest normal number.
+
+TEST(CKer_Operation, Transcendental_Exp)
+{
+  // Vectorized exp may overflow a little earlier than std::exp near FLT_MAX
+  const auto input = range(-87.f, 88.f, 4001);
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Exp(shape, input.data(), shape, output.data());
+
+  expectNearRelative(output, input, [](float x) { return std::exp(x); }, 1e-6f);
+}
+
+TEST(CKer_Operation, Transcendental_Exp_Special)
+{
+  const auto input = specialValues({0.f, -0.f, 88.5f, 100.f, 1e30f, kInf, kNaN});
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Exp(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::exp(x); }, 1e-6f);
+
+  const auto underflow = specialValues({-104.f, -1e30f, -kInf});
+  const nnfw::cker::Shape underflow_shape{static_cast<int>(underflow.size())};
+  std::vector<float> underflow_output(underflow.size());
+  nnfw::cker::Exp(underflow_shape, underflow.data(), underflow_shape, underflow_output.data());
+  expectUnderflow(underflow_output);
+}
+
+TEST(CKer_Operation, Transcendental_TanhLogistic_Special)
+{
+  const auto input =
+    specialValues({0.f, -0.f, 1e-30f, 20.f, -20.f, 1e30f, -1e30f, kInf, -kInf, kNaN});
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Tanh(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::tanh(x); }, 1e-6f);
+
+  const auto logistic_input = specialValues({0.f, -0.f, 20.f, 100.f, 1e30f, kInf, kNaN});
+  const nnfw::cker::Shape logistic_shape{static_cast<int>(logistic_input.size())};
+  std::vector<float> logistic_output(logistic_input.size());
+  nnfw::cker::Logistic(logistic_shape, logistic_input.data(), logistic_shape,
+                       logistic_output.data());
+  expectNearRelative(
+    logistic_output, logistic_input, [](float x) { return 1.f / (1.f + std::exp(-x)); }, 1e-6f);
+
+  const auto underflow = specialValues({-104.f, -1e30f, -kInf});
+  const nnfw::cker::Shape underflow_shape{static_cast<int>(underflow.size())};
+  std::vector<float> underflow_output(underflow.size());
+  nnfw::cker::Logistic(underflow_shape, underflow.data(), underflow_shape,
+                       underflow_output.data());
+  expectUnderflow(underflow_output);
+}
+
+TEST(CKer_Operation, Transcendental_ELU)
+{
+  const auto input = range(-20.f, 20.f, 4001);
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::ELU(shape, input.data(), shape, output.data());
+
+  expectNearRelative(
+    output, input, [](float x) { return x < 0.f ? std::exp(x) - 1.f : x; }, 1e-6f);
+}
+
+TEST(CKer_Operation, Transcendental_LogSqrtRsqrt)
+{
+  const auto input = range(1e-3f, 1e4f, 4001);
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Log(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::log(x); }, 1e-6f);
+
+  nnfw::cker::Sqrt(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::sqrt(x); }, 1e-6f);
+
+  nnfw::cker::Rsqrt(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return 1.f / std::sqrt(x); }, 1e-6f);
+}
+
+TEST(CKer_Operation, Transcendental_LogSqrtRsqrt_Special)
+{
+  const auto input = specialValues(
+    {0.f, -0.f, -1e-30f, -1.f, -1e30f, std::numeric_limits<float>::max(), kInf, -kInf, kNaN});
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Log(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::log(x); }, 1e-6f);
+
+  nnfw::cker::Sqrt(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return std::sqrt(x); }, 1e-6f);
+
+  nnfw::cker::Rsqrt(shape, input.data(), shape, output.data());
+  expectNearRelative(output, input, [](float x) { return 1.f / std::sqrt(x); }, 1e-6f);
+}
+
+TEST(CKer_Operation, Transcendental_Softmax)
+{
+  const int input_size = 1000;
+  const int batch_size = 3;
+  std::vector<float> input = range(-50.f, 50.f, input_size * batch_size);
+  std::vector<float> output(input.size());
+  const float beta = 0.5f;
+
+  nnfw::cker::Softmax(input.data(), input_size, batch_size, beta, output.data());
+
+  for (int b = 0; b < batch_size; ++b)
+  {
+    const float *in = input.data() + b * input_size;
+    const float *out = output.data() + b * input_size;
+    const double max = *std::max_element(in, in + input_size);
+    double sum = 0;
+    for (int i = 0; i < input_size; ++i)
+      sum += std::exp((in[i] - max) * beta);
+    for (int i = 0; i < input_size; ++i)
+      EXPECT_NEAR(out[i], std::exp((in[i] - max) * beta) / sum, 1e-6);
+  }
+}
+
+TEST(CKer_Operation, Transcendental_RmsNorm)
+{
+  const int rows = 5;
+  const int channels = 67;
+  const nnfw::cker::Shape shape{1, rows, channels};
+  const nnfw::cker::Shape gamma_shape{channels};
+  const auto input = range(-30.f, 40.f, rows * channels);
+  const auto gamma = range(0.5f, 1.5f, channels);
+  std::vector<float> output(input.size());
+
+  nnfw::cker::RmsNormParams params;
+  params.epsilon = 1e-6f;
+  nnfw::cker::RmsNorm(params, shape, input.data(), gamma_shape, gamma.data(), shape,
+                      output.data());
+
+  for (int r = 0; r < rows; ++r)
+  {
+    double square_sum = 0;
+    for (int c = 0; c < channels; ++c)
+      square_sum += static_cast<double>(input[r * channels + c]) * input[r * channels + c];
+    const double rms = std::sqrt(square_sum / channels + params.epsilon);
+    for (int c = 0; c < channels; ++c)
+      EXPECT_NEAR(output[r * channels + c], gamma[c] * input[r * channels + c] / rms, 1e-5);
+  }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/WinogradConv.h>
+#include <cker/operation/reference/Conv.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+void fill(std::vector<float> &data, int seed)
+{
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<float>((i * 7 + seed) % 23) / 11.f - 1.f;
+}
+
+// Compare Winograd Conv with reference Conv
+void verify(const Shape &input_shape, int output_depth, int pad, ruy::Context *ruy_context)
+{
+  const int batches = input_shape.Dims(0);
+  const int input_depth = input_shape.Dims(3);
+  const Shape filter_shape{output_depth, 3, 3, input_depth};
+  const Shape bias_shape{output_depth};
+  const Shape output_shape{batches, input_shape.Dims(1) + 2 * pad - 2,
+                           input_shape.Dims(2) + 2 * pad - 2, output_depth};
+
+  std::vector<float> input(input_shape.FlatSize());
+  std::vector<float> filter(filter_shape.FlatSize());
+  std::vector<float> bias(output_depth);
+  fill(input, 1);
+  fill(filter, 2);
+  fill(bias, 3);
+
+  ConvParams params{};
+  params.padding_type = PaddingType::kSame;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = -2.f;
+  params.float_activation_max = 2.f;
+
+  ASSERT_TRUE(optimized::IsWinogradConvSupported(filter_shape, 1, 1, 1, 1));
+
+  std::vector<float> expected(output_shape.FlatSize());
+  reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape,
+                  bias.data(), output_shape, expected.data());
+
+  std::vector<float> transformed_filter;
+  std::vector<uint8_t> workspace(
+    optimized::WinogradWorkspaceSize(input_shape, filter_shape, output_shape, ruy_context));
+  std::vector<float> output(output_shape.FlatSize());
+  optimized::TransformWinogradFilter(filter_shape, filter.data(), transformed_filter);
+  optimized::WinogradConv(params, input_shape, input.data(), filter_shape,
+                          transformed_filter.data(), bias.data(), output_shape, output.data(),
+                          workspace.data(), ruy_context);
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, WinogradConv)
+{
+  // Same padding with odd output size
+  verify(Shape{1, 7, 5, 8}, 8, 1, nullptr);
+  // Valid padding
+  verify(Shape{2, 6, 6, 16}, 12, 0, nullptr);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  // Many blocks of tiles split among threads
+  verify(Shape{1, 33, 31, 64}, 64, 1, &ruy_context);
+}
+
+TEST(CKer_Operation, neg_WinogradConvNotSupported)
+{
+  const Shape filter_shape{8, 3, 3, 8};
+  EXPECT_FALSE(optimized::IsWinogradConvSupported(filter_shape, 2, 2, 1, 1));
+  EXPECT_FALSE(optimized::IsWinogradConvSupported(filter_shape, 1, 1, 2, 2));
+  EXPECT_FALSE(optimized::IsWinogradConvSupported(Shape{8, 5, 5, 8}, 1, 1, 1, 1));
+  EXPECT_FALSE(optimized::IsWinogradConvSupported(Shape{8, 3, 3, 3}, 1, 1, 1, 1));
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/optimized/BinaryArithmeticOps.h>
+#include <cker/operation/optimized/DepthwiseConvFloat.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#ifdef USE_X86_AVX2_DISPATCH
+
+namespace
+{
+
+using namespace nnfw::cker;
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 13 + seed) % 29) / 7.f - 2.f + 0.01f * seed;
+  return data;
+}
+
+// Compare AVX2 and portable versions of a binary op, including sizes which leave a scalar tail
+template <class OP, class ACT> void verifyBinaryOp(float activation_min, float activation_max)
+{
+  BinaryArithmeticOpParam params{};
+  params.float_activation_min = activation_min;
+  params.float_activation_max = activation_max;
+
+  for (int size : {1, 7, 8, 15, 16, 17, 33, 100})
+  {
+    const auto input1 = makeData(size, 1);
+    const auto input2 = makeData(size, 2);
+    std::vector<float> expected(size);
+    std::vector<float> output(size);
+
+    optimized::BinaryOpElementwise<OP, ACT>(size, params, input1.data(), input2.data(),
+                                            expected.data());
+    optimized::BinaryOpElementwiseAvx2<OP, ACT>(size, params, input1.data(), input2.data(),
+                                                output.data());
+    for (int i = 0; i < size; ++i)
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+
+    optimized::BinaryOpScalarBroadcast<OP, ACT>(size, params, 0.75f, input2.data(),
+                                                expected.data());
+    optimized::BinaryOpScalarBroadcastAvx2<OP, ACT>(size, params, 0.75f, input2.data(),
+                                                    output.data());
+    for (int i = 0; i < size; ++i)
+      ASSERT_FLOAT_EQ(output[i], expected[i]);
+  }
+}
+
+void verifyDepthwiseRow(int stride, int dilation, int input_depth)
+{
+  const int input_width = 13;
+  const int filter_width = 3;
+  const int pad_width = 1;
+  const int out_x_buffer_start = 0;
+  const int out_x_buffer_end = (input_width + 2 * pad_width - dilation * 2 - 1) / stride + 1;
+
+  const auto input = makeData(input_width * input_depth, 3);
+  const auto filter = makeData(filter_width * input_depth, 4);
+  auto expected = makeData(out_x_buffer_end * input_depth, 5);
+  auto output = expected;
+
+  optimized::FloatDepthwiseConvAccumRowGeneric(
+    stride, dilation, input_depth, input_width, input.data(), pad_width, 1, filter_width,
+    filter.data(), out_x_buffer_start, out_x_buffer_end, input_depth, expected.data());
+  optimized::FloatDepthwiseConvAccumRowAvx2(
+    stride, dilation, input_depth, input_width, input.data(), pad_width, 1, filter_width,
+    filter.data(), out_x_buffer_start, out_x_buffer_end, input_depth, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-5f);
+}
+
+} // namespace
+
+TEST(CKer_Operation, X86Avx2BinaryArithmetic)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP();
+
+  verifyBinaryOp<optimized::BinaryOpFuncAddFloat, optimized::BinaryOpActivationFloatNone>(
+    std::numeric_limits<float>::lowest(), std::numeric_limits<float>::max());
+  verifyBinaryOp<optimized::BinaryOpFuncSubFloat, optimized::BinaryOpActivationFloatMax>(
+    0.f, std::numeric_limits<float>::max());
+  verifyBinaryOp<optimized::BinaryOpFuncMulFloat, optimized::BinaryOpActivationFloatMinMax>(-1.f,
+                                                                                            1.f);
+  verifyBinaryOp<optimized::BinaryOpFuncDivFloat, optimized::BinaryOpActivationFloatMinMax>(-6.f,
+                                                                                            6.f);
+  verifyBinaryOp<optimized::BinaryOpFuncSwapArgs<optimized::BinaryOpFuncSubFloat>,
+                 optimized::BinaryOpActivationFloatNone>(std::numeric_limits<float>::lowest(),
+                                                         std::numeric_limits<float>::max());
+}
+
+TEST(CKer_Operation, X86Avx2DepthwiseConvAccumRow)
+{
+  if (!x86::HasAvx2())
+    GTEST_SKIP();
+
+  for (int input_depth : {3, 8, 17, 32})
+  {
+    verifyDepthwiseRow(1, 1, input_depth);
+    verifyDepthwiseRow(2, 1, input_depth);
+    verifyDepthwiseRow(1, 2, input_depth);
+  }
+}
+
+#endif // USE_X86_AVX2_DISPATCH
@@ -760,6 +760,13 @@ typedef enum
    * TODO: Use workspace
    */
   NNFW_RUN_CONFIG_PROFILE,
+  /**
+   * Dump hardware performance counters of operations to workspace (not require value setting)
+   *
+   * Counters are read by Linux perf_event_open, and written to trace.json and trace.table.md
+   * with summary per operation type and backend.
+   */
+  NNFW_RUN_CONFIG_PERF_COUNTERS,
 } NNFW_RUN_CONFIG;
 
 /**
@@ -461,9 +461,21 @@ NNFW_STATUS Session::prepare()
 
   try
   {
+    // Plan cache keeps the package before compilation to compile it again with other shapes
+    std::vector<onert::ir::Shape> input_shapes;
+    if (_coptions->plan_cache_size > 0)
+    {
+      for (uint32_t i = 0; i < _nnpkg->inputSize(); ++i)
+        input_shapes.emplace_back(_nnpkg->inputInfo(onert::ir::IOIndex{i}).shape());
+      _plan_cache = std::make_unique<onert::compiler::PlanCache>(*_nnpkg, _coptions.get(),
+                                                                 _coptions->plan_cache_size);
+    }
+
     auto compiler =
       onert::compiler::CompilerFactory::get().create(std::move(_nnpkg), _coptions.get());
     _compiler_artifact = compiler->compile();
+    if (_plan_cache)
+      _plan_cache->insert(input_shapes, _compiler_artifact);
     _execution = std::make_unique<onert::exec::Execution>(_compiler_artifact->_executors);
   }
   catch (const std::exception &e)
@@ -486,6 +498,9 @@ NNFW_STATUS Session::run()
 
   try
   {
+    if (_plan_cache && _execution->context().shape_updated)
+      switchPlan();
+
     _execution->execute();
   }
   catch (const onert::InsufficientBufferSizeException &e)
@@ -513,6 +528,22 @@ NNFW_STATUS Session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
+  try
+  {
+    if (_plan_cache && _execution->context().shape_updated)
+      switchPlan();
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    setLastErrorMessage("Error during Session::run_async : " + std::string(e.what()));
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    setLastErrorMessage("Error during Session::run_async : " + std::string(e.what()));
+    return NNFW_STATUS_ERROR;
+  }
+
   _execution->startExecute();
 
   _state = State::RUNNING;
@@ -1119,6 +1150,8 @@ NNFW_STATUS Session::set_signature_run(const char *signature)
     {
       _execution =
         std::make_unique<onert::exec::Execution>(_compiler_artifact->_executors, subg_idx);
+      // Cached plans are compiled for the primary subgraph entry only
+      _plan_cache.reset();
       return NNFW_STATUS_NO_ERROR;
     }
   }
@@ -1187,6 +1220,10 @@ NNFW_STATUS Session::set_config(const char *key, const char *value)
   {
     _coptions->he_profiling_mode = toBool(value);
   }
+  else if (skey == config::PLAN_CACHE_SIZE)
+  {
+    _coptions->plan_cache_size = toInt(value);
+  }
   else if (skey == config::ENABLE_LOG || skey == config::NUM_THREADS)
   {
     onert::util::CfgKeyValues keyValues;
@@ -1263,6 +1300,7 @@ NNFW_STATUS Session::loadModelFile(const std::string &model_file_path,
   _selected_signature = onert::ir::SubgraphIndex{};
   _model_path = std::filesystem::path(model_file_path);
   _compiler_artifact.reset();
+  _plan_cache.reset();
   _execution.reset();
   _train_info = loadTrainingInfo(_nnpkg->primary_model());
   _state = State::MODEL_LOADED;
@@ -1270,6 +1308,42 @@ NNFW_STATUS Session::loadModelFile(const std::string &model_file_path,
   return NNFW_STATUS_NO_ERROR;
 }
 
+void Session::switchPlan()
+{
+  assert(_plan_cache != nullptr);
+
+  const auto &ctx = _execution->context();
+  std::vector<onert::ir::Shape> input_shapes;
+  for (const auto &input : ctx.desc.inputs)
+    input_shapes.emplace_back(input.info.shape());
+
+  // Plan compiled with changed shapes does not need dynamic shape inference.
+  // Shapes requested for the first time run on the current plan with dynamic shapes.
+  auto plan = _plan_cache->get(input_shapes);
+  if (plan == nullptr)
+    return;
+
+  auto execution = std::make_unique<onert::exec::Execution>(plan->_executors);
+  for (uint32_t i = 0; i < ctx.desc.inputs.size(); ++i)
+  {
+    const auto &input = ctx.desc.inputs[i];
+    execution->setInput(onert::ir::IOIndex{i}, input.buffer, input.size);
+  }
+  for (uint32_t i = 0; i < ctx.desc.outputs.size(); ++i)
+  {
+    const auto &output = ctx.desc.outputs[i];
+    // Report the same error as user tensors of the dynamic path
+    const auto &info = execution->outputInfo(onert::ir::IOIndex{i});
+    if (output.buffer != nullptr && info.total_size() > output.size)
+      throw onert::InsufficientBufferSizeException{"User given buffer size is too small."};
+    execution->setOutput(onert::ir::IOIndex{i}, output.buffer, output.size);
+  }
+  execution->executionOptions() = ctx.options;
+
+  _compiler_artifact = std::move(plan);
+  _execution = std::move(execution);
+}
+
 void Session::setLastErrorMessage(std::string message)
 {
   // TODO: For now, this is kept for backward compatibility. Remove the std::cerr usage in the
@@ -2356,6 +2430,11 @@ NNFW_STATUS Session::set_execute_config(const NNFW_RUN_CONFIG key, const char *)
     case NNFW_RUN_CONFIG_PROFILE:
       _execution->executionOptions().profile = true;
       break;
+    case NNFW_RUN_CONFIG_PERF_COUNTERS:
+      if (_coptions->workspace_dir.empty())
+        return NNFW_STATUS_ERROR;
+      _execution->executionOptions().perf_counters = true;
+      break;
     default:
       setLastErrorMessage("Error during Session::set_execute_config : Invalid config key");
       return NNFW_STATUS_ERROR;
@@ -2375,6 +2454,7 @@ NNFW_STATUS Session::reset_execute_config()
   _execution->executionOptions().dump_minmax = false;
   _execution->executionOptions().trace = false;
   _execution->executionOptions().profile = false;
+  _execution->executionOptions().perf_counters = false;
 
   return NNFW_STATUS_NO_ERROR;
 }
@@ -22,6 +22,7 @@
 #include "CustomKernelRegistry.h"
 #include "compiler/CompilerOptions.h"
 #include "compiler/ICompiler.h"
+#include "compiler/PlanCache.h"
 #include "exec/Execution.h"
 #include "ir/NNPkg.h"
 #include "ir/train/TrainingInfo.h"
@@ -207,6 +208,7 @@ private:
   NNFW_STATUS getTensorIndexImpl(const onert::ir::IGraph &graph, const char *tensorname,
                                  uint32_t *index, bool is_input);
   void setLastErrorMessage(std::string message);
+  void switchPlan();
 
   bool isStateInitialized();
   bool isStateModelLoaded();
@@ -222,7 +224,8 @@ private:
   State _state{State::INITIALIZED};
   std::unique_ptr<onert::ir::NNPkg> _nnpkg;
   std::unique_ptr<onert::compiler::CompilerOptions> _coptions;
-  std::unique_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
+  std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
+  std::unique_ptr<onert::compiler::PlanCache> _plan_cache;
   std::unique_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
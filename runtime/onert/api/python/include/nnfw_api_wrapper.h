@@ -18,6 +18,7 @@
 #define __ONERT_API_PYTHON_NNFW_API_WRAPPER_H__
 
 #include <string>
+#include <vector>
 
 #include "nnfw.h"
 #include "nnfw_experimental.h"
@@ -123,10 +124,24 @@ py::list get_dims(const tensorinfo &tensor_info);
  */
 void set_dims(tensorinfo &tensor_info, const py::list &array);
 
+/**
+ * @brief     Get the size in bytes of an element of the type.
+ *
+ * @param[in] type type of element
+ * @return size of element
+ */
+size_t getTypeSize(NNFW_TYPE type);
+
 class NNFW_SESSION
 {
 private:
   nnfw_session *session;
+  // Objects whose buffers are bound to inputs and outputs, kept alive while they are used
+  std::vector<py::object> input_buffers;
+  std::vector<py::object> output_buffers;
+  // True for the outputs whose shape is fixed at prepare, so their internal buffers are kept
+  // by runs. Cleared when an input shape is changed.
+  std::vector<bool> static_outputs;
 
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
@@ -166,6 +181,16 @@ public:
 
     ensure_status(nnfw_set_output(session, index, type, buffer.request().ptr, length));
   }
+  /**
+   * @brief   Bind any object supporting buffer protocol to input without copying it
+   *          Buffer should be C-contiguous and have the same size in bytes as the input.
+   */
+  void set_input_buffer(uint32_t index, const py::buffer &buffer);
+  /**
+   * @brief   Bind any writable object supporting buffer protocol to output without copying it
+   *          Buffer should be C-contiguous and have the same size in bytes as the output.
+   */
+  void set_output_buffer(uint32_t index, const py::buffer &buffer);
   uint32_t input_size();
   uint32_t output_size();
   // process the input layout by receiving a string from Python instead of NNFW_LAYOUT
@@ -178,7 +203,15 @@ public:
   //////////////////////////////////////////////
   // Internal APIs
   //////////////////////////////////////////////
-  py::array get_output(uint32_t index);
+  /**
+   * @brief   Get output as numpy array
+   *          If owner is given and the output has a static shape, the array is a read-only view
+   *          onto the internal buffer, which keeps owner alive. The next run overwrites its
+   *          values, and it must not be used after close_session(). The array is a copy if
+   *          owner is not given or the output shape is dynamic, i.e. unknown at prepare or
+   *          changed by set_input_tensorinfo(), as the next run may reallocate the buffer.
+   */
+  py::array get_output(uint32_t index, py::handle owner = py::handle());
 
   //////////////////////////////////////////////
   // Experimental APIs for inference
@@ -123,7 +123,10 @@ class BaseSession:
                 raise OnertError(f"Failed to get input tensorinfo #{i}: {e}") from e
 
             if len(inputs_array) > i:
-                input_array = np.array(inputs_array[i], dtype=input_tensorinfo.dtype)
+                # NOTE array is not copied if it has the same dtype and is C-contiguous
+                input_array = np.asarray(inputs_array[i],
+                                         dtype=input_tensorinfo.dtype,
+                                         order='C')
             else:
                 print(
                     f"Model's input size is {size}, but given inputs_array size is {len(inputs_array)}.\n{i}-th index input is replaced by an array filled with 0."
@@ -135,7 +138,7 @@ class BaseSession:
             if input_array.shape != tuple(input_tensorinfo.dims):
                 # If not, set the input tensor info to match the input_array shape
                 try:
-                    input_tensorinfo.rank = len(input_array)
+                    input_tensorinfo.rank = input_array.ndim
                     input_tensorinfo.dims = list(input_array.shape)
                     self.session.set_input_tensorinfo(i, input_tensorinfo)
                 except Exception as e:
@@ -150,12 +153,15 @@ class BaseSession:
 
             self.inputs.append(input_array)
 
-    def _set_outputs(self, size):
+    def _set_outputs(self, size, copy=True):
         """
         Set the output tensors for the session.
 
         Args:
             size (int): Number of output tensors.
+            copy (bool): If False, outputs of static shape are read-only views onto the
+                         internal buffers, which are overwritten by the next run.
+                         Outputs of dynamic shape are always copied.
 
 	    Raises:
             ValueError: If session uninitialized.
@@ -169,7 +175,7 @@ class BaseSession:
         self.outputs = []
         for i in range(size):
             try:
-                output_array = self.session.get_output(i)
+                output_array = self.session.get_output(i, copy=copy)
             except ValueError:
                 raise
             except Exception as e:
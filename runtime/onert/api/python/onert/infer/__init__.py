@@ -1,3 +1,4 @@
 from .session import session
+from .async_session import async_session
 
-__all__ = ["session"]
+__all__ = ["session", "async_session"]
@@ -0,0 +1,283 @@
+from typing import List, Optional, Sequence
+from concurrent.futures import Future
+from collections import OrderedDict
+import threading
+import time
+import numpy as np
+
+from ..native.libnnfw_api_pybind import tensorinfo
+from .session import session
+
+# Key of the group for a request which cannot be batched with others
+_UNBATCHED = 'unbatched'
+
+
+class _Request:
+    """
+    Inputs of a request submitted to async_session and its future.
+    """
+    def __init__(self, inputs: List[np.ndarray]) -> None:
+        self.inputs = inputs
+        self.future: Future = Future()
+        self.arrival: float = time.monotonic()
+
+    def batch_size(self) -> int:
+        return self.inputs[0].shape[0]
+
+
+class async_session:
+    """
+    Class for asynchronous batched inference.
+
+    Requests are queued by submit() and their results are returned as futures.
+    Requests whose inputs have the same shape except for the first (batch) dimension
+    are concatenated along the first dimension and run at once on one of the sessions
+    in the pool. Outputs are split back along the first dimension for each request.
+
+    A batch is run when it reaches max_batch_size or its oldest request has waited
+    for max_delay_ms. To avoid reallocation caused by shape change, a session prefers
+    the batches of the same shape as the one it has run last, unless requests of other
+    shapes have waited for max_delay_ms.
+
+    NOTE All the outputs of the model should have the batch dimension as the first
+         dimension to run multiple requests at once. Use max_batch_size=1 otherwise.
+    """
+    def __init__(self,
+                 path: str,
+                 backends: str = "cpu",
+                 *,
+                 num_sessions: int = 1,
+                 max_batch_size: int = 8,
+                 max_delay_ms: float = 1.0,
+                 pad_batch: bool = False) -> None:
+        """
+        Initialize the sessions and start their worker threads.
+
+        Args:
+            path (str): Path to the model file or nnpackage directory.
+            backends (str): Backends to use, default is "cpu".
+            num_sessions (int): Number of sessions running batches concurrently.
+            max_batch_size (int): Maximum sum of the first dimension of requests
+                in a batch.
+            max_delay_ms (float): Maximum time (ms) to wait for more requests to make
+                a batch.
+            pad_batch (bool): If True, pad a batch with zeros up to max_batch_size so that
+                the input shape of the sessions stays the same. Use this for models with
+                fixed batch size or to avoid reallocation on every batch.
+        """
+        if num_sessions < 1:
+            raise ValueError(f"num_sessions should be positive, but got {num_sessions}")
+        if max_batch_size < 1:
+            raise ValueError(
+                f"max_batch_size should be positive, but got {max_batch_size}")
+
+        self._max_batch_size = max_batch_size
+        self._max_delay = max_delay_ms / 1000.0
+        self._pad_batch = pad_batch
+
+        self._sessions = [session(path, backends) for _ in range(num_sessions)]
+        self._num_inputs: int = self._sessions[0].input_size()
+
+        # Pending requests grouped by the shape key, in order of arrival in each group
+        self._pending: "OrderedDict[tuple, List[_Request]]" = OrderedDict()
+        self._cond = threading.Condition()
+        self._closed = False
+
+        self._workers = [
+            threading.Thread(target=self._work, args=(sess, ), daemon=True)
+            for sess in self._sessions
+        ]
+        for worker in self._workers:
+            worker.start()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def get_inputs_tensorinfo(self) -> List[tensorinfo]:
+        """
+        Retrieve tensorinfo for all input tensors of the model.
+
+        Returns:
+            list[tensorinfo]: A list of tensorinfo objects for each input.
+        """
+        return self._sessions[0].get_inputs_tensorinfo()
+
+    def submit(self, inputs_array: Sequence[np.ndarray]) -> Future:
+        """
+        Queue a request for inference.
+
+        Args:
+            inputs_array (list[np.ndarray]): List of numpy arrays representing the input
+                data. The first dimension of every input is treated as batch dimension.
+
+        Returns:
+            concurrent.futures.Future: A future resolving to the list of output numpy
+                arrays.
+        """
+        if len(inputs_array) != self._num_inputs:
+            raise ValueError(
+                f"Expected {self._num_inputs} input(s), but received {len(inputs_array)}."
+            )
+
+        inputs = [np.asarray(x) for x in inputs_array]
+        request = _Request(inputs)
+
+        if any(x.ndim == 0 for x in inputs) or len(set(
+                x.shape[0] for x in inputs)) != 1 or self._max_batch_size == 1:
+            # Requests that cannot be batched have their own group
+            key = (_UNBATCHED, id(request))
+        else:
+            key = tuple((x.shape[1:], x.dtype.str) for x in inputs)
+
+        with self._cond:
+            if self._closed:
+                raise RuntimeError("Cannot submit a request to closed async_session")
+            self._pending.setdefault(key, []).append(request)
+            self._cond.notify_all()
+        return request.future
+
+    def infer_many(self, requests: Sequence[Sequence[np.ndarray]]) -> List[Future]:
+        """
+        Queue many requests for inference at once.
+
+        Args:
+            requests (list[list[np.ndarray]]): List of inputs_array of each request.
+
+        Returns:
+            list[concurrent.futures.Future]: Futures of the requests in the same order.
+        """
+        return [self.submit(inputs_array) for inputs_array in requests]
+
+    def close(self, wait: bool = True) -> None:
+        """
+        Stop accepting requests. Pending requests are still run.
+
+        Args:
+            wait (bool): If True, wait until all pending requests are done.
+        """
+        with self._cond:
+            self._closed = True
+            self._cond.notify_all()
+        if wait:
+            for worker in self._workers:
+                worker.join()
+
+    def _take_batch(self, last_key: Optional[tuple]):
+        """
+        Wait for a batch ready to run and take it from the pending requests.
+        Return (None, None) if closed and nothing is pending.
+        """
+        with self._cond:
+            while True:
+                if not self._pending:
+                    if self._closed:
+                        return None, None
+                    self._cond.wait()
+                    continue
+
+                now = time.monotonic()
+                timeout = None
+                ready = []
+                for key, requests in self._pending.items():
+                    size = sum(r.batch_size() for r in requests)
+                    deadline = requests[0].arrival + self._max_delay
+                    if key[0] == _UNBATCHED or size >= self._max_batch_size or (
+                            deadline <= now or self._closed):
+                        ready.append(key)
+                    else:
+                        remaining = deadline - now
+                        timeout = remaining if timeout is None else min(
+                            timeout, remaining)
+
+                if ready:
+                    key = self._select(ready, last_key, now)
+                    break
+                self._cond.wait(timeout)
+
+            requests = self._pending[key]
+            batch = []
+            size = 0
+            while requests:
+                request_size = requests[0].batch_size()
+                if batch and size + request_size > self._max_batch_size:
+                    break
+                batch.append(requests.pop(0))
+                size += request_size
+            if not requests:
+                del self._pending[key]
+            if self._pending:
+                # Let other sessions take the remaining requests
+                self._cond.notify_all()
+            return key, batch
+
+    def _select(self, ready: List[tuple], last_key: Optional[tuple], now: float) -> tuple:
+        """
+        Select a group to run among the ready ones.
+
+        Groups whose oldest request has waited for max_delay_ms are taken first, oldest
+        one first, so that a shape with a steady stream of full batches cannot starve
+        the others. Otherwise the group run last by the session is preferred.
+        """
+        def oldest(key):
+            return self._pending[key][0].arrival
+
+        overdue = [key for key in ready if oldest(key) + self._max_delay <= now]
+        if overdue:
+            return min(overdue, key=oldest)
+        if last_key in ready:
+            return last_key
+        return min(ready, key=oldest)
+
+    def _work(self, sess: session) -> None:
+        last_key = None
+        while True:
+            key, batch = self._take_batch(last_key)
+            if batch is None:
+                return
+            last_key = key
+
+            # Skip requests cancelled while waiting
+            batch = [r for r in batch if r.future.set_running_or_notify_cancel()]
+            if not batch:
+                continue
+
+            try:
+                self._run_batch(sess, key, batch)
+            except Exception as e:
+                for request in batch:
+                    if not request.future.done():
+                        request.future.set_exception(e)
+
+    def _run_batch(self, sess: session, key: tuple, batch: List[_Request]) -> None:
+        if key[0] == _UNBATCHED or (len(batch) == 1 and not self._pad_batch):
+            batch[0].future.set_result(sess.infer(batch[0].inputs))
+            return
+
+        sizes = [r.batch_size() for r in batch]
+        total = sum(sizes)
+        inputs = []
+        for i in range(self._num_inputs):
+            arrays = [r.inputs[i] for r in batch]
+            if self._pad_batch and total < self._max_batch_size:
+                shape = (self._max_batch_size - total, ) + arrays[0].shape[1:]
+                arrays.append(np.zeros(shape, dtype=arrays[0].dtype))
+            inputs.append(np.concatenate(arrays, axis=0))
+
+        outputs = sess.infer(inputs)
+
+        offsets = np.cumsum(sizes)[:-1]
+        results = [[] for _ in batch]
+        for i, output in enumerate(outputs):
+            if output.ndim == 0 or output.shape[0] != inputs[0].shape[0]:
+                raise ValueError(
+                    f"Output #{i} with shape {output.shape} does not have batch "
+                    f"dimension of size {inputs[0].shape[0]}. "
+                    "Use max_batch_size=1 for this model.")
+            for result, part in zip(results, np.split(output[:total], offsets)):
+                result.append(part)
+
+        for request, result in zip(batch, results):
+            request.future.set_result(result)
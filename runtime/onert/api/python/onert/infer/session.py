@@ -28,7 +28,8 @@ class session(BaseSession):
         self,
         inputs_array: List[np.ndarray],
         *,
-        measure: bool = False
+        measure: bool = False,
+        zero_copy: bool = False
     ) -> Union[List[np.ndarray], Tuple[List[np.ndarray], Dict[str, float]]]:
         """
         Run a complete inference cycle:
@@ -43,6 +44,10 @@ class session(BaseSession):
         Args:
             inputs_array (list[np.ndarray]): List of numpy arrays representing the input data.
             measure (bool): If True, measure prepare/io/run latencies (ms).
+            zero_copy (bool): If True, return read-only views onto the output buffers of the
+                session instead of copies. They are overwritten by the next infer().
+                Outputs of dynamic shape are still copied, as their buffers may be
+                reallocated by the next infer().
 
         Returns:
             list[np.ndarray]: A list containing the output numpy arrays.
@@ -79,6 +84,8 @@ class session(BaseSession):
                                 # static dim must match the provided array
                                 new_dims.append(d)
                             else:
+                                # e.g. batch size of batched requests
+                                new_dims.append(input_shape[j])
                                 static_dim_changed = True
 
                         if static_dim_changed:
@@ -122,7 +129,7 @@ class session(BaseSession):
 
         try:
             with self._time_block(metrics, 'output_time_ms', measure):
-                self._set_outputs(self.session.output_size())
+                self._set_outputs(self.session.output_size(), copy=not zero_copy)
         except ValueError:
             raise
         except Exception as e:
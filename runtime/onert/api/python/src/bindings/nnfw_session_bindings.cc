@@ -43,10 +43,14 @@ void bind_nnfw_session(py::module_ &m)
          "Parameters:\n"
          "\tindex (int): Index of input to be set (0-indexed)\n"
          "\ttensor_info (tensorinfo): Tensor info to be set")
-    .def("prepare", &NNFW_SESSION::prepare, "Prepare for inference")
-    .def("run", &NNFW_SESSION::run, "Run inference")
-    .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
-    .def("wait", &NNFW_SESSION::wait, "Wait for asynchronous run to finish")
+    // NOTE GIL is released while the session is working so that other Python threads can run
+    .def("prepare", &NNFW_SESSION::prepare, py::call_guard<py::gil_scoped_release>(),
+         "Prepare for inference")
+    .def("run", &NNFW_SESSION::run, py::call_guard<py::gil_scoped_release>(), "Run inference")
+    .def("run_async", &NNFW_SESSION::run_async, py::call_guard<py::gil_scoped_release>(),
+         "Run inference asynchronously")
+    .def("wait", &NNFW_SESSION::wait, py::call_guard<py::gil_scoped_release>(),
+         "Wait for asynchronous run to finish")
     .def(
       "set_input",
       [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
@@ -117,6 +121,18 @@ void bind_nnfw_session(py::module_ &m)
       "Parameters:\n"
       "\tindex (int): Index of input to be set (0-indexed)\n"
       "\tbuffer (numpy): Raw buffer for input")
+    .def("set_input", &NNFW_SESSION::set_input_buffer, py::arg("index"), py::arg("buffer"),
+         "Set input buffer from any object supporting buffer protocol without copying it\n"
+         "The object is kept referenced until the input is set again.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of input to be set (0-indexed)\n"
+         "\tbuffer (buffer): C-contiguous buffer having the same size in bytes as the input")
+    .def("set_output", &NNFW_SESSION::set_output_buffer, py::arg("index"), py::arg("buffer"),
+         "Set output buffer from any writable object supporting buffer protocol\n"
+         "Outputs are written to the buffer directly by run.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of output to be set (0-indexed)\n"
+         "\tbuffer (buffer): C-contiguous buffer having the same size in bytes as the output")
     .def("input_size", &NNFW_SESSION::input_size,
          "Get the number of inputs defined in loaded model\n"
          "Returns:\n"
@@ -143,13 +159,22 @@ void bind_nnfw_session(py::module_ &m)
          "\tindex (int): Index of output\n"
          "Returns:\n"
          "\ttensorinfo: Tensor info (shape, type, etc)")
-    .def("get_output", &NNFW_SESSION::get_output, py::arg("index"),
-         R"pbdoc(
-         Retrieve the internally-allocated dynamic output as a copy.
+    .def(
+      "get_output",
+      [](py::object self, uint32_t index, bool copy) {
+        return self.cast<NNFW_SESSION &>().get_output(index, copy ? py::handle() : self);
+      },
+      py::arg("index"), py::arg("copy") = true,
+      R"pbdoc(
+         Retrieve the internally-allocated dynamic output.
          Parameters:
              index (int): Index of the output tensor (0-indexed)
+             copy (bool): If False, return a read-only view onto the internal buffer
+                          without copying it. The next run overwrites the view, and it must
+                          not be used after close_session(). Outputs of dynamic shape are
+                          always copied, as the next run may reallocate their buffers.
          Returns:
-             numpy.ndarray: a copy of the internal buffer
+             numpy.ndarray: a copy (or a view) of the internal buffer
          )pbdoc")
     .def("set_prepare_config", &NNFW_SESSION::set_prepare_config, py::arg("config"),
          "Set configuration to prepare");
@@ -165,8 +190,10 @@ void bind_experimental_nnfw_session(py::module_ &m)
          "Retrieve training information for the model.")
     .def("train_set_traininfo", &NNFW_SESSION::train_set_traininfo, py::arg("info"),
          "Set training information for the model.")
-    .def("train_prepare", &NNFW_SESSION::train_prepare, "Prepare for training")
+    .def("train_prepare", &NNFW_SESSION::train_prepare, py::call_guard<py::gil_scoped_release>(),
+         "Prepare for training")
     .def("train", &NNFW_SESSION::train, py::arg("update_weights") = true,
+         py::call_guard<py::gil_scoped_release>(),
          "Run a training step, optionally updating weights.")
     .def("train_get_loss", &NNFW_SESSION::train_get_loss, py::arg("index"),
          "Retrieve the training loss for a specific index.")
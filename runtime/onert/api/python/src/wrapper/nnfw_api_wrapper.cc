@@ -65,7 +65,7 @@ NNFW_TYPE getType(const char *type)
     return NNFW_TYPE::NNFW_TYPE_TENSOR_FLOAT32;
   else if (std::strcmp(type, "int32") == 0)
     return NNFW_TYPE::NNFW_TYPE_TENSOR_INT32;
-  else if (std::strcmp(type, "bool") == 0)
+  else if (std::strcmp(type, "uint8") == 0)
     return NNFW_TYPE::NNFW_TYPE_TENSOR_UINT8;
   else if (std::strcmp(type, "bool") == 0)
     return NNFW_TYPE::NNFW_TYPE_TENSOR_BOOL;
@@ -104,6 +104,28 @@ const char *getStringType(NNFW_TYPE type)
   }
 }
 
+size_t getTypeSize(NNFW_TYPE type)
+{
+  switch (type)
+  {
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_FLOAT32:
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_INT32:
+      return 4;
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_QUANT8_ASYMM:
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_BOOL:
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_UINT8:
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+      return 1;
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_INT64:
+      return 8;
+    case NNFW_TYPE::NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED:
+      return 2;
+    default:
+      throw NnfwError(std::string("Unknown size of NNFW_TYPE (value=") +
+                      std::to_string(static_cast<int>(type)) + ")");
+  }
+}
+
 uint64_t num_elems(const nnfw_tensorinfo *tensor_info)
 {
   uint64_t n = 1;
@@ -152,6 +174,9 @@ void NNFW_SESSION::close_session()
 {
   ensure_status(nnfw_close_session(this->session));
   this->session = nullptr;
+  input_buffers.clear();
+  output_buffers.clear();
+  static_outputs.clear();
 }
 void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info)
 {
@@ -163,11 +188,87 @@ void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor
     ti.dims[i] = tensor_info->dims[i];
   }
   ensure_status(nnfw_set_input_tensorinfo(session, index, &ti));
+
+  // Outputs may be reallocated for the new input shape
+  static_outputs.clear();
+}
+void NNFW_SESSION::prepare()
+{
+  ensure_status(nnfw_prepare(session));
+
+  uint32_t num_outputs = 0;
+  ensure_status(nnfw_output_size(session, &num_outputs));
+  static_outputs.assign(num_outputs, true);
+  for (uint32_t i = 0; i < num_outputs; ++i)
+  {
+    nnfw_tensorinfo tensor_info;
+    ensure_status(nnfw_output_tensorinfo(session, i, &tensor_info));
+    for (int32_t d = 0; d < tensor_info.rank; ++d)
+    {
+      if (tensor_info.dims[d] < 0)
+        static_outputs[i] = false;
+    }
+  }
 }
-void NNFW_SESSION::prepare() { ensure_status(nnfw_prepare(session)); }
 void NNFW_SESSION::run() { ensure_status(nnfw_run(session)); }
 void NNFW_SESSION::run_async() { ensure_status(nnfw_run_async(session)); }
 void NNFW_SESSION::wait() { ensure_status(nnfw_await(session)); }
+namespace
+{
+
+// Return the pointer to contiguous data of buffer after checking its size
+void *contiguous_data(const py::buffer &buffer, size_t expected_bytes, bool writable)
+{
+  py::buffer_info info = buffer.request(writable);
+
+  // Check C-contiguous
+  auto stride = info.itemsize;
+  for (auto i = info.ndim; i > 0; --i)
+  {
+    if (info.shape[i - 1] != 1 && info.strides[i - 1] != stride)
+      throw NnfwError("Buffer should be C-contiguous");
+    stride *= info.shape[i - 1];
+  }
+
+  const size_t bytes = static_cast<size_t>(info.size * info.itemsize);
+  if (bytes != expected_bytes)
+    throw NnfwError("Buffer size (" + std::to_string(bytes) + " bytes) differs from tensor (" +
+                    std::to_string(expected_bytes) + " bytes)");
+
+  return info.ptr;
+}
+
+} // namespace
+
+void NNFW_SESSION::set_input_buffer(uint32_t index, const py::buffer &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_input_tensorinfo(session, index, &tensor_info));
+  const size_t length = num_elems(&tensor_info) * getTypeSize(tensor_info.dtype);
+
+  // NOTE nnfw_set_input does not modify the buffer, so read-only buffer is allowed
+  void *data = contiguous_data(buffer, length, false);
+  ensure_status(nnfw_set_input(session, index, tensor_info.dtype, data, length));
+
+  if (input_buffers.size() <= index)
+    input_buffers.resize(index + 1);
+  input_buffers[index] = buffer;
+}
+
+void NNFW_SESSION::set_output_buffer(uint32_t index, const py::buffer &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+  const size_t length = num_elems(&tensor_info) * getTypeSize(tensor_info.dtype);
+
+  void *data = contiguous_data(buffer, length, true);
+  ensure_status(nnfw_set_output(session, index, tensor_info.dtype, data, length));
+
+  if (output_buffers.size() <= index)
+    output_buffers.resize(index + 1);
+  output_buffers[index] = buffer;
+}
+
 uint32_t NNFW_SESSION::input_size()
 {
   uint32_t number;
@@ -217,7 +318,7 @@ tensorinfo NNFW_SESSION::output_tensorinfo(uint32_t index)
 //////////////////////////////////////////////
 // Internal APIs
 //////////////////////////////////////////////
-py::array NNFW_SESSION::get_output(uint32_t index)
+py::array NNFW_SESSION::get_output(uint32_t index, py::handle owner)
 {
   // First call into the C API
   nnfw_tensorinfo out_info = {};
@@ -239,8 +340,17 @@ py::array NNFW_SESSION::get_output(uint32_t index)
   py::dtype dt = np.attr("dtype")(py::str(getStringType(out_info.dtype))).cast<py::dtype>();
   size_t itemsize = dt.attr("itemsize").cast<size_t>();
 
-  py::array arr(dt, shape);
-  std::memcpy(arr.mutable_data(), out_buffer, num_elements * itemsize);
+  py::array arr;
+  if (owner && index < static_outputs.size() && static_outputs[index])
+  {
+    // View onto the internal buffer, which is overwritten but not reallocated by the next run
+    arr = py::array(dt, shape, {}, out_buffer, owner);
+  }
+  else
+  {
+    arr = py::array(dt, shape);
+    std::memcpy(arr.mutable_data(), out_buffer, num_elements * itemsize);
+  }
   arr.attr("flags").attr("writeable") = false;
 
   return arr;
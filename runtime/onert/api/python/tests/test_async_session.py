@@ -0,0 +1,152 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Run from runtime/onert/api/python: python3 -m unittest discover -s tests -t .
+# With ENABLE_TEST, ctest runs them as onert_python_test with the built binding.
+
+import sys
+import threading
+import time
+import unittest
+from unittest import mock
+
+import numpy as np
+
+# The sessions are replaced with FakeSession, so the native module is not required
+try:
+    import onert.native.libnnfw_api_pybind
+except ImportError:
+    for name in [
+            'onert.native', 'onert.native.libnnfw_api_pybind',
+            'onert.native.libnnfw_api_pybind.exception',
+            'onert.native.libnnfw_api_pybind.train'
+    ]:
+        sys.modules[name] = mock.MagicMock()
+
+import onert.infer  # noqa: E402
+
+async_session_module = sys.modules['onert.infer.async_session']
+
+
+class FakeSession:
+    """
+    Session doubling the input. Runs are recorded and blocked while 'gate' is clear.
+    """
+    runs = []
+    gate = threading.Event()
+    lock = threading.Lock()
+
+    def __init__(self, path, backends='cpu'):
+        pass
+
+    def input_size(self):
+        return 1
+
+    def infer(self, inputs):
+        FakeSession.gate.wait()
+        with FakeSession.lock:
+            FakeSession.runs.append(inputs[0].copy())
+        if (inputs[0] < 0).any():
+            raise ValueError('negative input')
+        return [inputs[0] * 2]
+
+
+class AsyncSessionTestCase(unittest.TestCase):
+    def setUp(self):
+        FakeSession.runs = []
+        FakeSession.gate.set()
+        patcher = mock.patch.object(async_session_module, 'session', FakeSession)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+    def tearDown(self):
+        FakeSession.gate.set()
+
+    def test_batching(self):
+        inputs = [np.full((1, 3), i, dtype=np.float32) for i in range(4)]
+        with async_session_module.async_session('model',
+                                                max_batch_size=4,
+                                                max_delay_ms=1000) as sess:
+            futures = sess.infer_many([[x] for x in inputs])
+            results = [f.result(timeout=10) for f in futures]
+
+        self.assertEqual(len(FakeSession.runs), 1)
+        self.assertEqual(FakeSession.runs[0].shape, (4, 3))
+        for x, result in zip(inputs, results):
+            np.testing.assert_array_equal(result[0], x * 2)
+
+    def test_pad_batch(self):
+        x = np.ones((1, 3), dtype=np.float32)
+        with async_session_module.async_session('model',
+                                                max_batch_size=4,
+                                                max_delay_ms=1,
+                                                pad_batch=True) as sess:
+            result = sess.submit([x]).result(timeout=10)
+
+        self.assertEqual(FakeSession.runs[0].shape, (4, 3))
+        np.testing.assert_array_equal(result[0], x * 2)
+
+    def test_mixed_shape_fairness(self):
+        FakeSession.gate.clear()
+        with async_session_module.async_session('model',
+                                                max_batch_size=2,
+                                                max_delay_ms=10) as sess:
+            # The only session runs the first full batch and blocks in it
+            first = sess.submit([np.zeros((2, 4), dtype=np.float32)])
+            while not first.running():
+                time.sleep(0.001)
+
+            # Another shape arrives before a stream of full batches of the last shape
+            other = sess.submit([np.ones((1, 3), dtype=np.float32)])
+            stream = [sess.submit([np.zeros((2, 4), dtype=np.float32)]) for _ in range(8)]
+            time.sleep(0.05)
+            FakeSession.gate.set()
+
+            other.result(timeout=10)
+            for f in stream:
+                f.result(timeout=10)
+
+        shapes = [run.shape for run in FakeSession.runs]
+        self.assertEqual(shapes[1], (1, 3))
+
+    def test_error_propagation(self):
+        with async_session_module.async_session('model',
+                                                max_batch_size=4,
+                                                max_delay_ms=1000) as sess:
+            futures = sess.infer_many([[np.full((1, 3), v, dtype=np.float32)]
+                                       for v in [1, -1, 2, 3]])
+            for f in futures:
+                with self.assertRaises(ValueError):
+                    f.result(timeout=10)
+
+            # Later requests still run
+            result = sess.submit([np.ones((1, 3), dtype=np.float32)]).result(timeout=10)
+            np.testing.assert_array_equal(result[0], np.full((1, 3), 2))
+
+    def test_wrong_inputs_NEG(self):
+        with async_session_module.async_session('model') as sess:
+            with self.assertRaises(ValueError):
+                sess.submit([])
+
+    def test_submit_after_close_NEG(self):
+        sess = async_session_module.async_session('model')
+        sess.close()
+        with self.assertRaises(RuntimeError):
+            sess.submit([np.ones((1, 3), dtype=np.float32)])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,71 @@
+#!/usr/bin/env python
+
+# Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import unittest
+from unittest import mock
+
+import numpy as np
+
+try:
+    import onert.native.libnnfw_api_pybind as native
+    HAS_BINDING = not isinstance(native, mock.Mock)
+except ImportError:
+    HAS_BINDING = False
+
+# Model with a static shape, also used by nnfw_api tests
+MODEL_PATH = os.environ.get(
+    'ONERT_TEST_MODEL',
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', '..',
+                 'tests', 'nnfw_api', 'res', 'autocompilation', 'conv2d.circle'))
+
+
+@unittest.skipUnless(HAS_BINDING and os.path.exists(MODEL_PATH),
+                     'The native binding or the model is not available')
+class OutputViewTestCase(unittest.TestCase):
+    def setUp(self):
+        from onert import infer
+        self.session = infer.session(MODEL_PATH, 'cpu')
+        info = self.session.get_inputs_tensorinfo()[0]
+        self.shape = tuple(info.dims[:info.rank])
+
+    def test_view_of_static_output(self):
+        x1 = np.arange(np.prod(self.shape), dtype=np.float32).reshape(self.shape)
+        x2 = x1 * -0.5 + 1.0
+
+        view = self.session.infer([x1], zero_copy=True)[0]
+        self.assertFalse(view.flags.writeable)
+        first = view.copy()
+
+        expected = self.session.infer([x2])[0]
+        self.assertFalse(np.array_equal(first, expected))
+
+        # The view is overwritten by the next run, but stays valid
+        np.testing.assert_array_equal(view, expected)
+        second = self.session.infer([x2], zero_copy=True)[0]
+        self.assertTrue(np.shares_memory(view, second))
+
+    def test_copy_by_default(self):
+        x = np.ones(self.shape, dtype=np.float32)
+
+        output = self.session.infer([x])[0]
+        other = self.session.infer([x])[0]
+        self.assertFalse(np.shares_memory(output, other))
+        np.testing.assert_array_equal(output, other)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -70,4 +70,19 @@ void ExternalContext::setMaxNumThreads(int max_num_threads)
   _ruy_context->set_max_num_threads(_max_num_threads);
 }
 
+void ExternalContext::reserveScratchBuffer(size_t size)
+{
+  if (_scratch_buffer.size() < size)
+    _scratch_buffer.resize(size);
+}
+
+uint8_t *ExternalContext::scratchBuffer(size_t size)
+{
+  if (size == 0)
+    return nullptr;
+
+  reserveScratchBuffer(size);
+  return _scratch_buffer.data();
+}
+
 } // namespace onert::backend::cpu
@@ -21,6 +21,7 @@
 #include <ruy/context.h>
 
 #include <memory>
+#include <vector>
 
 namespace onert::backend::cpu
 {
@@ -37,9 +38,28 @@ public:
 
   ruy::Context *ruy_context() const { return _ruy_context.get(); }
 
+  /**
+   * @brief Grow the scratch workspace to at least size bytes
+   *
+   * Layers call this in prepare() with their static requirement so that the workspace is
+   * allocated once, before the first run.
+   */
+  void reserveScratchBuffer(size_t size);
+
+  /**
+   * @brief Return the scratch workspace of at least size bytes
+   *
+   * Kernels of a backend context run one at a time: an executor serializes its runs and the
+   * parallel executor runs each backend on a single thread. So they share one workspace without
+   * locking, whichever thread runs them. It grows only when a run needs more than was reserved
+   * (e.g. dynamic shapes) and is valid until the next call.
+   */
+  uint8_t *scratchBuffer(size_t size);
+
 private:
   int32_t _max_num_threads;
   const std::unique_ptr<ruy::Context> _ruy_context;
+  std::vector<uint8_t> _scratch_buffer;
 };
 
 } // namespace onert::backend::cpu
@@ -58,7 +58,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor, is_cacheable_weights);
+                  activation, ofm_tensor, is_cacheable_weights, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -77,7 +77,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -91,8 +91,8 @@ ConvolutionLayer::ConvolutionLayer()
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
     _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
     _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-    _conv_kernel(new nnfw::cker::Conv()), _prepare(false), _is_cachable_weights(false),
-    _is_hybrid(false)
+    _conv_kernel(new nnfw::cker::Conv()), _external_context(nullptr), _prepare(false),
+    _is_cachable_weights(false), _is_hybrid(false)
 {
   // DO NOTHING
 }
@@ -101,109 +101,37 @@ ConvolutionLayer::~ConvolutionLayer() = default;
 
 void ConvolutionLayer::convFloat32()
 {
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
-  nnfw::cker::ConvParams op_params;
-  op_params.padding_type = getPaddingType(_paddingType);
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidthFactor;
-  op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+  auto ruy_context = _external_context->ruy_context();
+  const auto winograd_size =
+    kernel.winogradBufferSize(getShape(_input), getShape(_kernel), getShape(_output), ruy_context);
+  kernel(_conv_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
          getBuffer<float>(_kernel), getShape(_bias), getBuffer<float>(_bias), getShape(_output),
-         getBuffer<float>(_output));
+         getBuffer<float>(_output), ruy_context, _external_context->scratchBuffer(winograd_size));
 }
 
 void ConvolutionLayer::convQ8uPerTensor()
 {
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-
-  nnfw::cker::ConvParams op_params;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidthFactor;
-  op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.padding_type = getPaddingType(_paddingType);
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.weights_offset = -_kernel->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-  op_params.is_replaced_weights = true;
-
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
+  const auto im2col_size = kernel.im2colBufferSize(_conv_params, getShape(_input),
+                                                   getShape(_kernel), getShape(_output));
+  kernel(_conv_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
          getBuffer<uint8_t>(_kernel), getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output),
-         getBuffer<uint8_t>(_output));
+         getBuffer<uint8_t>(_output), _external_context->scratchBuffer(im2col_size));
 }
 
 void ConvolutionLayer::convQ8uPerChannel()
 {
-  nnfw::cker::ConvParams op_params;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidthFactor;
-  op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-  // NOTE: The following fields of ConvParams are not used:
-  // padding_type, weights_offset, output_{multiplier,shift}, float_activation_{min,max}
-
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
+  kernel(_conv_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
          getBuffer<uint8_t>(_kernel), _kernel->data_zero_points().data(), getShape(_bias),
          getBuffer<int32_t>(_bias), getShape(_output), getBuffer<uint8_t>(_output));
 }
 
 void ConvolutionLayer::convQ8i()
 {
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-
-  nnfw::cker::ConvParams op_params;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  op_params.stride_height = _strideHeight;
-  op_params.stride_width = _strideWidth;
-  op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.dilation_width_factor = _dilationWidthFactor;
-  op_params.padding_values.height = _paddingTop;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  kernel(op_params, getShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+  kernel(_conv_params, getShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
          getShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
          reinterpret_cast<const int32_t *>(_bias->buffer()), getShape(_output),
          reinterpret_cast<int8_t *>(_output->buffer()));
@@ -211,10 +139,6 @@ void ConvolutionLayer::convQ8i()
 
 void ConvolutionLayer::convQ8iHybridPerChannel()
 {
-  float output_activation_min = 0;
-  float output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
   const int batch_size = getShape(_input).Dims(0);
   if (batch_size == 0)
     throw std::runtime_error{"Convolution input batch_size = 0"};
@@ -231,21 +155,10 @@ void ConvolutionLayer::convQ8iHybridPerChannel()
       reinterpret_cast<const float *>(_input->buffer()) + offset, input_size,
       input_quantized_ptr + offset, &input_scaling_factors_ptr[b], &input_offsets_ptr[b]);
   }
-  nnfw::cker::ConvParams op_params;
-  op_params.padding_type = getPaddingType(_paddingType);
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidthFactor;
-  op_params.dilation_height_factor = _dilationHeightFactor;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-
   const auto *filter_per_channel_scales = _kernel->data_scales().data();
   nnfw::cker::reference::HybridConvPerChannel(
-    op_params, input_scaling_factors_ptr, getShape(_input), input_quantized_ptr, getShape(_kernel),
-    reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
+    _conv_params, input_scaling_factors_ptr, getShape(_input), input_quantized_ptr,
+    getShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()), getShape(_bias),
     reinterpret_cast<const float *>(_bias->buffer()), getShape(_output),
     reinterpret_cast<float *>(_output->buffer()), filter_per_channel_scales, input_offsets_ptr);
 }
@@ -258,7 +171,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
                                  const ir::Activation activation, IPortableTensor *output,
-                                 bool is_cachable_weights)
+                                 bool is_cachable_weights,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -275,8 +189,51 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _activation = activation;
   _output = output;
   _is_cachable_weights = is_cachable_weights;
+  _external_context = external_context;
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
+
+  prepareConvParams();
+}
+
+void ConvolutionLayer::prepareConvParams()
+{
+  // Parameters except paddings do not depend on shapes, so they are derived only once
+  _conv_params = nnfw::cker::ConvParams{};
+  _conv_params.padding_type = getPaddingType(_paddingType);
+  _conv_params.padding_values.width = _paddingLeft;
+  _conv_params.padding_values.height = _paddingTop;
+  _conv_params.stride_width = _strideWidth;
+  _conv_params.stride_height = _strideHeight;
+  _conv_params.dilation_width_factor = _dilationWidthFactor;
+  _conv_params.dilation_height_factor = _dilationHeightFactor;
+
+  if (_is_hybrid || _input->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRange(_activation, &_conv_params.float_activation_min,
+                             &_conv_params.float_activation_max);
+    return;
+  }
+
+  if (_input->data_type() != OperandType::QUANT_UINT8_ASYMM &&
+      _input->data_type() != OperandType::QUANT_INT8_ASYMM)
+    return;
+
+  _conv_params.input_offset = -_input->data_zero_point();
+  _conv_params.output_offset = _output->data_zero_point();
+  CalculateActivationRangeQuantized(_activation, _output, &_conv_params.quantized_activation_min,
+                                    &_conv_params.quantized_activation_max);
+
+  const bool per_channel_quantized = _kernel->data_scales().size() > 1;
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM && !per_channel_quantized)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_conv_params.output_multiplier,
+                       &_conv_params.output_shift);
+    _conv_params.weights_offset = -_kernel->data_zero_point();
+    _conv_params.is_replaced_weights = true;
+  }
 }
 
 void ConvolutionLayer::run()
@@ -310,6 +267,8 @@ void ConvolutionLayer::run()
     _paddingRight = padding.right;
     _paddingTop = padding.top;
     _paddingBottom = padding.bottom;
+    _conv_params.padding_values.width = _paddingLeft;
+    _conv_params.padding_values.height = _paddingTop;
   }
   if (_is_hybrid)
   {
@@ -368,7 +327,12 @@ void ConvolutionLayer::prepare()
   {
     bool is_transposed = false;
     kernel.prepareF32(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                      is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+                      is_transposed, _strideWidth, _strideHeight, _dilationWidthFactor,
+                      _dilationHeightFactor);
+    // Reserve the shared workspace before the first run
+    if (!_input->is_dynamic() && !_output->is_dynamic())
+      _external_context->reserveScratchBuffer(kernel.winogradBufferSize(
+        getShape(_input), getShape(_kernel), getShape(_output), _external_context->ruy_context()));
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -395,6 +359,9 @@ void ConvolutionLayer::prepare()
       kernel.prepareQ8uPerTensor(getShape(_input), getShape(_kernel), getShape(_output),
                                  _strideWidth, _strideHeight, _dilationWidthFactor,
                                  _dilationHeightFactor);
+      // Reserve the shared workspace before the first run
+      _external_context->reserveScratchBuffer(kernel.im2colBufferSize(
+        _conv_params, getShape(_input), getShape(_kernel), getShape(_output)));
     }
   }
   else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_CONV2DLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -47,7 +48,8 @@ public:
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t dilationWidthFactor,
                  const uint32_t dilationHeightFactor, const ir::Activation activation,
-                 IPortableTensor *output, bool is_cachable_weights);
+                 IPortableTensor *output, bool is_cachable_weights,
+                 const std::shared_ptr<ExternalContext> &external_context);
   void prepare() override;
   void run() override;
 
@@ -57,6 +59,7 @@ private:
   void convQ8uPerChannel();
   void convQ8i();
   void convQ8iHybridPerChannel();
+  void prepareConvParams();
 
 protected:
   const IPortableTensor *_input;
@@ -76,9 +79,11 @@ protected:
   uint32_t _dilationHeightFactor;
 
   ir::Activation _activation;
+  nnfw::cker::ConvParams _conv_params;
 
   std::unique_ptr<nnfw::cker::Conv> _conv_kernel;
   std::unique_ptr<nnfw::cker::ConvHybridTempArena> _hybrid_arena;
+  std::shared_ptr<ExternalContext> _external_context;
 
   bool _prepare;
   bool _is_cachable_weights;
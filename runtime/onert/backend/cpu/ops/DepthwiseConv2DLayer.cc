@@ -71,20 +71,6 @@ namespace onert::backend::cpu::ops
 
 void DepthwiseConvolutionLayer::convFloat32()
 {
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
-  nnfw::cker::DepthwiseConvParams op_params;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidth;
-  op_params.dilation_height_factor = _dilationHeight;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.depth_multiplier = _multiplier;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-
   // TODO: Use the following call if TensorBuilder manages padded_filter_data
   //       and filter_buffers_data:
   //
@@ -100,69 +86,23 @@ void DepthwiseConvolutionLayer::convFloat32()
   //
   //       See https://github.com/Samsung/ONE/pull/13669 for an example of using DepthwiseConvOp
   nnfw::cker::DepthwiseConv<float, float>(
-    op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+    _op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
     getBuffer<float>(_kernel), getShape(_bias), getBuffer<float>(_bias), getShape(_output),
     getBuffer<float>(_output), _external_context->ruy_context());
 }
 
 void DepthwiseConvolutionLayer::convQ8uPerTensor()
 {
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-
-  nnfw::cker::DepthwiseConvParams op_params;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidth;
-  op_params.dilation_height_factor = _dilationHeight;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.depth_multiplier = _multiplier;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.weights_offset = -_kernel->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-
   nnfw::cker::DepthwiseConv<uint8_t, int32_t>(
-    op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
+    _op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
     getBuffer<uint8_t>(_kernel), getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output),
     getBuffer<uint8_t>(_output), _external_context->ruy_context());
 }
 
 void DepthwiseConvolutionLayer::convQ8uPerChannel()
 {
-  nnfw::cker::DepthwiseConvParams op_params;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidth;
-  op_params.dilation_height_factor = _dilationHeight;
-  op_params.depth_multiplier = _multiplier;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-  // NOTE: The following fields of ConvParams are not used:
-  // padding_type, weights_offset, output_{multiplier,shift}, float_activation_{min,max}
-
   nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
-    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    _op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
     getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel), getBuffer<uint8_t>(_kernel),
     _kernel->data_zero_points().data(), getShape(_bias), getBuffer<int32_t>(_bias),
     getShape(_output), getBuffer<uint8_t>(_output));
@@ -176,28 +116,8 @@ void DepthwiseConvolutionLayer::convQ8i()
     _prepared = true;
   }
 
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-
-  nnfw::cker::DepthwiseConvParams op_params;
-  op_params.padding_type = nnfw::cker::PaddingType::kSame;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.depth_multiplier = _multiplier;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidth;
-  op_params.dilation_height_factor = _dilationHeight;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.weights_offset = 0;
-  op_params.output_offset = _output->data_zero_point();
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-
   nnfw::cker::optimized_integer_ops::DepthwiseConvPerChannel(
-    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    _op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
     getShape(_input), getBuffer<int8_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
     getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output), getBuffer<int8_t>(_output),
     _external_context->ruy_context());
@@ -211,9 +131,6 @@ void DepthwiseConvolutionLayer::convQ8iHybridPerChannel()
     _prepared = true;
   }
 
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
   auto input_shape = getShape(_input);
   const int batch_size = input_shape.Dims(0);
   const int input_size = input_shape.FlatSize() / batch_size;
@@ -229,24 +146,55 @@ void DepthwiseConvolutionLayer::convQ8iHybridPerChannel()
                                                  &scaling_factors_ptr[b], &input_offsets_ptr[b]);
   }
 
-  nnfw::cker::DepthwiseConvParams op_params;
-  op_params.padding_values.width = _paddingLeft;
-  op_params.padding_values.height = _paddingTop;
-  op_params.depth_multiplier = _multiplier;
-  op_params.stride_width = _strideWidth;
-  op_params.stride_height = _strideHeight;
-  op_params.dilation_width_factor = _dilationWidth;
-  op_params.dilation_height_factor = _dilationHeight;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-
   nnfw::cker::reference_integer_ops::DepthwiseConvHybridPerChannel(
-    op_params, _input_scaling_factors.data(), getShape(_input), _input_quantized.data(),
+    _op_params, _input_scaling_factors.data(), getShape(_input), _input_quantized.data(),
     getShape(_kernel), getBuffer<int8_t>(_kernel), getShape(_bias), getBuffer<float>(_bias),
     getShape(_output), getBuffer<float>(_output), _kernel->data_scales().data(),
     _input_offsets.data());
 }
 
+void DepthwiseConvolutionLayer::prepareOpParams()
+{
+  // Parameters do not depend on shapes, so they are derived only once
+  _op_params = nnfw::cker::DepthwiseConvParams{};
+  _op_params.padding_values.width = _paddingLeft;
+  _op_params.padding_values.height = _paddingTop;
+  _op_params.stride_width = _strideWidth;
+  _op_params.stride_height = _strideHeight;
+  _op_params.dilation_width_factor = _dilationWidth;
+  _op_params.dilation_height_factor = _dilationHeight;
+  _op_params.depth_multiplier = _multiplier;
+
+  if (_is_hybrid || _input->data_type() == OperandType::FLOAT32)
+  {
+    CalculateActivationRange(_activation, &_op_params.float_activation_min,
+                             &_op_params.float_activation_max);
+    return;
+  }
+
+  if (_input->data_type() != OperandType::QUANT_UINT8_ASYMM &&
+      _input->data_type() != OperandType::QUANT_INT8_ASYMM)
+    return;
+
+  _op_params.input_offset = -_input->data_zero_point();
+  _op_params.output_offset = _output->data_zero_point();
+  CalculateActivationRangeQuantized(_activation, _output, &_op_params.quantized_activation_min,
+                                    &_op_params.quantized_activation_max);
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    _op_params.padding_type = nnfw::cker::PaddingType::kSame;
+    _op_params.weights_offset = 0;
+  }
+  else if (_kernel->data_scales().size() <= 1)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _kernel, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_op_params.output_multiplier, &_op_params.output_shift);
+    _op_params.weights_offset = -_kernel->data_zero_point();
+  }
+}
+
 void DepthwiseConvolutionLayer::prepareQ8i()
 {
   GetQuantizedConvolutionMultipliersAndShifts(
@@ -314,6 +262,8 @@ void DepthwiseConvolutionLayer::configure(
   _is_hybrid = _input->data_type() == OperandType::FLOAT32 &&
                _kernel->data_type() == OperandType::QUANT_INT8_SYMM;
 
+  prepareOpParams();
+
   if (_is_hybrid)
   {
     ensureQ8iHybridPerChannel();
@@ -51,6 +51,7 @@ public:
   void run() override;
 
 private:
+  void prepareOpParams();
   void prepareQ8i();
   void prepareQ8uPerChannel();
   void prepareQ8iHybridPerChannel();
@@ -78,6 +79,8 @@ protected:
   ir::Activation _activation{ir::Activation::NONE};
 
 private:
+  nnfw::cker::DepthwiseConvParams _op_params{};
+
   std::shared_ptr<ExternalContext> _external_context;
 
   bool _prepared{false};
@@ -66,7 +66,8 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                node.param().approximate, convertElementwiseActivationType(node.param().op_type));
+                node.param().approximate, convertElementwiseActivationType(node.param().op_type),
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -77,7 +78,7 @@ namespace onert::backend::cpu::ops
 {
 
 ElementwiseActivationLayer::ElementwiseActivationLayer()
-  : _input(nullptr), _output(nullptr), _kernel()
+  : _input(nullptr), _output(nullptr), _kernel(), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -128,10 +129,12 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
 
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta, bool approximate,
-                                           ElementwiseActivationType op_type)
+                                           ElementwiseActivationType op_type,
+                                           const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
@@ -157,9 +160,9 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Logistic(getShape(input), getBuffer<float>(input), getShape(output),
-                               getBuffer<float>(output));
+                               getBuffer<float>(output), _external_context->ruy_context());
         };
       }
       else
@@ -204,9 +207,9 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::Tanh(getShape(input), getBuffer<float>(input), getShape(output),
-                           getBuffer<float>(output));
+                           getBuffer<float>(output), _external_context->ruy_context());
         };
       }
       else
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -41,7 +42,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
-                 bool approximate, const ElementwiseActivationType op_type);
+                 bool approximate, const ElementwiseActivationType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -54,6 +56,7 @@ protected:
   IPortableTensor *_output;
   uint8_t _table[256];
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace onert::backend::cpu::ops
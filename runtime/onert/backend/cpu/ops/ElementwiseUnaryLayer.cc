@@ -93,7 +93,8 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   else
   {
     auto fn = std::make_unique<ops::ElementwiseUnaryLayer>();
-    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type));
+    fn->configure(input_tensor, output_tensor, convertElementwiseUnaryType(node.param().op_type),
+                  _external_context);
     _return_fn = std::move(fn);
   }
 }
@@ -206,10 +207,10 @@ void dequantizeInt16(const IPortableTensor *input, IPortableTensor *output)
                          getBuffer<float>(output), input->data_scale(), input->data_zero_point());
 }
 
-void expFloat32(const IPortableTensor *input, IPortableTensor *output)
+void expFloat32(const IPortableTensor *input, IPortableTensor *output, ruy::Context *ruy_context)
 {
   nnfw::cker::Exp(getShape(input), getBuffer<float>(input), getShape(output),
-                  getBuffer<float>(output));
+                  getBuffer<float>(output), ruy_context);
 }
 
 void erfFloat32(const IPortableTensor *input, IPortableTensor *output)
@@ -283,13 +284,15 @@ template <typename T> void zerosLikeFloat32(const IPortableTensor *input, IPorta
 } // namespace
 
 void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                                      const ElementwiseUnaryType op_type)
+                                      const ElementwiseUnaryType op_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   switch (op_type)
   {
@@ -338,7 +341,9 @@ void ElementwiseUnaryLayer::configure(const IPortableTensor *input, IPortableTen
     case ElementwiseUnaryType::kExp:
       if ((input->data_type() == OperandType::FLOAT32))
       {
-        _kernel = expFloat32;
+        _kernel = [this](const IPortableTensor *input, IPortableTensor *output) {
+          expFloat32(input, output, _external_context->ruy_context());
+        };
       }
       else
       {
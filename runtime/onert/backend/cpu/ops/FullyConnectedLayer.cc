@@ -21,6 +21,7 @@
 #include "../Validator.h"
 
 #include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedBlockQuant.h>
 #include <cker/TensorUtils.h>
 #include <misc/polymorphic_downcast.h>
 
@@ -31,14 +32,24 @@ void Validator::visit(const ir::operation::FullyConnected &node)
 {
   using ir::operation::FullyConnected;
 
+  const auto input_index{node.getInputs().at(FullyConnected::Input::INPUT)};
   const auto weight_index{node.getInputs().at(FullyConnected::Input::WEIGHT)};
+  const auto input_node = &_graph.operands().at(input_index);
   const auto weight_node = &_graph.operands().at(weight_index);
 
   _supported = false;
 
+  // Block quantized weights are supported for float input and 2D weights with
+  // rows of whole blocks only
   if (weight_node->typeInfo().type() == ir::DataType::QUANT_GGML_Q4_0 ||
       weight_node->typeInfo().type() == ir::DataType::QUANT_GGML_Q8_0)
-    return;
+  {
+    if (input_node->typeInfo().type() != ir::DataType::FLOAT32)
+      return;
+    if (weight_node->shape().rank() != 2 ||
+        weight_node->shape().dim(1) % nnfw::cker::block_quant::kBlockSize != 0)
+      return;
+  }
 
   _supported = true;
 }
@@ -75,7 +86,8 @@ namespace onert::backend::cpu::ops
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
-    _external_context(nullptr), _is_hybrid(false), _is_shuffled16x1float32(false)
+    _block_quant_temp_arena(new nnfw::cker::FCBlockQuantTempArena()), _external_context(nullptr),
+    _is_hybrid(false), _is_shuffled16x1float32(false)
 {
   // DO NOTHING
 }
@@ -84,19 +96,7 @@ FullyConnectedLayer::~FullyConnectedLayer() = default;
 
 void FullyConnectedLayer::fullyConnectedFloat32()
 {
-  nnfw::cker::FullyConnectedParams op_params;
-  float output_activation_min = 0;
-  float output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
-  op_params.activation = convertActivationType(_activation);
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-  // TODO Set both cachables as false when training
-  op_params.lhs_cacheable = _weights->is_constant();
-  op_params.rhs_cacheable = _input->is_constant();
-
-  nnfw::cker::FullyConnected(op_params, getShape(_input), getBuffer<float>(_input),
+  nnfw::cker::FullyConnected(_op_params, getShape(_input), getBuffer<float>(_input),
                              getShape(_weights), getBuffer<float>(_weights), getShape(_bias),
                              _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output),
                              getBuffer<float>(_output));
@@ -106,26 +106,7 @@ void FullyConnectedLayer::fullyConnectedFloat32()
 // like gemmlowp::GemmContext.
 void FullyConnectedLayer::fullyConnectedQuant8()
 {
-  double real_multiplier = 0.0;
-  int32_t output_multiplier = 0;
-  int32_t output_shift = 0;
-  int32_t output_activation_min = 0;
-  int32_t output_activation_max = 0;
-  GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
-  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
-  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
-                                    &output_activation_max);
-
-  nnfw::cker::FullyConnectedParams op_params;
-  op_params.input_offset = -_input->data_zero_point();
-  op_params.weights_offset = -_weights->data_zero_point();
-  op_params.output_offset = _output->data_zero_point();
-  op_params.output_multiplier = output_multiplier;
-  op_params.output_shift = output_shift;
-  op_params.quantized_activation_min = output_activation_min;
-  op_params.quantized_activation_max = output_activation_max;
-
-  nnfw::cker::FullyConnected(op_params, getShape(_input), getBuffer<uint8_t>(_input),
+  nnfw::cker::FullyConnected(_op_params, getShape(_input), getBuffer<uint8_t>(_input),
                              getShape(_weights), getBuffer<uint8_t>(_weights), getShape(_bias),
                              _bias ? getBuffer<int32_t>(_bias) : nullptr, getShape(_output),
                              getBuffer<uint8_t>(_output));
@@ -139,18 +120,14 @@ void FullyConnectedLayer::fullyConnectedHybrid()
     temp_arena.prepare(getShape(_input), getShape(_weights));
   }
 
-  nnfw::cker::FullyConnectedParams op_params;
-  op_params.activation = convertActivationType(_activation);
-  op_params.weights_scale = _weights->data_scale();
-
 #ifndef USE_RUY_GEMV
   nnfw::cker::FullyConnectedHybrid(
-    op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+    _op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
     getBuffer<int8_t>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
     getShape(_output), getBuffer<float>(_output), temp_arena, _external_context->ruy_context());
 #else
   nnfw::cker::FullyConnectedHybrid(
-    op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+    _op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
     (_cached_weights) ? reinterpret_cast<const int8_t *>(_cached_weights)
                       : getBuffer<int8_t>(_weights),
     getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output),
@@ -194,9 +171,6 @@ void FullyConnectedLayer::fullyConnectedHybrid()
 
 void FullyConnectedLayer::fullyConnectedSparseWeight()
 {
-  nnfw::cker::FullyConnectedParams op_params;
-  op_params.activation = convertActivationType(_activation);
-
   const uint16_t *w1_segments = _weights->sparsity()->w1_segments();
   const uint16_t *w1_indices = _weights->sparsity()->w1_indices();
 
@@ -204,14 +178,14 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
   if (block_size.size() == 0)
   {
     nnfw::cker::FullyConnectedSparseWeightRandom(
-      op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+      _op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
       getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
   }
   else if (block_size.size() == 2 && block_size[0] == 16 && block_size[1] == 1)
   {
     nnfw::cker::FullyConnectedSparseWeight16x1(
-      op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
+      _op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
       getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
   }
@@ -219,16 +193,23 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
     throw std::runtime_error{"FullyConnected: unsupported sparsity"};
 }
 
+void FullyConnectedLayer::fullyConnectedGGMLWeight()
+{
+  const auto weights_type = _weights->data_type() == OperandType::QUANT_GGML_Q4_0
+                              ? nnfw::cker::BlockQuantType::Q4_0
+                              : nnfw::cker::BlockQuantType::Q8_0;
+
+  nnfw::cker::FullyConnectedBlockQuant(
+    _op_params, getShape(_input), getBuffer<float>(_input), weights_type, getShape(_weights),
+    _weights->buffer(), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
+    getShape(_output), getBuffer<float>(_output), *_block_quant_temp_arena,
+    _external_context->ruy_context());
+}
+
 void FullyConnectedLayer::fullyConnected16x1Float32()
 {
 #if defined(__aarch64__) && defined(USE_NEON)
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
-  nnfw::cker::FullyConnectedParams op_params;
-  op_params.activation = convertActivationType(_activation);
-
-  nnfw::cker::FullyConnected16x1Float32(op_params, getShape(_input), getBuffer<float>(_input),
+  nnfw::cker::FullyConnected16x1Float32(_op_params, getShape(_input), getBuffer<float>(_input),
                                         getShape(_weights), getBuffer<float>(_weights),
                                         getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
                                         getShape(_output), getBuffer<float>(_output));
@@ -259,6 +240,38 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   }
 #endif
   _external_context = external_context;
+
+  prepareOpParams();
+}
+
+void FullyConnectedLayer::prepareOpParams()
+{
+  // Quantization parameters and activation do not depend on shapes, so they are derived only once
+  _op_params = nnfw::cker::FullyConnectedParams{};
+
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    double real_multiplier = 0.0;
+    GetQuantizedConvolutionMultiplier(_input, _weights, _bias, _output, &real_multiplier);
+    QuantizeMultiplier(real_multiplier, &_op_params.output_multiplier, &_op_params.output_shift);
+    CalculateActivationRangeQuantized(_activation, _output, &_op_params.quantized_activation_min,
+                                      &_op_params.quantized_activation_max);
+    _op_params.input_offset = -_input->data_zero_point();
+    _op_params.weights_offset = -_weights->data_zero_point();
+    _op_params.output_offset = _output->data_zero_point();
+  }
+  else
+  {
+    _op_params.activation = convertActivationType(_activation);
+    CalculateActivationRange(_activation, &_op_params.float_activation_min,
+                             &_op_params.float_activation_max);
+    if (_is_hybrid)
+      _op_params.weights_scale = _weights->data_scale();
+  }
+
+  // TODO Set both cachables as false when training
+  _op_params.lhs_cacheable = _weights->is_constant();
+  _op_params.rhs_cacheable = _input->is_constant();
 }
 
 void FullyConnectedLayer::run()
@@ -271,6 +284,11 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (_weights->data_type() == OperandType::QUANT_GGML_Q4_0 ||
+           _weights->data_type() == OperandType::QUANT_GGML_Q8_0)
+  {
+    fullyConnectedGGMLWeight();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
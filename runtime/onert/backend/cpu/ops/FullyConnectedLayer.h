@@ -26,6 +26,7 @@
 namespace nnfw::cker
 {
 class FCTempArena;
+struct FCBlockQuantTempArena;
 } // namespace nnfw::cker
 
 namespace onert::backend::cpu::ops
@@ -59,6 +60,9 @@ public:
 
   void prepare() override;
 
+private:
+  void prepareOpParams();
+
 protected:
   const IPortableTensor *_input;
   const IPortableTensor *_weights;
@@ -66,7 +70,9 @@ protected:
   IPortableTensor *_output;
 
   ir::Activation _activation;
+  nnfw::cker::FullyConnectedParams _op_params;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+  std::unique_ptr<nnfw::cker::FCBlockQuantTempArena> _block_quant_temp_arena;
 
   std::shared_ptr<ExternalContext> _external_context;
 
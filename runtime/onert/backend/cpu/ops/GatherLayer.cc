@@ -31,11 +31,23 @@ void Validator::visit(const ir::operation::Gather &node)
 
   const auto input_index{node.getInputs().at(Gather::Input::INPUT)};
   const auto input_node = &_graph.operands().at(input_index);
+  const auto output_index{node.getOutputs().at(0)};
+  const auto output_node = &_graph.operands().at(output_index);
 
   _supported = false;
 
-  if (input_node->typeInfo().type() == ir::DataType::QUANT_GGML_Q4_0)
-    return;
+  // Block quantized input is supported for 2D input with rows of whole blocks on axis 0 only
+  const auto input_type = input_node->typeInfo().type();
+  if (input_type == ir::DataType::QUANT_GGML_Q4_0 || input_type == ir::DataType::QUANT_GGML_Q8_0)
+  {
+    const auto &shape = input_node->shape();
+    if (shape.rank() != 2 || shape.dim(1) % nnfw::cker::block_quant::kBlockSize != 0)
+      return;
+    if (ops::getAxis(shape.rank(), node.param().axis) != 0)
+      return;
+    if (output_node->typeInfo().type() != ir::DataType::FLOAT32)
+      return;
+  }
 
   _supported = true;
 }
@@ -105,10 +117,37 @@ template <typename InputType> void GatherLayer::runByInputType()
   }
 }
 
+void GatherLayer::runByBlockQuant()
+{
+  const auto input_type = _input->data_type() == OperandType::QUANT_GGML_Q4_0
+                            ? nnfw::cker::BlockQuantType::Q4_0
+                            : nnfw::cker::BlockQuantType::Q8_0;
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      nnfw::cker::GatherBlockQuant<int32_t>(input_type, getShape(_input), _input->buffer(),
+                                            getShape(_indices), getBuffer<int32_t>(_indices),
+                                            getShape(_output), getBuffer<float>(_output));
+      break;
+    case OperandType::INT64:
+      nnfw::cker::GatherBlockQuant<int64_t>(input_type, getShape(_input), _input->buffer(),
+                                            getShape(_indices), getBuffer<int64_t>(_indices),
+                                            getShape(_output), getBuffer<float>(_output));
+      break;
+    default:
+      throw std::runtime_error("Gather: unsupported indices data type");
+  }
+}
+
 void GatherLayer::run()
 {
   switch (_input->data_type())
   {
+    case OperandType::QUANT_GGML_Q4_0:
+    case OperandType::QUANT_GGML_Q8_0:
+      runByBlockQuant();
+      break;
     case OperandType::FLOAT32:
       runByInputType<float>();
       break;
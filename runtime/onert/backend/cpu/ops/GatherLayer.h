@@ -40,6 +40,7 @@ public:
 
 private:
   template <typename OpType> void runByInputType();
+  void runByBlockQuant();
 
 private:
   const IPortableTensor *_input;
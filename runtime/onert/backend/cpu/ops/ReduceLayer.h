@@ -20,6 +20,7 @@
 #include "cker/neon/neon_check.h"
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 #include <memory>
@@ -51,7 +52,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 ReduceType reduceType, bool keep_dims);
+                 ReduceType reduceType, bool keep_dims,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -66,6 +68,7 @@ private:
     _kernel;
 
   ReduceType _reduceType;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 class MeanLayer : public ::onert::exec::IFunction
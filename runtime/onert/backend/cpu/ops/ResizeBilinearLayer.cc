@@ -44,7 +44,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -57,11 +57,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -75,14 +76,15 @@ namespace onert::backend::cpu::ops
 
 ResizeBilinearLayer::ResizeBilinearLayer()
   : _input(nullptr), _output(nullptr), _size(nullptr), _output_height(0), _output_width(0),
-    _align_corners(false), _half_pixel_centers(false)
+    _align_corners(false), _half_pixel_centers(false), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     const IPortableTensor *size, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(!size->is_constant());
   _input = input;
@@ -90,11 +92,13 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _size = size;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     int32_t output_height, int32_t output_width, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(_size == nullptr);
   if (output_height < 0)
@@ -113,6 +117,7 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _output_width = output_width;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
 void ResizeBilinearLayer::run()
@@ -136,7 +141,8 @@ void ResizeBilinearLayer::run()
   {
     case OperandType::FLOAT32:
       nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<float>(_input),
-                                 getShape(_output), getBuffer<float>(_output));
+                                 getShape(_output), getBuffer<float>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::QUANT_UINT8_ASYMM:
@@ -39,7 +39,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -49,7 +49,8 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 namespace onert::backend::cpu::ops
 {
 
-SoftMaxLayer::SoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0)
+SoftMaxLayer::SoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _beta(0.0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -69,14 +70,14 @@ void SoftMaxLayer::softmaxFloat32()
 
     uint32_t input_size = getNumberOfElements(_input) / batch_size;
     nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else if (getNumberOfDimensions(_input) == 4)
   {
     nnfw::cker::SoftmaxParams op_params;
     op_params.beta = _beta;
     nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), _external_context->ruy_context());
   }
   else
   {
@@ -106,11 +107,13 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 }
 
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
+  _external_context = external_context;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
       _input->data_type() == OperandType::QUANT_INT8_ASYMM)
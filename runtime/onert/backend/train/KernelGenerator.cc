@@ -170,7 +170,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -221,7 +221,7 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
   fn->configure(in_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left, padding.right,
                 padding.top, padding.bottom, stride.horizontal, stride.vertical,
                 dilation.width_factor, dilation.height_factor, activation, out_tensor,
-                is_cacheable_weights);
+                is_cacheable_weights, _external_context);
 
   auto ker_grad_tensor = _tensor_reg->getGradientTensor(ker_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -324,7 +324,8 @@ void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &n
   };
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                node.param().approximate, convertToInferActivationType(node.param().op_type));
+                node.param().approximate, convertToInferActivationType(node.param().op_type),
+                _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -601,7 +602,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
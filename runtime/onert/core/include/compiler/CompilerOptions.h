@@ -68,6 +68,7 @@ struct CompilerOptions
   std::unordered_map<ir::IODesc, ir::Layout> output_layout;
   std::unordered_map<ir::IODesc, ir::TypeInfo> input_type;
   std::unordered_map<ir::IODesc, ir::TypeInfo> output_type;
+  int plan_cache_size; //< Number of plans cached for changed input shapes, 0 to disable
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
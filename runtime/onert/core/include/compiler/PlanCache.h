@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PLAN_CACHE_H__
+#define __ONERT_COMPILER_PLAN_CACHE_H__
+
+#include "ICompiler.h"
+#include "CompilerOptions.h"
+#include "ir/NNPkg.h"
+#include "ir/Shape.h"
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace onert::compiler
+{
+
+/**
+ * @brief Cache of compiled plans keyed by shapes of package inputs
+ *
+ * A plan compiled with static input shapes runs without dynamic shape inference and dynamic
+ * tensor allocation. Compilation costs more than a few dynamic runs, so shapes requested for
+ * the first time are only remembered, and PlanCache compiles a copy of the original package
+ * with those shapes when they are requested again. At most capacity such shapes are remembered.
+ * The least recently used plan is evicted when the number of plans exceeds the capacity.
+ */
+class PlanCache
+{
+public:
+  using Shapes = std::vector<ir::Shape>;
+
+public:
+  /**
+   * @brief Construct a new PlanCache object
+   *
+   * @param[in] nnpkg    Package before compilation. PlanCache keeps a deep copy of it
+   *                     because compilation modifies the package.
+   * @param[in] copts    Compiler options to compile new plans
+   * @param[in] capacity Maximum number of cached plans
+   */
+  PlanCache(const ir::NNPkg &nnpkg, CompilerOptions *copts, size_t capacity);
+
+public:
+  /**
+   * @brief Add a plan which is already compiled with given input shapes
+   */
+  void insert(const Shapes &input_shapes, const std::shared_ptr<CompilerArtifact> &artifact);
+
+  /**
+   * @brief Return the plan for given input shapes
+   *
+   * @return Cached plan, or a new plan if the shapes were requested before.
+   *         nullptr if the shapes are requested for the first time.
+   */
+  std::shared_ptr<CompilerArtifact> get(const Shapes &input_shapes);
+
+  size_t size() const { return _plans.size(); }
+  size_t capacity() const { return _capacity; }
+
+private:
+  std::unique_ptr<ir::NNPkg> _nnpkg;
+  CompilerOptions *_copts;
+  size_t _capacity;
+  // Most recently used plan comes first
+  std::list<std::pair<Shapes, std::shared_ptr<CompilerArtifact>>> _plans;
+  // Shapes requested once without a plan, most recently requested first
+  std::list<Shapes> _requested;
+};
+
+} // namespace onert::compiler
+
+#endif // __ONERT_COMPILER_PLAN_CACHE_H__
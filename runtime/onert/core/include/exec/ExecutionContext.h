@@ -58,6 +58,7 @@ struct ExecutionOptions
   bool dump_minmax = false;
   bool trace = false;
   bool profile = false;
+  bool perf_counters = false;
 
   static void fromGlobalConfig(ExecutionOptions &options);
 };
@@ -53,6 +53,9 @@ void WhileLayer::run()
   // // Run cond subg
   // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
   // "_dst_tensors"
+  //
+  // If loop-carried tensors keep their shapes and types, body subg outputs are written to temp
+  // tensors and "_output_tensors" alternately instead of being copied in every iteration
   auto cond_exec = _executors->at(_model_index, _cond_subg_index);
   auto body_exec = _executors->at(_model_index, _body_subg_index);
 
@@ -107,32 +110,47 @@ void WhileLayer::run()
   PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, permute_types,
                                                _external_context};
 
-  const auto body_execute_with_op_inputs = [&]() {
+  const auto body_execute = [&](const std::vector<IPortableTensor *> &inputs,
+                                const std::vector<IPortableTensor *> &outputs) {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_input_tensors, temp_outputs, options);
+    body_exec->execute(inputs, outputs, options);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
   };
 
-  const auto body_execute_with_body_outputs = [&]() {
-    VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_output_tensors, temp_outputs, options);
-    VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
-
-  std::function<void()> body_execute = body_execute_with_op_inputs;
-  const auto cond_execute = [&]() {
+  const auto cond_execute = [&](const std::vector<IPortableTensor *> &inputs) {
     VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-    cond_exec->execute(_output_tensors, {cond_output_tensor.get()}, options);
+    cond_exec->execute(inputs, {cond_output_tensor.get()}, options);
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
   };
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor.get()))
+  if (canSwapLoopCarried(body_exec))
+  {
+    // Body subg writes to temp tensors and op outputs alternately, and reads the tensors written
+    // in the previous iteration. Results are copied only once after the loop if needed.
+    const std::vector<IPortableTensor *> *body_inputs = &_input_tensors;
+    const std::vector<IPortableTensor *> *body_results = &temp_outputs;
+    while (getResultCond(cond_output_tensor.get()))
+    {
+      body_execute(*body_inputs, *body_results);
+      cond_execute(*body_results);
+      body_inputs = body_results;
+      body_results = (body_results == &temp_outputs) ? &_output_tensors : &temp_outputs;
+    }
+
+    if (body_inputs != &_output_tensors)
+      copy_body_outputs_to_op_outputs.run();
+  }
+  else
   {
-    body_execute();
-    copy_body_outputs_to_op_outputs.run();
-    cond_execute();
-    body_execute = body_execute_with_body_outputs;
+    // Loop while Cond subgraph's output is true
+    const std::vector<IPortableTensor *> *body_inputs = &_input_tensors;
+    while (getResultCond(cond_output_tensor.get()))
+    {
+      body_execute(*body_inputs, temp_outputs);
+      copy_body_outputs_to_op_outputs.run();
+      cond_execute(_output_tensors);
+      body_inputs = &_output_tensors;
+    }
   }
 
   // Clean-up the temp tensors
@@ -143,4 +161,25 @@ void WhileLayer::run()
   }
 }
 
+bool WhileLayer::canSwapLoopCarried(const exec::IExecutor *body_exec) const
+{
+  // Body outputs can be written to op outputs directly only if they have the same static shapes
+  // and types, and so do op inputs which are read in the first iteration
+  assert(body_exec->outputSize() == _output_tensors.size());
+  for (uint32_t i = 0; i < _output_tensors.size(); ++i)
+  {
+    const auto input = _input_tensors.at(i);
+    const auto output = _output_tensors.at(i);
+    const auto &body_output_info = body_exec->outputInfo(i);
+    if (output->is_dynamic() || body_output_info.isDynamic())
+      return false;
+    if (output->data_type() != body_output_info.typeInfo().type() ||
+        input->data_type() != output->data_type())
+      return false;
+    if (output->getShape() != body_output_info.shape() || input->getShape() != output->getShape())
+      return false;
+  }
+  return true;
+}
+
 } // namespace onert::backend::builtin::kernel
@@ -42,6 +42,9 @@ public:
 public:
   void run() override;
 
+private:
+  bool canSwapLoopCarried(const exec::IExecutor *body_exec) const;
+
 private:
   const ir::SubgraphIndex _cond_subg_index;
   const ir::SubgraphIndex _body_subg_index;
@@ -82,6 +82,7 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   o->he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   o->fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
   o->workspace_dir = util::getConfigString(util::config::WORKSPACE_DIR);
+  o->plan_cache_size = util::getConfigInt(util::config::PLAN_CACHE_SIZE);
   {
     // Backend for all
     auto &ms_options = o->manual_scheduler_options;
@@ -123,6 +124,7 @@ void CompilerOptions::verboseOptions()
   VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
   VERBOSE(Compiler) << "backend_list             : "
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
+  VERBOSE(Compiler) << "plan_cache_size          : " << plan_cache_size << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
   VERBOSE(Compiler) << "manual_scheduler_options : "
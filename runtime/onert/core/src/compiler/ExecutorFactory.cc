@@ -28,6 +28,7 @@
 #include "../exec/LinearExecutor.h"
 #include "../exec/MinMaxRecorder.h"
 #include "../exec/ParallelExecutor.h"
+#include "../exec/PerfCounterObserver.h"
 #include "../exec/train/TrainableExecutor.h"
 #include "../ir/OperationCloner.h"
 
@@ -536,6 +537,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   {
     exec->addObserver(
       std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(
+      std::make_unique<exec::PerfCounterObserver>(options->workspace_dir, exec->graph()));
     exec->addObserver(std::make_unique<exec::MinMaxRecorder>(options->workspace_dir, exec->graph(),
                                                              exec->getBackendContexts()));
   }
@@ -628,6 +631,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   {
     exec->addObserver(
       std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(
+      std::make_unique<exec::PerfCounterObserver>(options->workspace_dir, exec->graph()));
   }
 
   return exec;
@@ -915,6 +920,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
   {
     exec->addObserver(
       std::make_unique<exec::TracingObserver>(options->workspace_dir, exec->graph(), tracing_ctx));
+    exec->addObserver(
+      std::make_unique<exec::PerfCounterObserver>(options->workspace_dir, exec->graph()));
   }
   // TODO Support MINMAX_DUMPER
 
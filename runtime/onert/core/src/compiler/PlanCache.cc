@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/PlanCache.h"
+
+#include "compiler/CompilerFactory.h"
+#include "ir/Graph.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace onert::compiler
+{
+
+namespace
+{
+
+std::shared_ptr<ir::Model> cloneModel(const ir::Model &model)
+{
+  auto cloned = std::make_shared<ir::Model>();
+  model.iterate([&](const ir::SubgraphIndex &subg_index, const ir::IGraph &subg) {
+    const auto graph = dynamic_cast<const ir::Graph *>(&subg);
+    if (graph == nullptr)
+      throw std::runtime_error{"PlanCache: Unsupported graph type"};
+    cloned->push(subg_index, std::make_shared<ir::Graph>(*graph));
+  });
+  cloned->bindKernelBuilder(model.getKernelBuilder());
+  for (const auto &[subg_index, name] : model.signatureMap())
+    cloned->addSignatureMap(subg_index, name);
+
+  return cloned;
+}
+
+// Copying NNPkg shares models, so copy each model deeply
+std::unique_ptr<ir::NNPkg> clonePackage(const ir::NNPkg &nnpkg)
+{
+  auto cloned = std::make_unique<ir::NNPkg>(nnpkg);
+  for (uint16_t i = 0; i < cloned->model_count(); ++i)
+  {
+    auto &model = cloned->model(ir::ModelIndex{i});
+    model = cloneModel(*model);
+  }
+  return cloned;
+}
+
+} // namespace
+
+PlanCache::PlanCache(const ir::NNPkg &nnpkg, CompilerOptions *copts, size_t capacity)
+  : _nnpkg{clonePackage(nnpkg)}, _copts{copts}, _capacity{capacity}
+{
+  if (_capacity == 0)
+    throw std::invalid_argument{"PlanCache: capacity must be positive"};
+}
+
+void PlanCache::insert(const Shapes &input_shapes,
+                       const std::shared_ptr<CompilerArtifact> &artifact)
+{
+  for (auto it = _plans.begin(); it != _plans.end(); ++it)
+  {
+    if (it->first == input_shapes)
+    {
+      _plans.erase(it);
+      break;
+    }
+  }
+  _requested.remove(input_shapes);
+
+  _plans.emplace_front(input_shapes, artifact);
+  if (_plans.size() > _capacity)
+    _plans.pop_back();
+}
+
+std::shared_ptr<CompilerArtifact> PlanCache::get(const Shapes &input_shapes)
+{
+  for (auto it = _plans.begin(); it != _plans.end(); ++it)
+  {
+    if (it->first == input_shapes)
+    {
+      _plans.splice(_plans.begin(), _plans, it);
+      return it->second;
+    }
+  }
+
+  if (input_shapes.size() != _nnpkg->inputSize())
+    throw std::runtime_error{"PlanCache: Invalid number of input shapes"};
+
+  auto requested = std::find(_requested.begin(), _requested.end(), input_shapes);
+  if (requested == _requested.end())
+  {
+    _requested.emplace_front(input_shapes);
+    if (_requested.size() > _capacity)
+      _requested.pop_back();
+    return nullptr;
+  }
+  _requested.erase(requested);
+
+  VERBOSE(PlanCache) << "Compile new plan for repeated input shapes" << std::endl;
+
+  auto nnpkg = clonePackage(*_nnpkg);
+  for (uint32_t i = 0; i < input_shapes.size(); ++i)
+    nnpkg->changeInputShape(ir::IOIndex{i}, input_shapes[i]);
+
+  auto compiler = CompilerFactory::get().create(std::move(nnpkg), _copts);
+  std::shared_ptr<CompilerArtifact> artifact = compiler->compile();
+  insert(input_shapes, artifact);
+
+  return artifact;
+}
+
+} // namespace onert::compiler
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/PlanCache.h"
+
+#include "exec/Execution.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "util/TracingCtx.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace onert::ir;
+using onert::compiler::PlanCache;
+
+class MockUpModel
+{
+public:
+  MockUpModel()
+  {
+    // Model: an elementwise add operation with constant
+    // model input: lhs
+    // model output: result
+    // result <= (lhs + rhs)
+    // lhs, rhs, result shape: {1, 2, 2, 1}
+    auto graph = std::make_shared<Graph>();
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+    static float rhs_data[4] = {3, 1, -1, 5};
+    auto operand_lhs = graph->addOperand(shape, type);
+    auto operand_rhs = graph->addOperand(shape, type);
+    auto operand_result = graph->addOperand(shape, type);
+    graph->operands()
+      .at(operand_rhs)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&rhs_data), 16));
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = Activation::NONE;
+    graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{operand_lhs, operand_rhs}, OperandIndexSequence{operand_result},
+      param));
+    graph->addInput(operand_lhs);
+    graph->addOutput(operand_result);
+    graph->verify();
+
+    auto model = std::make_shared<Model>();
+    model->push(SubgraphIndex{0}, graph);
+    nnpkg = std::make_unique<NNPkg>(model);
+    input = operand_lhs;
+
+    coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+  }
+
+  const Graph &graph() const
+  {
+    return dynamic_cast<const Graph &>(*nnpkg->primary_model()->primary_subgraph());
+  }
+
+public:
+  std::unique_ptr<NNPkg> nnpkg;
+  OperandIndex input;
+  std::unique_ptr<onert::compiler::CompilerOptions> coptions;
+};
+
+} // namespace
+
+TEST(PlanCache, get)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 2};
+
+  const PlanCache::Shapes shapes{Shape{1, 2, 2, 1}};
+  // Plan is compiled when the shapes are requested again
+  EXPECT_EQ(cache.get(shapes), nullptr);
+  EXPECT_EQ(cache.size(), 0);
+  auto plan = cache.get(shapes);
+  ASSERT_NE(plan, nullptr);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.get(shapes), plan);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(PlanCache, changed_shape)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 2};
+
+  const Shape new_shape{2, 2, 2, 1};
+  cache.get({new_shape});
+  auto plan = cache.get({new_shape});
+  ASSERT_NE(plan, nullptr);
+
+  // Original package is not changed
+  EXPECT_EQ(mockup.graph().operands().at(mockup.input).shape(), (Shape{1, 2, 2, 1}));
+
+  const float input_buffer[8] = {1, 0, -1, -2, 1, 2, 0, -1};
+  float output_buffer[8] = {};
+  const float output_expected[8] = {4, 1, -2, 3, 4, 3, -1, 4};
+
+  onert::exec::Execution execution{plan->_executors};
+  EXPECT_EQ(execution.inputInfo(IOIndex{0}).shape(), new_shape);
+  EXPECT_EQ(execution.outputInfo(IOIndex{0}).shape(), new_shape);
+
+  execution.setInput(IOIndex{0}, input_buffer, sizeof(input_buffer));
+  execution.setOutput(IOIndex{0}, output_buffer, sizeof(output_buffer));
+  execution.execute();
+
+  for (auto i = 0; i < 8; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+TEST(PlanCache, evict_least_recently_used)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 2};
+
+  const PlanCache::Shapes shapes1{Shape{1, 2, 2, 1}};
+  const PlanCache::Shapes shapes2{Shape{2, 2, 2, 1}};
+  const PlanCache::Shapes shapes3{Shape{3, 2, 2, 1}};
+
+  cache.get(shapes1);
+  auto plan1 = cache.get(shapes1);
+  cache.get(shapes2);
+  auto plan2 = cache.get(shapes2);
+  EXPECT_EQ(cache.get(shapes1), plan1);
+  cache.get(shapes3);
+  cache.get(shapes3);
+  EXPECT_EQ(cache.size(), 2);
+
+  // shapes2 is evicted
+  EXPECT_EQ(cache.get(shapes1), plan1);
+  EXPECT_EQ(cache.get(shapes2), nullptr);
+  EXPECT_NE(cache.get(shapes2), plan2);
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(PlanCache, forget_requested_shapes)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 1};
+
+  const PlanCache::Shapes shapes1{Shape{1, 2, 2, 1}};
+  const PlanCache::Shapes shapes2{Shape{2, 2, 2, 1}};
+
+  // Only the last 'capacity' shapes without a plan are remembered
+  EXPECT_EQ(cache.get(shapes1), nullptr);
+  EXPECT_EQ(cache.get(shapes2), nullptr);
+  EXPECT_EQ(cache.get(shapes1), nullptr);
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_NE(cache.get(shapes1), nullptr);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(PlanCache, insert)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 1};
+
+  const PlanCache::Shapes shapes{Shape{1, 2, 2, 1}};
+  auto plan = std::make_shared<onert::compiler::CompilerArtifact>(nullptr, nullptr);
+  cache.insert(shapes, plan);
+  EXPECT_EQ(cache.get(shapes), plan);
+}
+
+TEST(PlanCache, neg_zero_capacity)
+{
+  auto mockup = MockUpModel();
+  EXPECT_THROW(PlanCache(*mockup.nnpkg, mockup.coptions.get(), 0), std::invalid_argument);
+}
+
+TEST(PlanCache, neg_invalid_input_count)
+{
+  auto mockup = MockUpModel();
+  PlanCache cache{*mockup.nnpkg, mockup.coptions.get(), 1};
+
+  const PlanCache::Shapes shapes{Shape{1, 2, 2, 1}, Shape{1, 2, 2, 1}};
+  EXPECT_THROW(cache.get(shapes), std::runtime_error);
+  EXPECT_EQ(cache.size(), 0);
+}
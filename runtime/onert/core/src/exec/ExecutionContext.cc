@@ -26,6 +26,7 @@ void ExecutionOptions::fromGlobalConfig(ExecutionOptions &options)
   options.dump_minmax = util::getConfigBool(util::config::MINMAX_DUMP);
   options.trace = util::getConfigBool(util::config::TRACING_MODE);
   options.profile = util::getConfigBool(util::config::PROFILING_MODE);
+  options.perf_counters = util::getConfigBool(util::config::PERF_COUNTERS);
 }
 
 } // namespace onert::exec
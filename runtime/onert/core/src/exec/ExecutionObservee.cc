@@ -41,6 +41,15 @@ ExecutionObservee::ExecutionObservee(const ExecObservers &observers,
     _observers.emplace_back(observer);
   }
 
+  if (options.perf_counters)
+  {
+    auto observer = observers.get(ObserverType::PERF_COUNTERS);
+    if (!observer)
+      throw std::runtime_error{"Cannot find PerfCounterObserver"};
+
+    _observers.emplace_back(observer);
+  }
+
   if (options.profile)
   {
     auto observer = observers.get(ObserverType::PROFILE);
@@ -22,14 +22,16 @@
 
 #include <misc/polymorphic_downcast.h>
 
+#include <map>
 #include <string>
 #include <sstream>
+#include <tuple>
 
 namespace
 {
 
 void setUserData(const onert::ir::Graph &g, const onert::ir::IOperation *op,
-                 decltype(EventCollector::Event::userData) &data)
+                 decltype(Event::args) &data)
 {
   // From a tensor of shape [a, b, c], this will return a string "shape(a b c)".
   // String like "[1, 2, 3]" looks better but this will be considered as a list in Json
@@ -116,8 +118,8 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, std::pair<ir::ModelIndex, ir
 
 TracingObserver::TracingObserver(const std::string &workspace_dir, const ir::Graph &graph,
                                  const util::TracingCtx *tracing_ctx)
-  : _recorder{std::make_unique<EventRecorder>()}, _collector{_recorder.get()}, _graph{graph},
-    _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx}, _triggered{false}
+  : _recorder{}, _graph{graph}, _workspace_dir{workspace_dir}, _tracing_ctx{tracing_ctx},
+    _triggered{false}
 {
   // DO NOTHING
 }
@@ -131,7 +133,7 @@ TracingObserver::~TracingObserver()
     {
       auto event_writer = EventWriter::get(_workspace_dir);
       event_writer->startToUse();
-      event_writer->readyToFlush(std::move(_recorder));
+      event_writer->readyToFlush(makeEventRecorder());
     }
   }
   catch (const std::exception &e)
@@ -140,41 +142,125 @@ TracingObserver::~TracingObserver()
   }
 }
 
+std::unique_ptr<EventRecorder> TracingObserver::makeEventRecorder() const
+{
+  using Kind = TraceRecord::Kind;
+
+  const auto records = _recorder.collect();
+  if (_recorder.dropped() > 0)
+    VERBOSE(TracingObserver) << _recorder.dropped() << " oldest events are dropped" << std::endl;
+
+  // Find begin-end pairs. The pair of an event may be dropped by ring buffer.
+  std::vector<bool> paired(records.size(), false);
+  {
+    // (is_op, model, subgraph, operation) -> indices of unpaired begin events
+    std::map<std::tuple<bool, uint32_t, uint32_t, uint32_t>, std::vector<size_t>> begins;
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+      const auto &rec = records[i];
+      const bool is_op = rec.kind == Kind::OP_BEGIN || rec.kind == Kind::OP_END;
+      auto &stack = begins[{is_op, rec.model_index, rec.subg_index, is_op ? rec.op_index : 0}];
+      if (rec.kind == Kind::SUBG_BEGIN || rec.kind == Kind::OP_BEGIN)
+      {
+        stack.push_back(i);
+      }
+      else if (!stack.empty())
+      {
+        paired[stack.back()] = true;
+        paired[i] = true;
+        stack.pop_back();
+      }
+    }
+  }
+
+  auto recorder = std::make_unique<EventRecorder>();
+  const auto session_index = _tracing_ctx->getSessionId();
+  for (size_t i = 0; i < records.size(); ++i)
+  {
+    if (!paired[i])
+      continue;
+
+    const auto &rec = records[i];
+    const auto ts = std::to_string(rec.ticks / 1000); // microseconds
+    const bool is_begin = rec.kind == Kind::SUBG_BEGIN || rec.kind == Kind::OP_BEGIN;
+
+    std::unique_ptr<DurationEvent> evt;
+    if (rec.kind == Kind::OP_BEGIN || rec.kind == Kind::OP_END)
+    {
+      auto op_evt = std::make_unique<OpSeqDurationEvent>();
+      const auto op_ind = ir::OperationIndex{rec.op_index};
+      const auto &op = _graph.operations().at(op_ind);
+      const auto *backend_obj =
+        static_cast<const backend::Backend *>(_recorder.backend(rec.backend_id));
+      op_evt->backend = backend_obj->config()->id();
+      op_evt->op_index = rec.op_index;
+      op_evt->op_name = op.name();
+      // add shape of inputs
+      if (is_begin)
+        setUserData(_graph, &op, op_evt->args);
+      evt = std::move(op_evt);
+    }
+    else
+    {
+      evt = std::make_unique<SubgDurationEvent>();
+    }
+
+    // The following will be set by a child of EventsWriter:
+    // evt.name, evt.tid
+    evt->ph = is_begin ? "B" : "E";
+    evt->ts = ts;
+    evt->tracing_ctx = _tracing_ctx;
+    evt->session_index = session_index;
+    evt->model_index = rec.model_index;
+    evt->subg_index = rec.subg_index;
+    evt->args.emplace_back("session", std::to_string(session_index));
+    evt->args.emplace_back("model", std::to_string(rec.model_index));
+    evt->args.emplace_back("subgraph", std::to_string(rec.subg_index));
+    recorder->emit(std::move(evt));
+
+// TODO: Add resurece measurement(e.g. RSS)
+// when ready with low overhead in release build
+#ifdef DEBUG
+    for (const auto &[name, value] : {std::make_pair("maxrss", rec.maxrss),
+                                      std::make_pair("minflt", rec.minflt)})
+    {
+      CounterEvent counter;
+      counter.name = name;
+      counter.ph = "C";
+      counter.ts = ts;
+      counter.values["value"] = std::to_string(value);
+      recorder->emit(counter);
+    }
+#endif
+  }
+
+  return recorder;
+}
+
 void TracingObserver::handleSubgraphBegin(std::pair<ir::ModelIndex, ir::SubgraphIndex> ind)
 {
   _triggered = true;
 
-  _collector.onEvent(EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::BEGIN,
-                                               ind.first.value(), ind.second.value()});
+  _recorder.record(TraceRecord::Kind::SUBG_BEGIN, ind.first.value(), ind.second.value());
 }
 
 void TracingObserver::handleJobBegin(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex> ind,
                                      ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  const auto &op = _graph.operations().at(op_ind);
-  auto ev = EventCollector::OpSeqEvent{_tracing_ctx,      EventCollector::Edge::BEGIN,
-                                       ind.first.value(), ind.second.value(),
-                                       backend_id,        op_ind.value(),
-                                       op.name()};
-  // add shape of inputs
-  setUserData(_graph, &op, ev.userData);
-  _collector.onEvent(ev);
+  _recorder.record(TraceRecord::Kind::OP_BEGIN, ind.first.value(), ind.second.value(),
+                   op_ind.value(), _recorder.backendId(backend));
 }
 
 void TracingObserver::handleJobEnd(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex> ind,
                                    ir::OperationIndex op_ind, const backend::Backend *backend)
 {
-  std::string backend_id = backend->config()->id();
-  _collector.onEvent(EventCollector::OpSeqEvent{
-    _tracing_ctx, EventCollector::Edge::END, ind.first.value(), ind.second.value(), backend_id,
-    op_ind.value(), _graph.operations().at(op_ind).name()});
+  _recorder.record(TraceRecord::Kind::OP_END, ind.first.value(), ind.second.value(),
+                   op_ind.value(), _recorder.backendId(backend));
 }
 
 void TracingObserver::handleSubgraphEnd(std::pair<ir::ModelIndex, ir::SubgraphIndex> ind)
 {
-  _collector.onEvent(EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END,
-                                               ind.first.value(), ind.second.value()});
+  _recorder.record(TraceRecord::Kind::SUBG_END, ind.first.value(), ind.second.value());
 }
 
 } // namespace exec
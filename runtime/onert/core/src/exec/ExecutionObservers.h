@@ -18,9 +18,9 @@
 #define __ONERT_EXEC_OBSREVERS_H__
 
 #include "ExecTime.h"
-#include "../util/EventCollector.h"
 #include "../util/EventRecorder.h"
 #include "../util/EventWriter.h"
+#include "../util/TraceRecorder.h"
 
 #include "exec/IExecutor.h"
 #include "ir/Index.h"
@@ -36,6 +36,7 @@ enum class ObserverType
   PROFILE,
   TRACING,
   MINMAX_DUMP,
+  PERF_COUNTERS,
 };
 
 class IExecutionObserver
@@ -116,8 +117,11 @@ public:
   ObserverType type() const override { return ObserverType::TRACING; }
 
 private:
-  std::unique_ptr<EventRecorder> _recorder;
-  EventCollector _collector;
+  std::unique_ptr<EventRecorder> makeEventRecorder() const;
+
+private:
+  // Events are kept in binary form and converted to EventRecorder when written
+  TraceRecorder _recorder;
   const ir::Graph &_graph;
   std::string _workspace_dir;
   const util::TracingCtx *_tracing_ctx;
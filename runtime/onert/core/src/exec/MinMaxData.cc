@@ -16,117 +16,178 @@
 
 #include "MinMaxData.h"
 
-#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <vector>
 
 namespace onert::exec
 {
 
-RawMinMaxDumper::RawMinMaxDumper(const std::string &filename) : _filename(filename) {}
+namespace
+{
 
-void RawMinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
-                           const exec::OpMinMaxMap &op_minmax) const
+// Magic code and version
+// Match with runtime/onert/odc/MinMaxReader.cc
+// TODO Use util to share code and version
+const uint32_t MAGIC_CODE = 0x4F4D4D44;
+const uint32_t VERSION = 1;
+
+template <typename Index, typename Map>
+void serialize(const Map &minmax_map, std::vector<uint32_t> &buffer)
 {
-  // Find file is already exist for modifying
-  auto file = std::fopen(_filename.c_str(), "rb+");
-  uint32_t runs = 1;
-
-  // Magic code and version
-  // Match with runtime/onert/odc/MinMaxReader.cc
-  // TODO Use util to share code and version
-  const uint32_t MAGIC_CODE = 0x4F4D4D44;
-  const uint32_t VERSION = 1;
-  if (!file)
+  for (auto &&[index, minmax] : minmax_map)
   {
-    // If file is not exist, create new file
-    file = std::fopen(_filename.c_str(), "wb+");
-    if (!file)
-      throw std::runtime_error{"RawMinMaxDumper: Failed to open minmax file " + _filename};
-
-    // Write magic code and version
-    std::fwrite(&MAGIC_CODE, sizeof(uint32_t), 1, file);
-    std::fwrite(&VERSION, sizeof(uint32_t), 1, file);
+    // model/subg/op(or input) index
+    buffer.push_back(std::get<ir::ModelIndex>(index).value());
+    buffer.push_back(std::get<ir::SubgraphIndex>(index).value());
+    buffer.push_back(std::get<Index>(index).value());
+
+    // min/max
+    uint32_t data[2];
+    std::memcpy(data, minmax.data, sizeof(data));
+    buffer.push_back(data[0]);
+    buffer.push_back(data[1]);
   }
-  else
+}
+
+} // namespace
+
+RawMinMaxDumper::RawMinMaxDumper(const std::string &filename) : _filename(filename) {}
+
+RawMinMaxDumper::~RawMinMaxDumper() { close(); }
+
+bool RawMinMaxDumper::isOpened() const
+{
+  if (!_file)
+    return false;
+
+  // Check the file is not removed or replaced since opened
+  struct stat path_stat, file_stat;
+  if (stat(_filename.c_str(), &path_stat) != 0 || fstat(fileno(_file), &file_stat) != 0)
+    return false;
+  return path_stat.st_dev == file_stat.st_dev && path_stat.st_ino == file_stat.st_ino;
+}
+
+void RawMinMaxDumper::open()
+{
+  close();
+
+  // Find file is already exist for modifying
+  _file = std::fopen(_filename.c_str(), "rb+");
+  _runs = 0;
+  if (_file)
   {
-    // Check magic code and version
-    std::fseek(file, 0, SEEK_SET);
+    // Check magic code and version, and read run count
     uint32_t read_magic_code = 0;
     uint32_t read_version = 0;
-    bool rewrite = true;
-    if (std::fread(&read_magic_code, sizeof(uint32_t), 1, file) == 1 &&
+    if (std::fread(&read_magic_code, sizeof(uint32_t), 1, _file) == 1 &&
         read_magic_code == MAGIC_CODE &&
-        std::fread(&read_version, sizeof(uint32_t), 1, file) == 1 && read_version == VERSION)
-      rewrite = false;
-
-    // Destroy and create if file is not valid
-    if (rewrite)
+        std::fread(&read_version, sizeof(uint32_t), 1, _file) == 1 && read_version == VERSION)
     {
-      std::fclose(file);
-      file = std::fopen(_filename.c_str(), "wb+");
-      if (!file)
-        throw std::runtime_error{"RawMinMaxDumper: Failed to rewrite minmax file " + _filename};
-
-      // Write magic code and version
-      std::fwrite(&MAGIC_CODE, sizeof(uint32_t), 1, file);
-      std::fwrite(&VERSION, sizeof(uint32_t), 1, file);
+      // TODO Verify file size
+      if (std::fread(&_runs, sizeof(uint32_t), 1, _file) == 1)
+        return;
+      _runs = 0;
     }
-  }
 
-  // Read run count
-  if (std::fread(&runs, sizeof(uint32_t), 1, file) == 1)
-    runs++;
-  else
-    runs = 1;
-
-  // TODO Verify file size
+    // Destroy and create if file is not valid
+    std::fclose(_file);
+  }
 
-  // Overwrite run count
-  std::fseek(file, sizeof(MAGIC_CODE) + sizeof(VERSION), SEEK_SET);
-  std::fwrite(&runs, sizeof(uint32_t), 1, file);
+  _file = std::fopen(_filename.c_str(), "wb+");
+  if (!_file)
+    throw std::runtime_error{"RawMinMaxDumper: Failed to open minmax file " + _filename};
 
-  // Go to end of file to append new data
-  std::fseek(file, 0, SEEK_END);
+  // Write magic code, version and run count
+  std::fwrite(&MAGIC_CODE, sizeof(uint32_t), 1, _file);
+  std::fwrite(&VERSION, sizeof(uint32_t), 1, _file);
+  std::fwrite(&_runs, sizeof(uint32_t), 1, _file);
+}
 
-  uint32_t input_count = input_minmax.size();
-  uint32_t op_count = op_minmax.size();
+void RawMinMaxDumper::close()
+{
+  if (_file)
+  {
+    std::fclose(_file);
+    _file = nullptr;
+  }
+}
 
-  // Write op_count and input_count
-  std::fwrite(&op_count, sizeof(uint32_t), 1, file);
-  std::fwrite(&input_count, sizeof(uint32_t), 1, file);
+void RawMinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
+                           const exec::OpMinMaxMap &op_minmax)
+{
+  if (!isOpened())
+    open();
+
+  // Make a run as a whole: op_count, input_count, ops and inputs
+  std::vector<uint32_t> buffer;
+  buffer.reserve(2 + (op_minmax.size() + input_minmax.size()) * 5);
+  buffer.push_back(op_minmax.size());
+  buffer.push_back(input_minmax.size());
+  serialize<ir::OperationIndex>(op_minmax, buffer);
+  serialize<ir::IOIndex>(input_minmax, buffer);
+
+  // Append the run, and then update run count so that the count never exceeds the runs in file
+  std::fseek(_file, 0, SEEK_END);
+  if (std::fwrite(buffer.data(), sizeof(uint32_t), buffer.size(), _file) != buffer.size())
+    throw std::runtime_error{"RawMinMaxDumper: Failed to write minmax file " + _filename};
+
+  _runs++;
+  std::fseek(_file, sizeof(MAGIC_CODE) + sizeof(VERSION), SEEK_SET);
+  std::fwrite(&_runs, sizeof(uint32_t), 1, _file);
+  std::fflush(_file);
+}
 
-  // For each op
-  for (auto &&[index, minmax] : op_minmax)
+std::pair<float, float> minmaxOf(const float *data, size_t size, uint32_t sample_stride)
+{
+  constexpr size_t kLanes = 16;
+  constexpr size_t kBlockSize = 1024;
+  constexpr float lowest = std::numeric_limits<float>::lowest();
+  constexpr float highest = std::numeric_limits<float>::max();
+
+  float min[kLanes];
+  float max[kLanes];
+  std::fill(min, min + kLanes, highest);
+  std::fill(max, max + kLanes, lowest);
+
+  const size_t block_stride = kBlockSize * std::max<uint32_t>(sample_stride, 1);
+  for (size_t begin = 0; begin < size; begin += block_stride)
   {
-    const uint32_t model_idx = std::get<ir::ModelIndex>(index).value();
-    const uint32_t subg_idx = std::get<ir::SubgraphIndex>(index).value();
-    const uint32_t op_idx = std::get<ir::OperationIndex>(index).value();
-
-    // Write model/subg/op index
-    std::fwrite(&model_idx, sizeof(uint32_t), 1, file);
-    std::fwrite(&subg_idx, sizeof(uint32_t), 1, file);
-    std::fwrite(&op_idx, sizeof(uint32_t), 1, file);
+    const float *block = data + begin;
+    const size_t block_size = std::min(kBlockSize, size - begin);
 
-    // Write min/max
-    std::fwrite(minmax.data, sizeof(float), 2, file);
+    // NaN fails every comparison, and lowest is excluded from min and never exceeds max
+    size_t i = 0;
+    for (; i + kLanes <= block_size; i += kLanes)
+    {
+      for (size_t l = 0; l < kLanes; ++l)
+      {
+        const float number = block[i + l];
+        const float min_candidate = number == lowest ? highest : number;
+        min[l] = min_candidate < min[l] ? min_candidate : min[l];
+        max[l] = number > max[l] ? number : max[l];
+      }
+    }
+    for (; i < block_size; ++i)
+    {
+      const float number = block[i];
+      const float min_candidate = number == lowest ? highest : number;
+      min[0] = min_candidate < min[0] ? min_candidate : min[0];
+      max[0] = number > max[0] ? number : max[0];
+    }
   }
 
-  // For each input
-  for (auto &&[index, minmax] : input_minmax)
-  {
-    const uint32_t model_idx = std::get<ir::ModelIndex>(index).value();
-    const uint32_t subg_idx = std::get<ir::SubgraphIndex>(index).value();
-    const uint32_t input_idx = std::get<ir::IOIndex>(index).value();
+  const float result_min = *std::min_element(min, min + kLanes);
+  const float result_max = *std::max_element(max, max + kLanes);
 
-    // Write model/subg/input index
-    std::fwrite(&model_idx, sizeof(uint32_t), 1, file);
-    std::fwrite(&subg_idx, sizeof(uint32_t), 1, file);
-    std::fwrite(&input_idx, sizeof(uint32_t), 1, file);
-
-    // Write min/max
-    std::fwrite(minmax.data, sizeof(float), 2, file);
-  }
+  // Any value counted makes min <= max (-inf is counted in min only)
+  if (result_min > result_max)
+    throw std::runtime_error("All values are NaN(Not a Number)");
 
-  std::fclose(file);
+  return {result_min, result_max};
 }
 
 } // namespace onert::exec
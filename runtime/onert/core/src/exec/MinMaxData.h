@@ -19,7 +19,10 @@
 
 #include "exec/MinMaxMap.h"
 
+#include <cstdint>
+#include <cstdio>
 #include <string>
+#include <utility>
 
 namespace onert::exec
 {
@@ -54,19 +57,45 @@ class RawMinMaxDumper
 {
 public:
   RawMinMaxDumper(const std::string &filename);
+  RawMinMaxDumper(const RawMinMaxDumper &) = delete;
+  RawMinMaxDumper &operator=(const RawMinMaxDumper &) = delete;
+  ~RawMinMaxDumper();
+
   /**
-   * @brief Dump input minmax map
+   * @brief Append a run of minmax maps to the file
+   *
+   * The file is kept open between runs, and a run is appended with a single write
+   * followed by the update of the run count. If the file is removed or replaced
+   * (e.g. by the quantizer after quantization), it is opened again.
    *
    * @param[in] in_minmax  input minmax map
    * @param[in] op_minmax  op minmax map
    */
+  void dump(const exec::IOMinMaxMap &in_minmax, const exec::OpMinMaxMap &op_minmax);
 
-  void dump(const exec::IOMinMaxMap &in_minmax, const exec::OpMinMaxMap &op_minmax) const;
+private:
+  bool isOpened() const;
+  void open();
+  void close();
 
 private:
   std::string _filename;
+  std::FILE *_file = nullptr;
+  uint32_t _runs = 0;
 };
 
+/**
+ * @brief Return {min, max} of float data except NaN and lowest values
+ *
+ * Data is reduced in independent lanes so that the compiler can vectorize the loop.
+ * With sample_stride N > 1, only every N-th block of data is scanned.
+ *
+ * @param[in] data           float data
+ * @param[in] size           number of elements
+ * @param[in] sample_stride  block stride to scan (1 for all data)
+ */
+std::pair<float, float> minmaxOf(const float *data, size_t size, uint32_t sample_stride = 1);
+
 } // namespace onert::exec
 
 #endif // __ONERT_EXEC_MINMAX_DATA_H__
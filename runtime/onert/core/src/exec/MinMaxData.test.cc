@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxData.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+
+std::vector<uint32_t> readFile(const std::string &filename)
+{
+  std::vector<uint32_t> words;
+  auto file = std::fopen(filename.c_str(), "rb");
+  if (!file)
+    return words;
+  uint32_t word;
+  while (std::fread(&word, sizeof(uint32_t), 1, file) == 1)
+    words.push_back(word);
+  std::fclose(file);
+  return words;
+}
+
+TEST(MinMaxData, minmaxOf)
+{
+  const float lowest = std::numeric_limits<float>::lowest();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  // Sizes leaving a tail of lanes and spanning multiple blocks
+  for (size_t size : {1, 15, 16, 17, 1023, 1024, 1025, 5000})
+  {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; ++i)
+      data[i] = static_cast<float>((i * 7) % 101) - 50.f;
+    data[0] = nan;
+    data[size / 2] = lowest;
+    data[size - 1] = size > 1 ? 60.f : data[size - 1];
+
+    float expected_min = std::numeric_limits<float>::max();
+    float expected_max = lowest;
+    for (auto number : data)
+    {
+      if (std::isnan(number) || number == lowest)
+        continue;
+      expected_min = std::min(expected_min, number);
+      expected_max = std::max(expected_max, number);
+    }
+    if (expected_min > expected_max)
+      continue;
+
+    auto [min, max] = minmaxOf(data.data(), size);
+    EXPECT_EQ(min, expected_min);
+    EXPECT_EQ(max, expected_max);
+  }
+}
+
+TEST(MinMaxData, minmaxOf_sampled)
+{
+  std::vector<float> data(4096, 1.f);
+  data[10] = -3.f;   // 1st block
+  data[1030] = 9.f;  // 2nd block, skipped
+  data[2050] = 5.f;  // 3rd block
+  data[3100] = -7.f; // 4th block, skipped
+
+  auto [min, max] = minmaxOf(data.data(), data.size(), 2);
+  EXPECT_EQ(min, -3.f);
+  EXPECT_EQ(max, 5.f);
+
+  std::tie(min, max) = minmaxOf(data.data(), data.size(), 1);
+  EXPECT_EQ(min, -7.f);
+  EXPECT_EQ(max, 9.f);
+}
+
+TEST(MinMaxData, minmaxOf_infinity)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  std::vector<float> data{-inf, -inf};
+
+  auto [min, max] = minmaxOf(data.data(), data.size());
+  EXPECT_EQ(min, -inf);
+  EXPECT_EQ(max, std::numeric_limits<float>::lowest());
+}
+
+TEST(MinMaxData, neg_minmaxOf_all_nan)
+{
+  std::vector<float> data{std::numeric_limits<float>::quiet_NaN(),
+                          std::numeric_limits<float>::lowest()};
+
+  EXPECT_ANY_THROW(minmaxOf(data.data(), data.size()));
+  EXPECT_ANY_THROW(minmaxOf(data.data(), 0));
+}
+
+TEST(MinMaxData, dump_append)
+{
+  const std::string filename = "minmax_data_test.bin";
+  std::remove(filename.c_str());
+
+  OpMinMaxMap op_minmax;
+  op_minmax.append({ir::ModelIndex{0}, ir::SubgraphIndex{0}, ir::OperationIndex{3}}, -1.f, 2.f);
+  IOMinMaxMap input_minmax;
+  input_minmax.append({ir::ModelIndex{0}, ir::SubgraphIndex{0}, ir::IOIndex{0}}, 0.f, 1.f);
+
+  {
+    RawMinMaxDumper dumper(filename);
+    dumper.dump(input_minmax, op_minmax);
+    dumper.dump(input_minmax, op_minmax);
+
+    // magic, version, runs and 2 runs of (op_count, input_count, op record, input record)
+    auto words = readFile(filename);
+    ASSERT_EQ(words.size(), 3u + 2 * (2 + 5 + 5));
+    EXPECT_EQ(words[2], 2u);
+    EXPECT_EQ(words[3], 1u);
+    EXPECT_EQ(words[4], 1u);
+    EXPECT_EQ(words[7], 3u);
+
+    // Removed file is created again
+    std::remove(filename.c_str());
+    dumper.dump(input_minmax, op_minmax);
+    words = readFile(filename);
+    ASSERT_EQ(words.size(), 3u + 2 + 5 + 5);
+    EXPECT_EQ(words[2], 1u);
+  }
+
+  // Existing file is appended by a new dumper
+  {
+    RawMinMaxDumper dumper(filename);
+    dumper.dump(input_minmax, op_minmax);
+    auto words = readFile(filename);
+    ASSERT_EQ(words.size(), 3u + 2 * (2 + 5 + 5));
+    EXPECT_EQ(words[2], 2u);
+  }
+
+  std::remove(filename.c_str());
+}
+
+} // namespace
@@ -15,55 +15,36 @@
  */
 
 #include "MinMaxRecorder.h"
-#include "MinMaxData.h"
 #include "backend/ITensor.h"
+#include "util/ConfigSource.h"
 
+#include <algorithm>
 #include <cassert>
-#include <cmath>
 
 namespace onert::exec
 {
 
 MinMaxRecorder::MinMaxRecorder(const std::string &workspace_dir, const ir::Graph &graph,
                                const backend::BackendContexts &backend_contexts)
-  : _graph{graph}, _backend_contexts{backend_contexts}, _workspace_dir(workspace_dir)
+  : _graph{graph}, _backend_contexts{backend_contexts}, _dumper{workspace_dir + "/minmax.bin"},
+    _sample_stride{static_cast<uint32_t>(
+      std::max(1, util::getConfigInt(util::config::MINMAX_SAMPLE_STRIDE)))}
 {
   // DO NOTHING
 }
 
-std::pair<float, float> minmaxFrom(const backend::ITensor *tensor)
+namespace
 {
-  const auto data = reinterpret_cast<float *>(tensor->buffer());
-  const auto num_elements = tensor->total_size() / sizeof(float);
-
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
-
-  bool all_nan = true;
-  for (size_t i = 0; i < num_elements; ++i)
-  {
-    const float number = data[i];
-    if (std::isnan(number))
-      continue;
-
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
-
-    if (number > max)
-      max = number;
 
-    if (number < min)
-      min = number;
-  }
-
-  if (all_nan)
-    throw std::runtime_error("All values are NaN(Not a Number)");
-
-  return {min, max};
+std::pair<float, float> minmaxFrom(const backend::ITensor *tensor, uint32_t sample_stride)
+{
+  const auto data = reinterpret_cast<const float *>(tensor->buffer());
+  const auto num_elements = tensor->total_size() / sizeof(float);
+  return minmaxOf(data, num_elements, sample_stride);
 }
 
+} // namespace
+
 void MinMaxRecorder::handleJobEnd(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex> idx,
                                   ir::OperationIndex op_idx, const backend::Backend *backend)
 {
@@ -101,8 +82,9 @@ void MinMaxRecorder::handleJobEnd(IExecutor *, std::pair<ir::ModelIndex, ir::Sub
   }
 
   // Otherwise, dump!
+  // NOTE This runs right after the op on the same thread, so the output is still cache-hot.
   assert(tensor->data_type() == ir::DataType::FLOAT32);
-  auto [min, max] = minmaxFrom(tensor);
+  auto [min, max] = minmaxFrom(tensor, _sample_stride);
   _op_minmax.append({idx.first, idx.second, op_idx}, min, max);
 }
 
@@ -133,7 +115,7 @@ void MinMaxRecorder::handleSubgraphBegin(std::pair<ir::ModelIndex, ir::SubgraphI
     if (tensor->data_type() != ir::DataType::FLOAT32)
       return;
 
-    auto [min, max] = minmaxFrom(tensor);
+    auto [min, max] = minmaxFrom(tensor, _sample_stride);
     _input_minmax.append({idx.first, idx.second, ir::IOIndex{i}}, min, max);
   }
 }
@@ -142,8 +124,7 @@ void MinMaxRecorder::handleSubgraphEnd(std::pair<ir::ModelIndex, ir::SubgraphInd
 {
   // It would be better to dump at the end of model execution, not subgraph
   // But it requires more changes than subgraph.
-  auto raw_dumper = RawMinMaxDumper(_workspace_dir + "/minmax.bin");
-  raw_dumper.dump(_input_minmax, _op_minmax);
+  _dumper.dump(_input_minmax, _op_minmax);
 }
 
 } // namespace onert::exec
@@ -20,6 +20,7 @@
 #include "ExecutionObservers.h"
 #include "ir/Index.h"
 #include "exec/MinMaxMap.h"
+#include "MinMaxData.h"
 
 #include <string>
 
@@ -45,7 +46,8 @@ public:
 private:
   const ir::Graph &_graph;
   const backend::BackendContexts &_backend_contexts;
-  std::string _workspace_dir;
+  RawMinMaxDumper _dumper;
+  uint32_t _sample_stride;
   OpMinMaxMap _op_minmax;
   IOMinMaxMap _input_minmax;
 };
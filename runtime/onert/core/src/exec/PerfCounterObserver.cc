@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PerfCounterObserver.h"
+
+#include "../util/EventWriter.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace
+{
+
+// Counter values at the beginning of operations running on this thread
+// NOTE Operations may be nested on a thread by control flow operations
+thread_local std::vector<PerfCounters::Values> begin_values;
+
+} // namespace
+
+namespace onert::exec
+{
+
+PerfCounterObserver::PerfCounterObserver(const std::string &workspace_dir, const ir::Graph &graph)
+  : _graph{graph}, _workspace_dir{workspace_dir},
+    _calling_thread_only{util::getConfigInt(util::config::NUM_THREADS) != 1}
+{
+  if (_calling_thread_only)
+    VERBOSE(PerfCounterObserver) << "Performance counters do not count kernel worker threads. "
+                                 << "Set NUM_THREADS=1 to count whole operations" << std::endl;
+
+  _graph.operations().iterate(
+    [&](const ir::OperationIndex &index, const ir::IOperation &) { _op_stats[index]; });
+}
+
+PerfCounterObserver::~PerfCounterObserver()
+{
+  try
+  {
+    // Sum per operation type and backend
+    std::map<std::pair<std::string, std::string>, PerfCounterStat> stats;
+    for (const auto &[index, op_stat] : _op_stats)
+    {
+      if (op_stat.count == 0)
+        continue;
+
+      auto op_type = _graph.operations().at(index).name();
+      auto backend_id = op_stat.backend->config()->id();
+      auto &stat = stats[{op_type, backend_id}];
+      if (stat.values.empty())
+      {
+        stat.op_type = op_type;
+        stat.backend = backend_id;
+        stat.calling_thread_only = _calling_thread_only;
+        for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i)
+          stat.values.emplace_back(PerfCounters::name(static_cast<PerfCounters::Counter>(i)), 0);
+      }
+      stat.count += op_stat.count;
+      for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i)
+        stat.values[i].second += op_stat.sum[i];
+    }
+
+    // Write file if counters are read at least once
+    if (!stats.empty())
+    {
+      auto recorder = std::make_unique<EventRecorder>();
+      for (const auto &[key, stat] : stats)
+        recorder->emit(stat);
+
+      auto event_writer = EventWriter::get(_workspace_dir);
+      event_writer->startToUse();
+      event_writer->readyToFlush(std::move(recorder));
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "E: Fail to record event in PerfCounterObserver: " << e.what() << std::endl;
+  }
+}
+
+void PerfCounterObserver::handleJobBegin(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex>,
+                                         ir::OperationIndex, const backend::Backend *)
+{
+  auto &values = begin_values.emplace_back();
+  if (!PerfCounters::read(values))
+  {
+    static std::atomic<bool> warned{false};
+    if (!warned.exchange(true))
+      VERBOSE(PerfCounterObserver) << "Hardware performance counters are not available"
+                                   << std::endl;
+  }
+}
+
+void PerfCounterObserver::handleJobEnd(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex>,
+                                       ir::OperationIndex op_ind, const backend::Backend *backend)
+{
+  PerfCounters::Values end_values;
+  const bool available = PerfCounters::read(end_values);
+
+  assert(!begin_values.empty());
+  const auto values = begin_values.back();
+  begin_values.pop_back();
+
+  if (!available)
+    return;
+
+  auto &op_stat = _op_stats.at(op_ind);
+  op_stat.backend = backend;
+  op_stat.count++;
+  for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i)
+    op_stat.sum[i] += end_values[i] - values[i];
+}
+
+} // namespace onert::exec
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_PERF_COUNTER_OBSERVER_H__
+#define __ONERT_EXEC_PERF_COUNTER_OBSERVER_H__
+
+#include "ExecutionObservers.h"
+#include "../util/PerfCounters.h"
+
+#include "ir/Index.h"
+
+#include <string>
+#include <unordered_map>
+
+namespace onert::exec
+{
+
+/**
+ * @brief Observer sampling hardware performance counters around each operation
+ *
+ * Counters are summed per operation type and backend, and written to trace.json and
+ * trace.table.md of workspace directory by EventWriter.
+ *
+ * NOTE Only the thread running an operation is counted. If NUM_THREADS is not 1, kernels may
+ *      split work to worker threads, so the results are marked as calling thread only.
+ */
+class PerfCounterObserver : public IExecutionObserver
+{
+public:
+  PerfCounterObserver(const std::string &workspace_dir, const ir::Graph &graph);
+  ~PerfCounterObserver();
+  void handleJobBegin(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex>, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, std::pair<ir::ModelIndex, ir::SubgraphIndex>, ir::OperationIndex,
+                    const backend::Backend *) override;
+  ObserverType type() const override { return ObserverType::PERF_COUNTERS; }
+
+private:
+  struct OpStat
+  {
+    const backend::Backend *backend = nullptr;
+    uint64_t count = 0;
+    PerfCounters::Values sum{};
+  };
+
+  const ir::Graph &_graph;
+  std::string _workspace_dir;
+  // NOTE Entries are created in constructor, so that each operation can update its own entry
+  //      without locking
+  std::unordered_map<ir::OperationIndex, OpStat> _op_stats;
+  bool _calling_thread_only;
+};
+
+} // namespace onert::exec
+
+#endif // __ONERT_EXEC_PERF_COUNTER_OBSERVER_H__
@@ -29,3 +29,10 @@ void EventRecorder::emit(const CounterEvent &evt)
 
   _counter_events.push_back(evt);
 }
+
+void EventRecorder::emit(const PerfCounterStat &stat)
+{
+  std::lock_guard<std::mutex> lock{_mu};
+
+  _perf_counter_stats.push_back(stat);
+}
@@ -22,7 +22,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
-
+#include <string>
 #include <vector>
 
 // refer to https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU/edit#
@@ -67,6 +67,18 @@ struct CounterEvent : public Event
   std::map<std::string, std::string> values;
 };
 
+// Hardware performance counters summed over executions of an operation type on a backend
+struct PerfCounterStat
+{
+  std::string op_type;
+  std::string backend;
+  uint64_t count = 0; // number of executions
+  // pairs of (counter name, sum of values)
+  std::vector<std::pair<std::string, uint64_t>> values;
+  // true if kernels may run on worker threads, whose events are not counted
+  bool calling_thread_only = false;
+};
+
 //
 // Record Event as Chrome Trace Event File Format
 //
@@ -80,6 +92,7 @@ public:
 public:
   void emit(std::unique_ptr<DurationEvent> &&evt);
   void emit(const CounterEvent &evt);
+  void emit(const PerfCounterStat &stat);
 
 public:
   const std::vector<std::unique_ptr<DurationEvent>> &duration_events() const
@@ -87,11 +100,13 @@ public:
     return _duration_events;
   }
   const std::vector<CounterEvent> &counter_events() const { return _counter_events; }
+  const std::vector<PerfCounterStat> &perf_counter_stats() const { return _perf_counter_stats; }
 
 private:
   std::mutex _mu;
   std::vector<std::unique_ptr<DurationEvent>> _duration_events;
   std::vector<CounterEvent> _counter_events;
+  std::vector<PerfCounterStat> _perf_counter_stats;
 };
 
 #endif // __ONERT_UTIL_EVENT_RECORDER_H__
@@ -16,6 +16,7 @@
 
 #include "EventWriter.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
@@ -353,6 +354,47 @@ struct MDTableBuilder
   std::vector<Graph> _graphs;
 };
 
+void writePerfCounterStats(std::ostream &os, const std::vector<PerfCounterStat> &stats)
+{
+  if (stats.empty())
+    return;
+
+  // Average of each counter per execution
+  std::vector<std::string> headers{"Op type", "backend", "count"};
+  for (const auto &[name, sum] : stats.front().values)
+    headers.emplace_back(name);
+  headers.emplace_back("IPC");
+
+  os << "# Perf counters\n";
+  writeMDTableRow(os, headers);
+  writeMDTableRow(os, std::vector<std::string>(headers.size(), "-------"));
+
+  for (const auto &stat : stats)
+  {
+    std::vector<std::string> row{stat.op_type, stat.backend, std::to_string(stat.count)};
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    for (const auto &[name, sum] : stat.values)
+    {
+      row.emplace_back(std::to_string(stat.count == 0 ? 0 : sum / stat.count));
+      if (name == "cycles")
+        cycles = sum;
+      else if (name == "instructions")
+        instructions = sum;
+    }
+    row.emplace_back(cycles == 0 ? "-"
+                                 : std::to_string(static_cast<double>(instructions) / cycles));
+    writeMDTableRow(os, row);
+  }
+
+  if (std::any_of(stats.begin(), stats.end(),
+                  [](const PerfCounterStat &stat) { return stat.calling_thread_only; }))
+    os << "\nNOTE Counters cover the calling thread only. Events of kernel worker threads are not"
+          " counted. Set NUM_THREADS=1 to count whole operations.\n";
+
+  os << "\n";
+}
+
 } // namespace
 
 void MDTableWriter::flush(const std::vector<std::unique_ptr<EventRecorder>> &records)
@@ -360,5 +402,6 @@ void MDTableWriter::flush(const std::vector<std::unique_ptr<EventRecorder>> &rec
   for (const auto &recorder : records)
   {
     MDTableBuilder(recorder->duration_events(), recorder->counter_events()).build().write(_os);
+    writePerfCounterStats(_os, recorder->perf_counter_stats());
   }
 }
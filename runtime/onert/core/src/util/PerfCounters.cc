@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PerfCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace
+{
+
+#ifdef __linux__
+
+// Group of counters whose leader is CYCLES, opened for the calling thread
+class CounterGroup
+{
+public:
+  CounterGroup()
+  {
+    static constexpr uint64_t configs[PerfCounters::NUM_COUNTERS] = {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i)
+    {
+      struct perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = configs[i];
+      attr.read_format = PERF_FORMAT_GROUP;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      // pid 0 and cpu -1 : calling thread on any cpu
+      int group_fd = (i == 0) ? -1 : _fds[0];
+      _fds[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+      if (_fds[i] < 0)
+      {
+        close();
+        return;
+      }
+    }
+  }
+
+  ~CounterGroup() { close(); }
+
+  bool read(PerfCounters::Values &values) const
+  {
+    if (_fds[0] < 0)
+      return false;
+
+    struct
+    {
+      uint64_t nr;
+      uint64_t values[PerfCounters::NUM_COUNTERS];
+    } data;
+    if (::read(_fds[0], &data, sizeof(data)) != sizeof(data) ||
+        data.nr != PerfCounters::NUM_COUNTERS)
+      return false;
+
+    for (int i = 0; i < PerfCounters::NUM_COUNTERS; ++i)
+      values[i] = data.values[i];
+    return true;
+  }
+
+private:
+  void close()
+  {
+    for (auto &fd : _fds)
+    {
+      if (fd >= 0)
+        ::close(fd);
+      fd = -1;
+    }
+  }
+
+private:
+  int _fds[PerfCounters::NUM_COUNTERS] = {-1, -1, -1, -1};
+};
+
+#endif // __linux__
+
+} // namespace
+
+const char *PerfCounters::name(Counter counter)
+{
+  switch (counter)
+  {
+    case CYCLES:
+      return "cycles";
+    case INSTRUCTIONS:
+      return "instructions";
+    case CACHE_MISSES:
+      return "cache_misses";
+    case BRANCH_MISSES:
+      return "branch_misses";
+    default:
+      return "unknown";
+  }
+}
+
+bool PerfCounters::read([[maybe_unused]] Values &values)
+{
+#ifdef __linux__
+  thread_local CounterGroup group;
+  return group.read(values);
+#else
+  return false;
+#endif
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_PERF_COUNTERS_H__
+#define __ONERT_UTIL_PERF_COUNTERS_H__
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief Hardware performance counters of the calling thread, read by Linux perf_event_open
+ *
+ * Counters are opened on the first read() of each thread and closed when the thread exits.
+ * They count user space events only.
+ *
+ * NOTE Events of other threads are not counted, including worker threads that a kernel uses
+ *      during the read interval. Counter inheritance does not help here, because it covers
+ *      only threads created after counters are opened and worker pools are created earlier.
+ */
+class PerfCounters
+{
+public:
+  enum Counter
+  {
+    CYCLES,
+    INSTRUCTIONS,
+    CACHE_MISSES,
+    BRANCH_MISSES,
+    NUM_COUNTERS,
+  };
+
+  using Values = std::array<uint64_t, NUM_COUNTERS>;
+
+public:
+  static const char *name(Counter counter);
+
+  /**
+   * @brief Read current values of counters of the calling thread
+   *
+   * @return false if counters are not available (e.g. not permitted by perf_event_paranoid)
+   */
+  static bool read(Values &values);
+};
+
+#endif // __ONERT_UTIL_PERF_COUNTERS_H__
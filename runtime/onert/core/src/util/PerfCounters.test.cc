@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PerfCounters.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(PerfCounters, name)
+{
+  EXPECT_EQ(std::string(PerfCounters::name(PerfCounters::CYCLES)), "cycles");
+  EXPECT_EQ(std::string(PerfCounters::name(PerfCounters::BRANCH_MISSES)), "branch_misses");
+}
+
+TEST(PerfCounters, read)
+{
+  PerfCounters::Values begin, end;
+  if (!PerfCounters::read(begin))
+    GTEST_SKIP() << "Hardware performance counters are not available";
+
+  volatile uint64_t sum = 0;
+  for (uint64_t i = 0; i < 100000; ++i)
+    sum = sum + i;
+
+  ASSERT_TRUE(PerfCounters::read(end));
+  EXPECT_GT(end[PerfCounters::INSTRUCTIONS], begin[PerfCounters::INSTRUCTIONS]);
+  EXPECT_GE(end[PerfCounters::CYCLES], begin[PerfCounters::CYCLES]);
+}
@@ -183,5 +183,44 @@ void SNPEWriter::flush(const std::vector<std::unique_ptr<EventRecorder>> &record
     }
   }
 
+  // Hardware performance counters
+  {
+    // 2D keys : stats[backend][op_type]
+    std::unordered_map<std::string, std::unordered_map<std::string, PerfCounterStat>> stats;
+    for (const auto &recorder : recorders)
+    {
+      for (const auto &stat : recorder->perf_counter_stats())
+      {
+        auto &merged = stats[stat.backend][stat.op_type];
+        if (merged.values.empty())
+        {
+          merged = stat;
+          continue;
+        }
+        assert(merged.values.size() == stat.values.size());
+        merged.count += stat.count;
+        merged.calling_thread_only |= stat.calling_thread_only;
+        for (size_t i = 0; i < stat.values.size(); ++i)
+          merged.values[i].second += stat.values[i].second;
+      }
+    }
+
+    if (!stats.empty())
+    {
+      auto &perf = exec_data["perf_counters"] = Json::Value{Json::objectValue};
+      for (const auto &[backend, stat_map] : stats)
+      {
+        for (const auto &[op_type, stat] : stat_map)
+        {
+          auto &json_op = perf[backend][op_type];
+          json_op["Count"] = stat.count;
+          for (const auto &[name, sum] : stat.values)
+            json_op["Avg_" + name] = stat.count == 0 ? 0 : sum / stat.count;
+          json_op["Calling_thread_only"] = stat.calling_thread_only;
+        }
+      }
+    }
+  }
+
   _os << root;
 }
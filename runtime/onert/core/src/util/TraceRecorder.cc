@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceRecorder.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+
+#ifdef DEBUG
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+size_t roundUpToPowerOf2(size_t value)
+{
+  size_t result = 1;
+  while (result < value)
+    result <<= 1;
+  return result;
+}
+
+std::atomic<uint64_t> next_recorder_id{1};
+
+// Buffers of recently used recorders on this thread
+// NOTE Recorder id is used as a key instead of address, which may be reused after destruction
+struct ThreadCache
+{
+  static constexpr size_t kSize = 4;
+
+  std::array<uint64_t, kSize> ids{};
+  std::array<void *, kSize> buffers{};
+  size_t next = 0;
+};
+
+thread_local ThreadCache thread_cache;
+
+} // namespace
+
+TraceRecorder::TraceRecorder(size_t capacity)
+  : _id{next_recorder_id.fetch_add(1)}, _capacity{roundUpToPowerOf2(std::max<size_t>(capacity, 1))}
+{
+  for (auto &backend : _backends)
+    backend.store(nullptr);
+}
+
+TraceRecorder::~TraceRecorder() = default;
+
+uint64_t TraceRecorder::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+TraceRecorder::Buffer *TraceRecorder::threadBuffer()
+{
+  auto &cache = thread_cache;
+  for (size_t i = 0; i < ThreadCache::kSize; ++i)
+  {
+    if (cache.ids[i] == _id)
+      return static_cast<Buffer *>(cache.buffers[i]);
+  }
+
+  auto buffer = registerThread();
+  cache.ids[cache.next] = _id;
+  cache.buffers[cache.next] = buffer;
+  cache.next = (cache.next + 1) % ThreadCache::kSize;
+  return buffer;
+}
+
+TraceRecorder::Buffer *TraceRecorder::registerThread()
+{
+  const auto tid = std::this_thread::get_id();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (auto &&[buffer_tid, buffer] : _buffers)
+  {
+    // Evicted from cache
+    if (buffer_tid == tid)
+      return buffer.get();
+  }
+  _buffers.emplace_back(tid, std::make_unique<Buffer>(_capacity));
+  return _buffers.back().second.get();
+}
+
+void TraceRecorder::record(TraceRecord::Kind kind, uint32_t model_index, uint32_t subg_index,
+                           uint32_t op_index, uint16_t backend_id)
+{
+  auto buffer = threadBuffer();
+
+  // Only this thread writes to the buffer
+  const auto head = buffer->head.load(std::memory_order_relaxed);
+  auto &rec = buffer->records[head & (_capacity - 1)];
+  rec.ticks = now();
+  rec.model_index = model_index;
+  rec.subg_index = subg_index;
+  rec.op_index = op_index;
+  rec.backend_id = backend_id;
+  rec.kind = kind;
+#ifdef DEBUG
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  rec.maxrss = ru.ru_maxrss;
+  rec.minflt = ru.ru_minflt;
+#else
+  rec.maxrss = 0;
+  rec.minflt = 0;
+#endif
+  buffer->head.store(head + 1, std::memory_order_release);
+}
+
+uint16_t TraceRecorder::backendId(const void *backend)
+{
+  assert(backend != nullptr);
+  for (uint16_t id = 0; id < kMaxBackends; ++id)
+  {
+    auto registered = _backends[id].load(std::memory_order_acquire);
+    if (registered == backend)
+      return id;
+    if (registered == nullptr)
+    {
+      // Another thread may register other backend at this slot
+      if (_backends[id].compare_exchange_strong(registered, backend, std::memory_order_acq_rel))
+        return id;
+      if (registered == backend)
+        return id;
+    }
+  }
+  throw std::runtime_error{"TraceRecorder: Too many backends"};
+}
+
+std::vector<TraceRecord> TraceRecorder::collect() const
+{
+  std::vector<TraceRecord> records;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (const auto &buffer : _buffers)
+  {
+    const auto head = buffer.second->head.load(std::memory_order_acquire);
+    const auto begin = head > _capacity ? head - _capacity : 0;
+    for (auto i = begin; i < head; ++i)
+      records.emplace_back(buffer.second->records[i & (_capacity - 1)]);
+  }
+
+  std::stable_sort(records.begin(), records.end(),
+                   [](const TraceRecord &lhs, const TraceRecord &rhs) {
+                     return lhs.ticks < rhs.ticks;
+                   });
+  return records;
+}
+
+uint64_t TraceRecorder::dropped() const
+{
+  uint64_t dropped = 0;
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  for (const auto &buffer : _buffers)
+  {
+    const auto head = buffer.second->head.load(std::memory_order_acquire);
+    if (head > _capacity)
+      dropped += head - _capacity;
+  }
+  return dropped;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_RECORDER_H__
+#define __ONERT_UTIL_TRACE_RECORDER_H__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size binary record of an execution event
+ *
+ * Names and strings are not kept here. They are resolved from indices when the records are
+ * written to files.
+ */
+struct TraceRecord
+{
+  enum class Kind : uint8_t
+  {
+    SUBG_BEGIN,
+    SUBG_END,
+    OP_BEGIN,
+    OP_END,
+  };
+
+  uint64_t ticks; // TraceRecorder::now()
+  uint32_t model_index;
+  uint32_t subg_index;
+  uint32_t op_index;
+  uint16_t backend_id; // Index returned by TraceRecorder::backendId
+  Kind kind;
+  // Resource usage, which is recorded in debug build only
+  uint32_t maxrss;
+  uint32_t minflt;
+};
+
+/**
+ * @brief Recorder of TraceRecord with per-thread ring buffers
+ *
+ * record() does not lock nor allocate after the first call on each thread. When a buffer is
+ * full, the oldest records of the thread are overwritten.
+ *
+ * NOTE collect() should not be called while other threads are calling record()
+ */
+class TraceRecorder
+{
+public:
+  static constexpr size_t kDefaultCapacity = 1 << 15;
+  static constexpr size_t kMaxBackends = 16;
+
+public:
+  /**
+   * @param capacity Number of records kept for each thread, rounded up to power of 2
+   */
+  explicit TraceRecorder(size_t capacity = kDefaultCapacity);
+  ~TraceRecorder();
+
+  TraceRecorder(const TraceRecorder &) = delete;
+  TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+public:
+  /**
+   * @brief Monotonic clock ticks in nanoseconds
+   */
+  static uint64_t now();
+
+  void record(TraceRecord::Kind kind, uint32_t model_index, uint32_t subg_index,
+              uint32_t op_index = 0, uint16_t backend_id = 0);
+
+  /**
+   * @brief Return a small integer id of backend (or any other object) without locking
+   *
+   * @throw std::runtime_error if there are more than kMaxBackends objects
+   */
+  uint16_t backendId(const void *backend);
+  const void *backend(uint16_t id) const { return _backends.at(id).load(); }
+
+  /**
+   * @brief Return kept records of all threads sorted by ticks
+   */
+  std::vector<TraceRecord> collect() const;
+
+  /**
+   * @brief Return the number of records overwritten
+   */
+  uint64_t dropped() const;
+
+private:
+  struct Buffer
+  {
+    explicit Buffer(size_t capacity) : records(new TraceRecord[capacity]) {}
+
+    std::unique_ptr<TraceRecord[]> records;
+    std::atomic<uint64_t> head{0};
+  };
+
+  Buffer *threadBuffer();
+  Buffer *registerThread();
+
+private:
+  const uint64_t _id;
+  const size_t _capacity;
+  std::array<std::atomic<const void *>, kMaxBackends> _backends;
+
+  mutable std::mutex _mutex;
+  std::vector<std::pair<std::thread::id, std::unique_ptr<Buffer>>> _buffers;
+};
+
+#endif // __ONERT_UTIL_TRACE_RECORDER_H__
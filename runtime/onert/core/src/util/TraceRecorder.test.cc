@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceRecorder.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using Kind = TraceRecord::Kind;
+
+TEST(TraceRecorder, record)
+{
+  TraceRecorder recorder;
+
+  recorder.record(Kind::SUBG_BEGIN, 0, 1);
+  recorder.record(Kind::OP_BEGIN, 0, 1, 2, 3);
+  recorder.record(Kind::OP_END, 0, 1, 2, 3);
+  recorder.record(Kind::SUBG_END, 0, 1);
+
+  auto records = recorder.collect();
+  ASSERT_EQ(records.size(), 4);
+  EXPECT_EQ(records[0].kind, Kind::SUBG_BEGIN);
+  EXPECT_EQ(records[1].kind, Kind::OP_BEGIN);
+  EXPECT_EQ(records[1].subg_index, 1);
+  EXPECT_EQ(records[1].op_index, 2);
+  EXPECT_EQ(records[1].backend_id, 3);
+  EXPECT_EQ(records[3].kind, Kind::SUBG_END);
+  for (size_t i = 1; i < records.size(); ++i)
+    EXPECT_LE(records[i - 1].ticks, records[i].ticks);
+  EXPECT_EQ(recorder.dropped(), 0);
+}
+
+TEST(TraceRecorder, ring_buffer)
+{
+  TraceRecorder recorder(6); // rounded up to 8
+
+  for (uint32_t i = 0; i < 20; ++i)
+    recorder.record(Kind::OP_BEGIN, 0, 0, i);
+
+  auto records = recorder.collect();
+  ASSERT_EQ(records.size(), 8);
+  // Oldest records are overwritten
+  for (uint32_t i = 0; i < 8; ++i)
+    EXPECT_EQ(records[i].op_index, 12 + i);
+  EXPECT_EQ(recorder.dropped(), 12);
+}
+
+TEST(TraceRecorder, multiple_threads)
+{
+  TraceRecorder recorder;
+
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&recorder, t]() {
+      for (uint32_t i = 0; i < 100; ++i)
+        recorder.record(Kind::OP_BEGIN, 0, t, i);
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  auto records = recorder.collect();
+  ASSERT_EQ(records.size(), 400);
+
+  // Records of each thread are kept in order
+  std::vector<uint32_t> next(4, 0);
+  for (const auto &rec : records)
+    EXPECT_EQ(rec.op_index, next[rec.subg_index]++);
+}
+
+TEST(TraceRecorder, backend_id)
+{
+  TraceRecorder recorder;
+  int backend1, backend2;
+
+  auto id1 = recorder.backendId(&backend1);
+  auto id2 = recorder.backendId(&backend2);
+  EXPECT_NE(id1, id2);
+  EXPECT_EQ(recorder.backendId(&backend1), id1);
+  EXPECT_EQ(recorder.backend(id2), &backend2);
+}
+
+TEST(TraceRecorder, neg_backend_id_overflow)
+{
+  TraceRecorder recorder;
+  std::vector<int> backends(TraceRecorder::kMaxBackends + 1);
+
+  for (size_t i = 0; i < TraceRecorder::kMaxBackends; ++i)
+    recorder.backendId(&backends[i]);
+  EXPECT_THROW(recorder.backendId(&backends.back()), std::runtime_error);
+}
@@ -0,0 +1,42 @@
+#!/usr/bin/env python3
+
+import numpy as np
+import sys
+import time
+from onert import infer
+
+
+def main(nnpackage_path, backends="cpu", num_requests=64):
+    num_requests = int(num_requests)
+
+    # Requests of the same shape are batched along the first dimension
+    # and run on 2 sessions concurrently
+    with infer.async_session(nnpackage_path,
+                             backends,
+                             num_sessions=2,
+                             max_batch_size=8,
+                             max_delay_ms=2.0) as session:
+        # Prepare input. Here we just allocate dummy input arrays of batch 1.
+        input_infos = session.get_inputs_tensorinfo()
+        requests = []
+        for _ in range(num_requests):
+            dummy_inputs = []
+            for info in input_infos:
+                shape = (1, ) + tuple(max(d, 1) for d in info.dims[1:info.rank])
+                dummy_inputs.append(
+                    np.random.uniform(low=0.0, high=1.0, size=shape).astype(info.dtype))
+            requests.append(dummy_inputs)
+
+        start = time.perf_counter()
+        futures = session.infer_many(requests)
+        outputs = [future.result() for future in futures]
+        elapsed_ms = (time.perf_counter() - start) * 1000
+
+    print(f"{len(outputs)} requests are done in {elapsed_ms:.3f} ms.")
+    print(f"nnpackage {nnpackage_path.split('/')[-1]} runs successfully.")
+    return
+
+
+if __name__ == "__main__":
+    argv = sys.argv[1:]
+    main(*argv)
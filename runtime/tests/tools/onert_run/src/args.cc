@@ -252,6 +252,31 @@ void Args::Initialize(void)
   _arser.add_argument("--signature")
     .type(arser::DataType::STR)
     .help({"Signature to select.", "If it is not set, 0th subgraph will be selected"});
+  _arser.add_argument("--load_sessions")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help({"Run in load mode with the given number of sessions of the model",
+           "Load mode reports throughput, latency percentiles and RSS over time",
+           "instead of per-phase times. '--num_runs' and dump options are ignored."});
+  _arser.add_argument("--load_threads")
+    .type(arser::DataType::INT32)
+    .default_value(0)
+    .help({"The number of threads issuing requests in load mode",
+           "Thread i uses session (i % load_sessions). 0 means one thread per session."});
+  _arser.add_argument("--load_rate")
+    .type(arser::DataType::FLOAT)
+    .default_value(0.f)
+    .help({"Request arrival rate (requests/s) over all threads in load mode",
+           "0: closed loop, each thread issues the next request when the previous one ends",
+           "> 0: open loop, latency includes the wait from the scheduled arrival"});
+  _arser.add_argument("--load_duration")
+    .type(arser::DataType::INT32)
+    .default_value(10)
+    .help("Duration(s) of load mode, excluding preparation and warmup");
+  _arser.add_argument("--load_rss_interval")
+    .type(arser::DataType::INT32)
+    .default_value(100)
+    .help("Interval(ms) of RSS sampling in load mode");
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -342,6 +367,11 @@ void Args::Parse(const int argc, char **argv)
     _gpumem_poll = _arser.get<bool>("--gpumem_poll");
     _mem_poll = _arser.get<bool>("--mem_poll");
     _write_report = _arser.get<bool>("--write_report");
+    _load_sessions = _arser.get<int32_t>("--load_sessions");
+    _load_threads = _arser.get<int32_t>("--load_threads");
+    _load_rate = _arser.get<float>("--load_rate");
+    _load_duration = _arser.get<int32_t>("--load_duration");
+    _load_rss_interval = _arser.get<int32_t>("--load_rss_interval");
 
     auto shape_prepare = _arser.get<std::string>("--shape_prepare");
     auto shape_run = _arser.get<std::string>("--shape_run");
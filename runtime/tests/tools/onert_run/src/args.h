@@ -78,6 +78,11 @@ public:
   const std::string &getCodegen(void) const { return _codegen; }
   const std::string &getCodegenModelPath(void) const { return _codegen_model_path; }
   const std::string &getSignature(void) const { return _signature; }
+  int32_t getLoadSessions(void) const { return _load_sessions; }
+  int32_t getLoadThreads(void) const { return _load_threads; }
+  float getLoadRate(void) const { return _load_rate; }
+  int32_t getLoadDuration(void) const { return _load_duration; }
+  int32_t getLoadRssInterval(void) const { return _load_rss_interval; }
 
 private:
   void Initialize();
@@ -117,6 +122,11 @@ private:
   std::string _codegen;
   std::string _codegen_model_path;
   std::string _signature;
+  int32_t _load_sessions = 0;
+  int32_t _load_threads = 0;
+  float _load_rate = 0.f;
+  int32_t _load_duration = 10;
+  int32_t _load_rss_interval = 100;
 };
 
 } // end of namespace onert_run
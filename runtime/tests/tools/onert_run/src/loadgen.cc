@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+
+#include "allocation.h"
+#include "benchmark/MemoryInfo.h"
+#include "nnfw.h"
+#include "nnfw_experimental.h"
+#include "nnfw_internal.h"
+#include "nnfw_util.h"
+#include "randomgen.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using namespace onert_run;
+using Clock = std::chrono::steady_clock;
+
+// A prepared session with its own input and output buffers
+struct LoadSession
+{
+  ~LoadSession()
+  {
+    if (session != nullptr)
+      nnfw_close_session(session);
+  }
+
+  nnfw_session *session = nullptr;
+  std::vector<Allocation> inputs;
+  std::vector<Allocation> outputs;
+  // nnfw_session is not thread-safe, so threads sharing a session take turns
+  std::mutex mutex;
+};
+
+void setShapes(nnfw_session *session, uint32_t num_inputs, const TensorShapeMap &shape_map)
+{
+  for (uint32_t i = 0; i < num_inputs; i++)
+  {
+    auto found = shape_map.find(i);
+    if (found == shape_map.end())
+      continue;
+
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
+    ti.rank = found->second.size();
+    for (int32_t d = 0; d < ti.rank; d++)
+      ti.dims[d] = found->second.at(d);
+    NNPR_ENSURE_STATUS(nnfw_set_input_tensorinfo(session, i, &ti));
+  }
+}
+
+std::unique_ptr<LoadSession> createSession(Args &args)
+{
+  auto load_session = std::make_unique<LoadSession>();
+  NNPR_ENSURE_STATUS(nnfw_create_session(&load_session->session));
+  nnfw_session *session = load_session->session;
+
+  const auto &path = args.useSingleModel() ? args.getModelFilename() : args.getPackageFilename();
+  NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session, path.c_str()));
+
+  const auto &signature = args.getSignature();
+  if (signature != "")
+    NNPR_ENSURE_STATUS(nnfw_configure_signature(session, signature.c_str()));
+
+  const char *available_backends = std::getenv("BACKENDS");
+  if (available_backends)
+    NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+  const char *num_threads = std::getenv("NUM_THREADS");
+  if (num_threads)
+    NNPR_ENSURE_STATUS(nnfw_set_config(session, "NUM_THREADS", num_threads));
+
+  uint32_t num_inputs;
+  uint32_t num_outputs;
+  NNPR_ENSURE_STATUS(nnfw_input_size(session, &num_inputs));
+  NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
+
+  if (args.getForceFloat())
+  {
+    for (uint32_t i = 0; i < num_inputs; i++)
+      NNPR_ENSURE_STATUS(nnfw_set_input_type(session, i, NNFW_TYPE_TENSOR_FLOAT32));
+    for (uint32_t i = 0; i < num_outputs; i++)
+      NNPR_ENSURE_STATUS(nnfw_set_output_type(session, i, NNFW_TYPE_TENSOR_FLOAT32));
+  }
+
+  setShapes(session, num_inputs, args.getShapeMapForPrepare());
+  NNPR_ENSURE_STATUS(nnfw_prepare(session));
+  if (signature != "")
+    NNPR_ENSURE_STATUS(nnfw_set_signature_run(session, signature.c_str()));
+  setShapes(session, num_inputs, args.getShapeMapForRun());
+
+  load_session->inputs = std::vector<Allocation>(num_inputs);
+  for (uint32_t i = 0; i < num_inputs; i++)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
+    auto input_size_in_bytes = bufsize_for(&ti);
+    load_session->inputs[i].alloc(input_size_in_bytes, ti.dtype);
+    NNPR_ENSURE_STATUS(
+      nnfw_set_input(session, i, ti.dtype, load_session->inputs[i].data(), input_size_in_bytes));
+  }
+  RandomGenerator().generate(load_session->inputs);
+
+  auto output_sizes = args.getOutputSizes();
+  load_session->outputs = std::vector<Allocation>(num_outputs);
+  for (uint32_t i = 0; i < num_outputs; i++)
+  {
+    nnfw_tensorinfo ti;
+    NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+
+    uint64_t output_size_in_bytes = 0;
+    auto found = output_sizes.find(i);
+    if (found != output_sizes.end())
+      output_size_in_bytes = found->second;
+    else
+    {
+      if (has_dynamic_dim(&ti))
+        throw std::runtime_error("Cannot allocate output buffer for dynamic shape. Use "
+                                 "--output_sizes to specify output buffer sizes");
+      output_size_in_bytes = bufsize_for(&ti);
+    }
+    load_session->outputs[i].alloc(output_size_in_bytes, ti.dtype);
+    NNPR_ENSURE_STATUS(nnfw_set_output(session, i, ti.dtype, load_session->outputs[i].data(),
+                                       output_size_in_bytes));
+  }
+
+  return load_session;
+}
+
+uint64_t elapsedUs(Clock::time_point from, Clock::time_point to)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+// Samples RSS periodically on its own thread until stopped
+class RssSampler
+{
+public:
+  RssSampler(int interval_ms) : _interval{std::chrono::milliseconds(std::max(interval_ms, 1))}
+  {
+    if (!benchmark::prepareVmRSS())
+      return;
+    _start = Clock::now();
+    _thread = std::thread([this]() {
+      std::unique_lock<std::mutex> lock(_mutex);
+      do
+      {
+        _samples.emplace_back(elapsedUs(_start, Clock::now()) / 1000, benchmark::getVmRSS());
+      } while (!_cv.wait_for(lock, _interval, [this]() { return _stop; }));
+    });
+  }
+
+  ~RssSampler() { stop(); }
+
+  // Return samples of (ms since start, RSS in kB)
+  const std::vector<std::pair<uint64_t, uint32_t>> &stop()
+  {
+    if (_thread.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+      }
+      _cv.notify_one();
+      _thread.join();
+      _samples.emplace_back(elapsedUs(_start, Clock::now()) / 1000, benchmark::getVmRSS());
+    }
+    return _samples;
+  }
+
+private:
+  std::chrono::milliseconds _interval;
+  Clock::time_point _start;
+  std::thread _thread;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop = false;
+  std::vector<std::pair<uint64_t, uint32_t>> _samples;
+};
+
+} // namespace
+
+namespace onert_run
+{
+
+void LatencyStats::merge(const std::vector<uint64_t> &latencies)
+{
+  _latencies.insert(_latencies.end(), latencies.begin(), latencies.end());
+  _sorted = false;
+}
+
+void LatencyStats::sort()
+{
+  if (!_sorted)
+    std::sort(_latencies.begin(), _latencies.end());
+  _sorted = true;
+}
+
+uint64_t LatencyStats::percentile(double p)
+{
+  if (_latencies.empty())
+    return 0;
+  sort();
+  // Nearest-rank percentile, with a tolerance for rounding errors of p / 100
+  const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * _latencies.size() - 1e-6));
+  return _latencies[std::min(std::max<size_t>(rank, 1), _latencies.size()) - 1];
+}
+
+uint64_t LatencyStats::max()
+{
+  if (_latencies.empty())
+    return 0;
+  sort();
+  return _latencies.back();
+}
+
+double LatencyStats::mean() const
+{
+  if (_latencies.empty())
+    return 0;
+  return std::accumulate(_latencies.begin(), _latencies.end(), 0.0) / _latencies.size();
+}
+
+std::vector<std::pair<uint64_t, size_t>> LatencyStats::histogram() const
+{
+  std::vector<std::pair<uint64_t, size_t>> buckets;
+  for (auto latency : _latencies)
+  {
+    size_t index = 0;
+    while ((1ull << index) < latency)
+      index++;
+    if (buckets.size() <= index)
+      buckets.resize(index + 1);
+    buckets[index].second++;
+  }
+  for (size_t i = 0; i < buckets.size(); ++i)
+    buckets[i].first = 1ull << i;
+
+  // Drop empty leading buckets
+  auto first = std::find_if(buckets.begin(), buckets.end(),
+                            [](const std::pair<uint64_t, size_t> &b) { return b.second > 0; });
+  buckets.erase(buckets.begin(), first);
+  return buckets;
+}
+
+int runLoad(Args &args)
+{
+  const int num_sessions = args.getLoadSessions();
+  const int num_threads = args.getLoadThreads() > 0 ? args.getLoadThreads() : num_sessions;
+  const float rate = args.getLoadRate();
+  const int duration_sec = args.getLoadDuration();
+  const bool open_loop = rate > 0.f;
+  const auto verbose = args.getVerboseLevel();
+
+  if (num_sessions <= 0 || num_threads <= 0 || duration_sec <= 0)
+    throw std::runtime_error("Load mode needs positive sessions, threads and duration");
+
+  RssSampler rss_sampler(args.getLoadRssInterval());
+
+  std::vector<std::unique_ptr<LoadSession>> sessions;
+  for (int i = 0; i < num_sessions; ++i)
+    sessions.emplace_back(createSession(args));
+
+  for (auto &s : sessions)
+    for (int32_t i = 0; i < args.getWarmupRuns(); ++i)
+      NNPR_ENSURE_STATUS(nnfw_run(s->session));
+
+  const auto period = open_loop
+                        ? std::chrono::duration_cast<Clock::duration>(
+                            std::chrono::duration<double>(1.0 / static_cast<double>(rate)))
+                        : Clock::duration::zero();
+  std::atomic<uint64_t> next_request{0};
+  std::atomic<uint64_t> failed{0};
+  std::vector<std::vector<uint64_t>> latencies(num_threads);
+
+  const auto start = Clock::now();
+  const auto end = start + std::chrono::seconds(duration_sec);
+
+  auto worker = [&](int thread_index) {
+    auto &load_session = *sessions[thread_index % num_sessions];
+    auto &thread_latencies = latencies[thread_index];
+    while (true)
+    {
+      Clock::time_point issued;
+      if (open_loop)
+      {
+        issued = start + period * next_request++;
+        if (issued >= end)
+          break;
+        std::this_thread::sleep_until(issued);
+      }
+      else
+      {
+        issued = Clock::now();
+        if (issued >= end)
+          break;
+      }
+
+      NNFW_STATUS status;
+      {
+        std::lock_guard<std::mutex> lock(load_session.mutex);
+        status = nnfw_run(load_session.session);
+      }
+      if (status != NNFW_STATUS_NO_ERROR)
+      {
+        failed++;
+        continue;
+      }
+      thread_latencies.emplace_back(elapsedUs(issued, Clock::now()));
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.emplace_back(worker, i);
+  for (auto &t : threads)
+    t.join();
+
+  const double elapsed_sec = elapsedUs(start, Clock::now()) / 1e6;
+  const auto &rss = rss_sampler.stop();
+  sessions.clear();
+
+  LatencyStats stats;
+  for (const auto &l : latencies)
+    stats.merge(l);
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3) << std::fixed;
+  std::cout << "===================================" << std::endl;
+  std::cout << "LOAD        : " << num_sessions << " sessions, " << num_threads << " threads, ";
+  if (open_loop)
+    std::cout << "open loop at " << rate << " req/s";
+  else
+    std::cout << "closed loop";
+  std::cout << ", " << duration_sec << " s" << std::endl;
+  std::cout << "Requests    : " << stats.count() << " completed, " << failed.load() << " failed"
+            << std::endl;
+  std::cout << "Throughput  : " << stats.count() / elapsed_sec << " req/s" << std::endl;
+  std::cout << "Latency" << std::endl;
+  std::cout << "- MEAN     :  " << stats.mean() / 1e3 << " ms" << std::endl;
+  for (auto p : {50.0, 90.0, 99.0, 99.9})
+  {
+    std::ostringstream name;
+    name << "P" << std::defaultfloat << p;
+    std::cout << "- " << std::setw(9) << std::left << name.str() << ":  " << std::fixed
+              << stats.percentile(p) / 1e3 << " ms" << std::endl;
+  }
+  std::cout << "- MAX      :  " << stats.max() / 1e3 << " ms" << std::endl;
+  std::cout << "Latency histogram" << std::endl;
+  for (const auto &bucket : stats.histogram())
+    std::cout << "- <= " << std::setw(10) << std::right << bucket.first / 1e3 << " ms : "
+              << bucket.second << std::endl;
+  std::cout << std::left;
+  if (!rss.empty())
+  {
+    uint32_t peak = 0;
+    for (const auto &sample : rss)
+      peak = std::max(peak, sample.second);
+    std::cout << "RSS         : start " << rss.front().second << " kb, peak " << peak
+              << " kb, end " << rss.back().second << " kb" << std::endl;
+    if (verbose > 0)
+      for (const auto &sample : rss)
+        std::cout << "- " << std::setw(8) << std::right << sample.first << " ms : "
+                  << sample.second << " kb" << std::endl;
+  }
+  std::cout << "===================================" << std::endl;
+  std::cout << std::setprecision(ss_precision) << std::defaultfloat << std::left;
+
+  return 0;
+}
+
+} // namespace onert_run
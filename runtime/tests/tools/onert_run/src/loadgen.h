@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_RUN_LOADGEN_H__
+#define __ONERT_RUN_LOADGEN_H__
+
+#include "args.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace onert_run
+{
+
+/**
+ * @brief Latencies of all requests in a load run
+ */
+class LatencyStats
+{
+public:
+  void merge(const std::vector<uint64_t> &latencies);
+
+  size_t count() const { return _latencies.size(); }
+  /// @brief Return the p-th percentile latency in us (0 < p <= 100)
+  uint64_t percentile(double p);
+  uint64_t max();
+  double mean() const;
+  /// @brief Return (upper bound in us, count) of power-of-two latency buckets
+  std::vector<std::pair<uint64_t, size_t>> histogram() const;
+
+private:
+  void sort();
+
+private:
+  std::vector<uint64_t> _latencies; // us
+  bool _sorted = true;
+};
+
+/**
+ * @brief Drive sessions from multiple threads and report throughput, latency and RSS
+ *
+ * With a request rate of 0, each thread runs requests back to back (closed loop). Otherwise
+ * requests arrive at the fixed rate regardless of completions (open loop), and latency is
+ * measured from the scheduled arrival so that queueing delay is included.
+ *
+ * @return exit code of onert_run
+ */
+int runLoad(Args &args);
+
+} // namespace onert_run
+
+#endif // __ONERT_RUN_LOADGEN_H__
@@ -20,6 +20,7 @@
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
+#include "loadgen.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
@@ -108,6 +109,9 @@ int main(const int argc, char **argv)
   {
     Args args(argc, argv);
 
+    if (args.getLoadSessions() > 0)
+      return runLoad(args);
+
 #ifdef RUY_PROFILER
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
@@ -391,6 +395,9 @@ int main(const int argc, char **argv)
     if (const char *trace_enable = std::getenv("TRACING_MODE");
         trace_enable != nullptr && std::string(trace_enable) == "1")
       NNPR_ENSURE_STATUS(nnfw_set_execute_config(session, NNFW_RUN_CONFIG_TRACE, nullptr));
+    if (const char *perf_enable = std::getenv("PERF_COUNTERS");
+        perf_enable != nullptr && std::string(perf_enable) == "1")
+      NNPR_ENSURE_STATUS(nnfw_set_execute_config(session, NNFW_RUN_CONFIG_PERF_COUNTERS, nullptr));
 
     // NOTE: Measuring memory can't avoid taking overhead. Therefore, memory will be measured on the
     // only warmup.
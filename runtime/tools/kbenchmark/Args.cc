@@ -54,6 +54,16 @@ void Args::Initialize(const int argc, char **argv)
     .type(arser::DataType::STR)
     .default_value("")
     .help("Set additional strings for output file name");
+  arser.add_argument("--baseline", "-b")
+    .type(arser::DataType::STR)
+    .default_value("")
+    .help({"Throughput csv file of a previous run to compare with",
+           "Benchmarks slower than the baseline by more than '--threshold' are reported",
+           "as regressions and kbenchmark exits with 1"});
+  arser.add_argument("--threshold", "-t")
+    .type(arser::DataType::FLOAT)
+    .default_value(5.0f)
+    .help("Allowed slowdown(%) against '--baseline'");
 
   try
   {
@@ -107,6 +117,13 @@ void Args::Initialize(const int argc, char **argv)
   _filter = arser.get<std::string>("--filter");
   _output = arser.get<std::string>("--output");
   _verbose = arser.get<int>("--verbose");
+  _baseline = arser.get<std::string>("--baseline");
+  if (!_baseline.empty() && !std::filesystem::exists(_baseline))
+  {
+    std::cerr << _baseline << " file not found" << std::endl;
+    exit(1);
+  }
+  _threshold = arser.get<float>("--threshold");
 }
 
 } // namespace kbenchmark
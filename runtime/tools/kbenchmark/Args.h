@@ -33,6 +33,8 @@ public:
   const std::string &filter(void) { return _filter; }
   const std::string &output(void) { return _output; }
   int verbose(void) { return _verbose; }
+  const std::string &baseline(void) { return _baseline; }
+  float threshold(void) { return _threshold; }
 
 private:
   void Initialize(const int argc, char **argv);
@@ -44,6 +46,8 @@ private:
   std::string _filter;
   std::string _output;
   int _verbose;
+  std::string _baseline;
+  float _threshold;
 };
 
 } // namespace kbenchmark
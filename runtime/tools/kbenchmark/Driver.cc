@@ -17,17 +17,47 @@
 #include "Args.h"
 #include "ConfigFile.h"
 #include "OperationLoader.h"
+#include "Throughput.h"
 
 #include <nonius/nonius.h++>
 
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <string>
+#include <utility>
 
 // NOTE dlfcn.h is not a standard library
 #include <dlfcn.h>
 
 using namespace kbenchmark;
 
+namespace
+{
+
+using ThroughputKey = std::pair<int, std::string>; // layer, benchmark name
+
+// Read "layer,benchmark,seconds,..." rows of a throughput csv file
+std::map<ThroughputKey, double> readThroughputCsv(const std::string &filename)
+{
+  std::map<ThroughputKey, double> seconds;
+  std::ifstream file(filename);
+  std::string line;
+  std::getline(file, line); // header
+  while (std::getline(file, line))
+  {
+    std::stringstream ss(line);
+    std::string layer, name, sec;
+    if (std::getline(ss, layer, ',') && std::getline(ss, name, ',') && std::getline(ss, sec, ','))
+      seconds[{std::stoi(layer), name}] = std::stod(sec);
+  }
+  return seconds;
+}
+
+} // namespace
+
 int main(int argc, char *argv[])
 {
   Args args(argc, argv);
@@ -38,6 +68,7 @@ int main(int argc, char *argv[])
   // Load kernel library
   const std::vector<std::string> &kernel_list = args.kernel();
   std::vector<void *> khandle_list;
+  std::vector<ThroughputRecorder *> recorder_list;
 
   for (auto &k : kernel_list)
   {
@@ -64,6 +95,13 @@ int main(int argc, char *argv[])
     // Save khandle for dlclose
     khandle_list.push_back(khandle);
 
+    // Kernel libraries which know the work of their kernels export a throughput recorder
+    typedef ThroughputRecorder &(*throughput_entry)(void);
+    auto kthroughput_entry =
+      reinterpret_cast<throughput_entry>(dlsym(khandle, "benchmark_throughput"));
+    if (dlerror() == nullptr && kthroughput_entry != nullptr)
+      recorder_list.push_back(&kthroughput_entry());
+
     // Add current kernel benchmark functions to gloal benchmark list
     nonius::benchmark_registry &kbenchmarks = kbenchmark_entry();
     benchmarks.insert(std::end(benchmarks), std::begin(kbenchmarks), std::end(kbenchmarks));
@@ -114,6 +152,12 @@ int main(int argc, char *argv[])
   // Get OperationLoader instance
   OperationLoader &opl = OperationLoader::getInstance();
 
+  std::map<ThroughputKey, double> baseline;
+  if (!args.baseline().empty())
+    baseline = readThroughputCsv(args.baseline());
+  std::ofstream throughput_csv;
+  int regressions = 0;
+
   if (!opl.is_valid(cf.name()))
   {
     std::cerr << cf.name() << " is not valid operation" << std::endl;
@@ -133,9 +177,45 @@ int main(int argc, char *argv[])
       cfg.params.map = cfg.params.map.merged(op_params);
 
       nonius::go(cfg, benchmarks);
+
+      // Report throughput of this layer, and compare it with the baseline
+      for (auto recorder : recorder_list)
+      {
+        for (auto &r : recorder->records())
+        {
+          if (!throughput_csv.is_open())
+          {
+            throughput_csv.open(test_name + "_throughput.csv");
+            throughput_csv << "layer,benchmark,seconds,gflops,gbps" << std::endl;
+          }
+          throughput_csv << c.first << "," << r.name << "," << std::setprecision(9)
+                         << r.best_seconds << "," << r.gflops() << "," << r.gbytes() << std::endl;
+
+          std::cout << "[" << c.first << "] " << r.name << ": " << std::setprecision(3)
+                    << r.best_seconds * 1e6 << " us, " << r.gflops() << " GFLOP/s, "
+                    << r.gbytes() << " GB/s";
+          auto found = baseline.find({c.first, r.name});
+          if (found != baseline.end())
+          {
+            const double change = (r.best_seconds / found->second - 1.0) * 100.0;
+            std::cout << ", " << std::showpos << change << std::noshowpos << "% vs baseline";
+            if (change > args.threshold())
+            {
+              std::cout << " REGRESSION";
+              regressions++;
+            }
+          }
+          std::cout << std::endl;
+        }
+        recorder->clear();
+      }
     }
   }
 
+  if (!baseline.empty())
+    std::cout << regressions << " regression(s) over " << args.threshold() << "% against "
+              << args.baseline() << std::endl;
+
   // Release kernel library
   benchmarks.clear();
   for (auto khandle : khandle_list)
@@ -143,5 +223,5 @@ int main(int argc, char *argv[])
     dlclose(khandle);
   }
 
-  return 0;
+  return regressions > 0 ? 1 : 0;
 }
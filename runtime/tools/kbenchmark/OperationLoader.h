@@ -21,7 +21,16 @@
 #include <unordered_map>
 
 #include "Operation.h"
+#include "operations/Attention.h"
+#include "operations/BatchMatMul.h"
 #include "operations/Convolution.h"
+#include "operations/DepthwiseConvolution.h"
+#include "operations/FullyConnected.h"
+#include "operations/Mean.h"
+#include "operations/RmsNorm.h"
+#include "operations/RoPE.h"
+#include "operations/Softmax.h"
+#include "operations/Transpose.h"
 #include "operations/TransposeConv.h"
 
 namespace kbenchmark
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_THROUGHPUT_H__
+#define __KBENCHMARK_THROUGHPUT_H__
+
+#include <nonius/nonius.h++>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+
+/**
+ * @brief Work done by one run of a kernel
+ */
+struct Work
+{
+  double flops = 0; // floating point (or integer MAC) operations, a MAC counts as 2
+  double bytes = 0; // bytes read and written, assuming every tensor is touched once
+};
+
+struct ThroughputRecord
+{
+  std::string name;
+  Work work;
+  double best_seconds = std::numeric_limits<double>::max();
+
+  double gflops() const { return work.flops / best_seconds / 1e9; }
+  double gbytes() const { return work.bytes / best_seconds / 1e9; }
+};
+
+/**
+ * @brief Keep the fastest run time of each benchmark to derive GFLOP/s and GB/s
+ *
+ * nonius only reports times, so a kernel library which knows the work of its kernels
+ * measures them through ThroughputRecorder and exports it as `benchmark_throughput`.
+ * The driver reads and clears the records after each layer.
+ */
+class ThroughputRecorder
+{
+public:
+  template <typename Fn>
+  void measure(nonius::chronometer &meter, const std::string &name, const Work &work, Fn &&fn)
+  {
+    auto &record = find(name);
+    record.work = work;
+    meter.measure([&](int) {
+      const auto begin = std::chrono::steady_clock::now();
+      fn();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+      record.best_seconds = std::min(record.best_seconds, elapsed.count());
+    });
+  }
+
+  const std::vector<ThroughputRecord> &records(void) const { return _records; }
+  void clear(void) { _records.clear(); }
+
+private:
+  ThroughputRecord &find(const std::string &name)
+  {
+    auto it = std::find_if(_records.begin(), _records.end(),
+                           [&](const ThroughputRecord &r) { return r.name == name; });
+    if (it != _records.end())
+      return *it;
+    _records.emplace_back();
+    _records.back().name = name;
+    return _records.back();
+  }
+
+private:
+  std::vector<ThroughputRecord> _records;
+};
+
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_THROUGHPUT_H__
@@ -65,6 +65,14 @@ std::string get_key_string(const std::string &key, OperationInfo &info)
   return info[key];
 }
 
+// Return the value of an optional key, or default_value if the config doesn't have it
+std::string get_key_string(const std::string &key, OperationInfo &info,
+                           const std::string &default_value)
+{
+  auto it = info.find(key);
+  return it == info.end() ? default_value : it->second;
+}
+
 } // namespace kbenchmark
 
 #endif // __KBENCHMARK_UTILS_H__
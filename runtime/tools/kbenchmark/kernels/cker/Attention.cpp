@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Attention benchmark of cker kernels used by the cpu backend
+ *
+ * cker has no attention kernel. This composes the kernels in the same order as AttentionLayer of
+ * the cpu backend does for one decoded token.
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/RoPE.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Transpose.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+// INPUT is [n_batch, n_tokens, d_model] and K_CACHE is [n_batch, cache_size, n_head, d_head]
+NONIUS_PARAM(INPUT, std::string{"1,1,768"})
+NONIUS_PARAM(K_CACHE, std::string{"1,512,12,64"})
+// Position of the decoded token in the caches
+NONIUS_PARAM(POS, 255)
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_Attention_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto cache_shape = asShape(meter.param<K_CACHE>());
+  const int32_t cache_pos = meter.param<POS>();
+
+  // AttentionLayer supports one batch of one token only
+  const int32_t n_batch = input_shape.Dims(0);
+  const int32_t n_tokens = input_shape.Dims(1);
+  const int32_t d_model = input_shape.Dims(2);
+  const int32_t n_head = cache_shape.Dims(2);
+  const int32_t d_head = cache_shape.Dims(3);
+  if (n_batch != 1 || n_tokens != 1 || d_model != n_head * d_head)
+    throw std::runtime_error{"Attention: INPUT must be [1, 1, n_head * d_head] of K_CACHE"};
+
+  // Same context size as AttentionLayer, aligned to blocks of 32 tokens
+  const int32_t block_size = 32;
+  const int32_t aligned_ctx_size = ((cache_pos + 2 + block_size - 1) / block_size) * block_size;
+  if (cache_pos < 0 || aligned_ctx_size > cache_shape.Dims(1))
+    throw std::runtime_error{"Attention: POS is out of K_CACHE"};
+
+  const nnfw::cker::Shape weights_shape{d_model, d_model};
+  const nnfw::cker::Shape proj_shape{n_batch, n_tokens, d_model};
+  const nnfw::cker::Shape head_shape{n_batch, n_head, n_tokens, d_head};
+  const nnfw::cker::Shape sin_cos_shape{1, n_batch, n_tokens, d_head};
+  const nnfw::cker::Shape ctx_cache_shape{n_batch, aligned_ctx_size, n_head, d_head};
+  const nnfw::cker::Shape ctx_head_shape{n_batch, n_head, aligned_ctx_size, d_head};
+  const nnfw::cker::Shape qk_shape{n_batch, n_head, n_tokens, aligned_ctx_size};
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  auto wq = makeData<float>(weights_shape.FlatSize());
+  auto wk = makeData<float>(weights_shape.FlatSize());
+  auto wv = makeData<float>(weights_shape.FlatSize());
+  auto wo = makeData<float>(weights_shape.FlatSize());
+  auto sin_table = makeData<float>(sin_cos_shape.FlatSize());
+  auto cos_table = makeData<float>(sin_cos_shape.FlatSize());
+  auto k_cache = makeData<float>(cache_shape.FlatSize());
+  auto v_cache = makeData<float>(cache_shape.FlatSize());
+  std::vector<float> mask(aligned_ctx_size, 0.f);
+  std::fill(mask.begin() + cache_pos + 1, mask.end(), -INFINITY);
+
+  // Buffers are allocated once so that only the kernels are measured
+  std::vector<float> q_proj(proj_shape.FlatSize());
+  std::vector<float> k_proj(proj_shape.FlatSize());
+  std::vector<float> v_proj(proj_shape.FlatSize());
+  std::vector<float> q_rope(head_shape.FlatSize());
+  std::vector<float> k_rope(head_shape.FlatSize());
+  std::vector<float> k_cache_tr(ctx_head_shape.FlatSize());
+  std::vector<float> v_cache_tr(ctx_head_shape.FlatSize());
+  std::vector<float> qk(qk_shape.FlatSize());
+  std::vector<float> attn_score(qk_shape.FlatSize());
+  std::vector<float> attn_out(head_shape.FlatSize());
+  std::vector<float> output(proj_shape.FlatSize());
+
+  nnfw::cker::FullyConnectedParams fc_params{};
+  fc_params.float_activation_min = std::numeric_limits<float>::lowest();
+  fc_params.float_activation_max = std::numeric_limits<float>::max();
+  fc_params.lhs_cacheable = true;
+
+  nnfw::cker::TransposeParams tr_params{4, {0, 2, 1, 3}};
+
+  nnfw::cker::BatchMatMul score_bmm;
+  score_bmm.prepare(head_shape, ctx_head_shape, /*adj_x=*/false, /*adj_y=*/true,
+                    /*rhs_const=*/false);
+  nnfw::cker::BatchMatMul output_bmm;
+  output_bmm.prepare(qk_shape, ctx_head_shape, /*adj_x=*/false, /*adj_y=*/false,
+                     /*rhs_const=*/false);
+
+  nnfw::cker::SoftmaxParams softmax_params;
+  softmax_params.beta = 1.0f;
+
+  const float scaling_factor = 1.0f / std::sqrt(static_cast<float>(d_head));
+
+  // Multiply-accumulates of Q, K, V and output projections, scores and output over the context
+  kbenchmark::Work work;
+  work.flops = 2.0 * (4.0 * d_model * d_model + 2.0 * n_head * aligned_ctx_size * d_head);
+  work.bytes = 4 * sizeInBytes(weights_shape) + 2 * sizeInBytes(ctx_cache_shape) +
+               sizeInBytes(input_shape) + sizeInBytes(proj_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_Attention_Float", work, [&]() {
+    // Q, K and V projections
+    nnfw::cker::FullyConnected(fc_params, input_shape, input.data(), weights_shape, wq.data(),
+                               nnfw::cker::Shape{}, nullptr, proj_shape, q_proj.data());
+    nnfw::cker::FullyConnected(fc_params, input_shape, input.data(), weights_shape, wk.data(),
+                               nnfw::cker::Shape{}, nullptr, proj_shape, k_proj.data());
+    nnfw::cker::FullyConnected(fc_params, input_shape, input.data(), weights_shape, wv.data(),
+                               nnfw::cker::Shape{}, nullptr, proj_shape, v_proj.data());
+
+    // RoPE of Q and K, and K and V into the caches
+    nnfw::cker::RoPE<float>(nnfw::cker::RoPEMode::kGptNeox, head_shape, k_proj.data(),
+                            sin_cos_shape, sin_table.data(), sin_cos_shape, cos_table.data(),
+                            head_shape, k_rope.data());
+    nnfw::cker::RoPE<float>(nnfw::cker::RoPEMode::kGptNeox, head_shape, q_proj.data(),
+                            sin_cos_shape, sin_table.data(), sin_cos_shape, cos_table.data(),
+                            head_shape, q_rope.data());
+    std::memcpy(k_cache.data() + cache_pos * k_rope.size(), k_rope.data(),
+                sizeof(float) * k_rope.size());
+    std::memcpy(v_cache.data() + cache_pos * v_proj.size(), v_proj.data(),
+                sizeof(float) * v_proj.size());
+
+    // Scores of Q and transposed K cache
+    nnfw::cker::Transpose<float>(tr_params, ctx_cache_shape, k_cache.data(), ctx_head_shape,
+                                 k_cache_tr.data());
+    score_bmm(head_shape, q_rope.data(), ctx_head_shape, k_cache_tr.data(), /*adj_x=*/false,
+              /*adj_y=*/true, qk_shape, qk.data());
+    for (size_t i = 0; i < qk.size(); ++i)
+      qk[i] = qk[i] * scaling_factor + mask[i % aligned_ctx_size];
+    nnfw::cker::Softmax(softmax_params, qk_shape, qk.data(), qk_shape, attn_score.data());
+
+    // Output of scores and transposed V cache, and output projection
+    nnfw::cker::Transpose<float>(tr_params, ctx_cache_shape, v_cache.data(), ctx_head_shape,
+                                 v_cache_tr.data());
+    output_bmm(qk_shape, attn_score.data(), ctx_head_shape, v_cache_tr.data(), /*adj_x=*/false,
+               /*adj_y=*/false, head_shape, attn_out.data());
+    nnfw::cker::FullyConnected(fc_params, proj_shape, attn_out.data(), weights_shape, wo.data(),
+                               nnfw::cker::Shape{}, nullptr, proj_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
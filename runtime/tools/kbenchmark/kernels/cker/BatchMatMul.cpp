@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BatchMatMul benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/BatchMatMul.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(LHS, std::string{"1,12,128,64"})
+NONIUS_PARAM(RHS, std::string{"1,12,64,128"})
+NONIUS_PARAM(ADJ_X, std::string{"0"})
+NONIUS_PARAM(ADJ_Y, std::string{"0"})
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_BatchMatMul_Float", [](nonius::chronometer meter) {
+  const auto lhs_shape = asShape(meter.param<LHS>());
+  const auto rhs_shape = asShape(meter.param<RHS>());
+  const bool adj_x = meter.param<ADJ_X>() != "0";
+  const bool adj_y = meter.param<ADJ_Y>() != "0";
+
+  const int rank = lhs_shape.DimensionsCount();
+  assert(rank >= 2 && rank == rhs_shape.DimensionsCount());
+  const int m = lhs_shape.Dims(adj_x ? rank - 1 : rank - 2);
+  const int k = lhs_shape.Dims(adj_x ? rank - 2 : rank - 1);
+  const int n = rhs_shape.Dims(adj_y ? rank - 2 : rank - 1);
+  nnfw::cker::Shape output_shape(lhs_shape);
+  output_shape.SetDim(rank - 2, m);
+  output_shape.SetDim(rank - 1, n);
+  for (int i = 0; i < rank - 2; ++i)
+    output_shape.SetDim(i, std::max(lhs_shape.Dims(i), rhs_shape.Dims(i)));
+
+  auto lhs = makeData<float>(lhs_shape.FlatSize());
+  auto rhs = makeData<float>(rhs_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::BatchMatMul batch_matmul;
+  batch_matmul.prepare(lhs_shape, rhs_shape, adj_x, adj_y, false);
+
+  kbenchmark::Work work;
+  work.flops = 2.0 * output_shape.FlatSize() * k;
+  work.bytes = sizeInBytes(lhs_shape) + sizeInBytes(rhs_shape) + sizeInBytes(output_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_BatchMatMul_Float", work, [&]() {
+    batch_matmul(lhs_shape, lhs.data(), rhs_shape, rhs.data(), adj_x, adj_y, output_shape,
+                 output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
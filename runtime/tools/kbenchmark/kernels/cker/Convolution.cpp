@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Conv2D benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/Conv.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 32);
+NONIUS_PARAM(IFM_H, 56);
+NONIUS_PARAM(IFM_W, 56);
+
+NONIUS_PARAM(OFM_C, 32);
+NONIUS_PARAM(OFM_H, 56);
+NONIUS_PARAM(OFM_W, 56);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+NONIUS_PARAM(FUSED_ACT, std::string{"RELU"})
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_Conv_Float", [](nonius::chronometer meter) {
+  const int batch = meter.param<BATCH>();
+  const nnfw::cker::Shape input_shape{batch, meter.param<IFM_H>(), meter.param<IFM_W>(),
+                                      meter.param<IFM_C>()};
+  const nnfw::cker::Shape filter_shape{meter.param<OFM_C>(), meter.param<KER_H>(),
+                                       meter.param<KER_W>(), meter.param<IFM_C>()};
+  const nnfw::cker::Shape bias_shape{meter.param<OFM_C>()};
+  const nnfw::cker::Shape output_shape{batch, meter.param<OFM_H>(), meter.param<OFM_W>(),
+                                       meter.param<OFM_C>()};
+
+  nnfw::cker::ConvParams params{};
+  params.padding_type = meter.param<PADDING>() == "SAME" ? nnfw::cker::PaddingType::kSame
+                                                         : nnfw::cker::PaddingType::kValid;
+  params.padding_values =
+    calculatePadding(meter.param<PADDING>(), input_shape.Dims(1), input_shape.Dims(2),
+                     output_shape.Dims(1), output_shape.Dims(2), meter.param<STRIDE_H>(),
+                     meter.param<STRIDE_W>(), filter_shape.Dims(1), filter_shape.Dims(2));
+  params.stride_height = meter.param<STRIDE_H>();
+  params.stride_width = meter.param<STRIDE_W>();
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  setActivation(meter.param<FUSED_ACT>(), params.float_activation_min,
+                params.float_activation_max);
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  auto filter = makeData<float>(filter_shape.FlatSize());
+  auto bias = makeData<float>(bias_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepareF32(filter_shape, filter.data(), params.padding_type, is_replaced_weights,
+                  params.stride_width, params.stride_height, 1, 1);
+
+  kbenchmark::Work work;
+  work.flops = 2.0 * output_shape.FlatSize() * filter_shape.FlatSize() / filter_shape.Dims(0);
+  work.bytes = sizeInBytes(input_shape) + sizeInBytes(filter_shape) + sizeInBytes(bias_shape) +
+               sizeInBytes(output_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_Conv_Float", work, [&]() {
+    conv(params, input_shape, input.data(), filter_shape, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data(), ruyContext());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
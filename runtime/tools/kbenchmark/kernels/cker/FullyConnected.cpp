@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedBlockQuant.h>
+#include <cker/operation/FullyConnectedSparse16x1.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(IN_SIZE, 1024);
+NONIUS_PARAM(OUT_SIZE, 1024);
+NONIUS_PARAM(FUSED_ACT, std::string{"NONE"})
+
+// Every n-th 16x1 block of weights is non-zero in the sparse kernel
+NONIUS_PARAM(SPARSE_BLOCK_STRIDE, 4);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  nnfw::cker::Shape input_shape;
+  nnfw::cker::Shape weights_shape;
+  nnfw::cker::Shape bias_shape;
+  nnfw::cker::Shape output_shape;
+  nnfw::cker::FullyConnectedParams params{};
+
+  Configuration(nonius::chronometer meter)
+    : input_shape{meter.param<BATCH>(), meter.param<IN_SIZE>()},
+      weights_shape{meter.param<OUT_SIZE>(), meter.param<IN_SIZE>()},
+      bias_shape{meter.param<OUT_SIZE>()},
+      output_shape{meter.param<BATCH>(), meter.param<OUT_SIZE>()}
+  {
+    params.activation = asFusedActivation(meter.param<FUSED_ACT>());
+    setActivation(meter.param<FUSED_ACT>(), params.float_activation_min,
+                  params.float_activation_max);
+    params.lhs_cacheable = true;
+  }
+
+  // 'weights_bytes' is the size of dense weights, which is scaled by 'density' as flops are
+  kbenchmark::Work work(double weights_bytes, double density = 1.0) const
+  {
+    kbenchmark::Work work;
+    work.flops = 2.0 * output_shape.FlatSize() * weights_shape.Dims(1) * density;
+    work.bytes = sizeInBytes(input_shape) + weights_bytes * density + sizeInBytes(bias_shape) +
+                 sizeInBytes(output_shape);
+    return work;
+  }
+};
+
+void benchmarkBlockQuant(nonius::chronometer meter, nnfw::cker::BlockQuantType type,
+                         const std::string &name)
+{
+  using namespace nnfw::cker::block_quant;
+
+  Configuration p{meter};
+  const int in_size = p.weights_shape.Dims(1);
+  const int out_size = p.weights_shape.Dims(0);
+  const size_t row_size = RowSize(type, in_size);
+
+  // Quantize float weights row by row, like GGML models store them
+  auto float_weights = makeData<float>(p.weights_shape.FlatSize());
+  std::vector<uint8_t> weights(row_size * out_size);
+  for (int unit = 0; unit < out_size; ++unit)
+  {
+    const float *src = float_weights.data() + unit * in_size;
+    uint8_t *dst = weights.data() + unit * row_size;
+    if (type == nnfw::cker::BlockQuantType::Q4_0)
+      QuantizeRowQ4_0(src, reinterpret_cast<BlockQ4_0 *>(dst), in_size);
+    else
+      QuantizeRowQ8_0(src, reinterpret_cast<BlockQ8_0 *>(dst), in_size);
+  }
+
+  auto input = makeData<float>(p.input_shape.FlatSize());
+  auto bias = makeData<float>(p.bias_shape.FlatSize());
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  nnfw::cker::FCBlockQuantTempArena temp_arena;
+
+  // NOTE The kernel throws, which nonius reports as a failure, if IN_SIZE is not a multiple of 32
+  local_throughput_recorder().measure(meter, name, p.work(weights.size()), [&]() {
+    nnfw::cker::FullyConnectedBlockQuant(p.params, p.input_shape, input.data(), type,
+                                         p.weights_shape, weights.data(), p.bias_shape,
+                                         bias.data(), p.output_shape, output.data(), temp_arena,
+                                         ruyContext());
+  });
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_FullyConnected_Float", [](nonius::chronometer meter) {
+  Configuration p{meter};
+
+  auto input = makeData<float>(p.input_shape.FlatSize());
+  auto weights = makeData<float>(p.weights_shape.FlatSize());
+  auto bias = makeData<float>(p.bias_shape.FlatSize());
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  local_throughput_recorder().measure(
+    meter, "Cker_FullyConnected_Float", p.work(sizeInBytes(p.weights_shape)), [&]() {
+      nnfw::cker::FullyConnected(p.params, p.input_shape, input.data(), p.weights_shape,
+                                 weights.data(), p.bias_shape, bias.data(), p.output_shape,
+                                 output.data());
+    });
+})
+
+NONIUS_LOCAL_BENCHMARK("Cker_FullyConnected_Hybrid", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  p.params.weights_scale = 1.f / 127.f;
+
+  auto input = makeData<float>(p.input_shape.FlatSize());
+  std::vector<int8_t> weights(p.weights_shape.FlatSize());
+  for (size_t i = 0; i < weights.size(); ++i)
+    weights[i] = static_cast<int8_t>(static_cast<int>(i % 255) - 127);
+  auto bias = makeData<float>(p.bias_shape.FlatSize());
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  nnfw::cker::FCTempArena temp_arena;
+  temp_arena.prepare(p.input_shape, p.weights_shape);
+
+  const auto work = p.work(sizeInBytes(p.weights_shape, sizeof(int8_t)));
+  local_throughput_recorder().measure(meter, "Cker_FullyConnected_Hybrid", work, [&]() {
+    nnfw::cker::FullyConnectedHybrid(p.params, p.input_shape, input.data(), p.weights_shape,
+                                     weights.data(), p.bias_shape, bias.data(), p.output_shape,
+                                     output.data(), temp_arena, ruyContext());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("Cker_FullyConnected_Sparse16x1", [](nonius::chronometer meter) {
+  Configuration p{meter};
+  const int batch = p.input_shape.Dims(0);
+  const int in_size = p.weights_shape.Dims(1);
+  const int out_blocks = p.weights_shape.Dims(0) / 16;
+  const int block_stride = std::max(1, static_cast<int>(meter.param<SPARSE_BLOCK_STRIDE>()));
+
+  // Blocks of 16 output rows x 1 input column, every block_stride-th column is non-zero
+  std::vector<uint16_t> w1_segments{0};
+  std::vector<uint16_t> w1_indices;
+  for (int b = 0; b < out_blocks; ++b)
+  {
+    for (int i = b % block_stride; i < in_size; i += block_stride)
+      w1_indices.push_back(i);
+    w1_segments.push_back(w1_indices.size());
+  }
+  // NOTE The kernel doesn't rewind weights for each batch
+  auto weights = makeData<float>(w1_indices.size() * 16 * batch);
+
+  auto input = makeData<float>(p.input_shape.FlatSize());
+  auto bias = makeData<float>(p.bias_shape.FlatSize());
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  const double density = static_cast<double>(w1_indices.size()) * 16 / p.weights_shape.FlatSize();
+  local_throughput_recorder().measure(
+    meter, "Cker_FullyConnected_Sparse16x1", p.work(sizeInBytes(p.weights_shape), density), [&]() {
+      nnfw::cker::FullyConnectedSparseWeight16x1(
+        p.params, p.input_shape, input.data(), p.weights_shape, weights.data(), p.bias_shape,
+        bias.data(), p.output_shape, output.data(), w1_segments.data(), w1_indices.data());
+    });
+})
+
+NONIUS_LOCAL_BENCHMARK("Cker_FullyConnected_Q4_0", [](nonius::chronometer meter) {
+  benchmarkBlockQuant(meter, nnfw::cker::BlockQuantType::Q4_0, "Cker_FullyConnected_Q4_0");
+})
+
+NONIUS_LOCAL_BENCHMARK("Cker_FullyConnected_Q8_0", [](nonius::chronometer meter) {
+  benchmarkBlockQuant(meter, nnfw::cker::BlockQuantType::Q8_0, "Cker_FullyConnected_Q8_0");
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
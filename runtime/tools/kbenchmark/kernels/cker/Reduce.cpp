@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Reduce(Mean) benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/ReduceMean.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,7,7,1024"})
+NONIUS_PARAM(OUTPUT, std::string{"1,1,1,1024"})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+// Find the axes reduced from input_shape to output_shape, with or without keep_dims
+std::vector<int> reducedAxes(const nnfw::cker::Shape &input_shape,
+                             const nnfw::cker::Shape &output_shape)
+{
+  std::vector<int> axes;
+  const bool keep_dims = input_shape.DimensionsCount() == output_shape.DimensionsCount();
+  int out = 0;
+  for (int in = 0; in < input_shape.DimensionsCount(); ++in)
+  {
+    if (keep_dims)
+    {
+      if (input_shape.Dims(in) != output_shape.Dims(in))
+        axes.push_back(in);
+    }
+    else if (out < output_shape.DimensionsCount() &&
+             input_shape.Dims(in) == output_shape.Dims(out))
+    {
+      out++;
+    }
+    else
+    {
+      axes.push_back(in);
+    }
+  }
+  return axes;
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_Mean_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto output_shape = asShape(meter.param<OUTPUT>());
+  const auto axes = reducedAxes(input_shape, output_shape);
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  kbenchmark::Work work;
+  work.flops = input_shape.FlatSize();
+  work.bytes = sizeInBytes(input_shape) + sizeInBytes(output_shape);
+
+  // Same dispatch as the cpu backend
+  const bool axis_is_1_and_2 = input_shape.DimensionsCount() == 4 &&
+                               output_shape.DimensionsCount() == 4 &&
+                               axes == std::vector<int>{1, 2};
+
+  local_throughput_recorder().measure(meter, "Cker_Mean_Float", work, [&]() {
+    if (axis_is_1_and_2)
+      nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, output.data());
+    else
+      nnfw::cker::Mean(input_shape, input.data(), output_shape, output.data(), axes);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file RmsNorm benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/RmsNorm.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,128,768"})
+NONIUS_PARAM(GAMMA, std::string{"768"})
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_RmsNorm_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto gamma_shape = asShape(meter.param<GAMMA>());
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  auto gamma = makeData<float>(gamma_shape.FlatSize());
+  std::vector<float> output(input_shape.FlatSize());
+
+  nnfw::cker::RmsNormParams params;
+  params.epsilon = 1e-6f;
+
+  // square, sum, scale and gamma per element
+  kbenchmark::Work work;
+  work.flops = 4.0 * input_shape.FlatSize();
+  work.bytes = 2 * sizeInBytes(input_shape) + sizeInBytes(gamma_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_RmsNorm_Float", work, [&]() {
+    nnfw::cker::RmsNorm(params, input_shape, input.data(), gamma_shape, gamma.data(), input_shape,
+                        output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
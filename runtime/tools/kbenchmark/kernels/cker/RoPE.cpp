@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file RoPE benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/RoPE.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,12,128,64"})
+NONIUS_PARAM(TABLE, std::string{"1,1,128,64"})
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_RoPE_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto table_shape = asShape(meter.param<TABLE>());
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  auto sin_table = makeData<float>(table_shape.FlatSize());
+  auto cos_table = makeData<float>(table_shape.FlatSize());
+  std::vector<float> output(input_shape.FlatSize());
+
+  // 2 multiplies and an add per element
+  kbenchmark::Work work;
+  work.flops = 3.0 * input_shape.FlatSize();
+  work.bytes = 2 * sizeInBytes(input_shape) + 2 * sizeInBytes(table_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_RoPE_Float", work, [&]() {
+    nnfw::cker::RoPE(nnfw::cker::RoPEMode::kGptNeox, input_shape, input.data(), table_shape,
+                     sin_table.data(), table_shape, cos_table.data(), input_shape,
+                     output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
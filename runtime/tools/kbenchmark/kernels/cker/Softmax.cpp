@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Softmax benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/SoftMax.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,12,128,128"})
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_Softmax_Float", [](nonius::chronometer meter) {
+  const auto shape = asShape(meter.param<INPUT>());
+
+  auto input = makeData<float>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.f;
+
+  // max, subtract, exp, sum and scale per element
+  kbenchmark::Work work;
+  work.flops = 5.0 * shape.FlatSize();
+  work.bytes = 2 * sizeInBytes(shape);
+
+  local_throughput_recorder().measure(meter, "Cker_Softmax_Float", work, [&]() {
+    nnfw::cker::Softmax(params, shape, input.data(), shape, output.data(), ruyContext());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark of cker kernels used by the cpu backend
+ */
+
+#include "cker_common/Utils.h"
+
+#include <cker/operation/Transpose.h>
+
+using namespace kbenchmark::kernels::cker_common;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(INPUT, std::string{"1,128,12,64"})
+NONIUS_PARAM(OUTPUT, std::string{"1,12,128,64"})
+NONIUS_PARAM(PERM, std::string{""})
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+// Derive perm by matching each output dim with an unused input dim of the same size
+std::vector<int> derivePerm(const nnfw::cker::Shape &input_shape,
+                            const nnfw::cker::Shape &output_shape)
+{
+  const int rank = input_shape.DimensionsCount();
+  std::vector<int> perm;
+  std::vector<bool> used(rank, false);
+  for (int o = 0; o < rank; ++o)
+  {
+    // Prefer the same position to keep the identity for equal sizes
+    int found = (!used[o] && input_shape.Dims(o) == output_shape.Dims(o)) ? o : -1;
+    for (int i = 0; found < 0 && i < rank; ++i)
+      if (!used[i] && input_shape.Dims(i) == output_shape.Dims(o))
+        found = i;
+    if (found < 0)
+      throw std::runtime_error{"Cannot derive perm of Transpose"};
+    used[found] = true;
+    perm.push_back(found);
+  }
+  return perm;
+}
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+NONIUS_LOCAL_BENCHMARK("Cker_Transpose_Float", [](nonius::chronometer meter) {
+  const auto input_shape = asShape(meter.param<INPUT>());
+  const auto output_shape = asShape(meter.param<OUTPUT>());
+  const auto perm = meter.param<PERM>().empty() ? derivePerm(input_shape, output_shape)
+                                                : asInts(meter.param<PERM>());
+
+  nnfw::cker::TransposeParams params;
+  params.perm_count = perm.size();
+  for (size_t i = 0; i < perm.size(); ++i)
+    params.perm[i] = perm[i];
+
+  auto input = makeData<float>(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  kbenchmark::Work work;
+  work.bytes = sizeInBytes(input_shape) + sizeInBytes(output_shape);
+
+  local_throughput_recorder().measure(meter, "Cker_Transpose_Float", work, [&]() {
+    nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data());
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
+
+extern "C" kbenchmark::ThroughputRecorder &benchmark_throughput(void)
+{
+  return local_throughput_recorder();
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
+#define __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
+
+#include "Throughput.h"
+
+#include <cker/Shape.h>
+#include <cker/Types.h>
+#include <ruy/context.h>
+
+#include <nonius/nonius.h++>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace kbenchmark
+{
+namespace kernels
+{
+namespace cker_common
+{
+
+// Parse a shape string like "1,128,768"
+nnfw::cker::Shape asShape(const std::string &str)
+{
+  std::vector<int32_t> dims;
+  std::stringstream ss(str);
+  std::string dim;
+  while (std::getline(ss, dim, ','))
+    dims.push_back(std::stoi(dim));
+  return nnfw::cker::Shape(dims.size(), dims.data());
+}
+
+// Same as asShape, but for the comma separated list of an attribute like perm
+std::vector<int> asInts(const std::string &str)
+{
+  std::vector<int> values;
+  std::stringstream ss(str);
+  std::string value;
+  while (std::getline(ss, value, ','))
+    values.push_back(std::stoi(value));
+  return values;
+}
+
+template <typename T> std::vector<T> makeData(size_t size)
+{
+  std::vector<T> data(size);
+  for (size_t i = 0; i < size; ++i)
+    data[i] = static_cast<T>(static_cast<int>(i % 17) - 8) / static_cast<T>(8);
+  return data;
+}
+
+void setActivation(const std::string &act_name, float &activation_min, float &activation_max)
+{
+  if (act_name == "NONE")
+  {
+    activation_min = std::numeric_limits<float>::lowest();
+    activation_max = std::numeric_limits<float>::max();
+  }
+  else if (act_name == "RELU")
+  {
+    activation_min = 0.f;
+    activation_max = std::numeric_limits<float>::max();
+  }
+  else if (act_name == "RELU6")
+  {
+    activation_min = 0.f;
+    activation_max = 6.f;
+  }
+  else
+  {
+    throw std::runtime_error{"Not support activation: " + act_name};
+  }
+}
+
+nnfw::cker::FusedActivationFunctionType asFusedActivation(const std::string &act_name)
+{
+  if (act_name == "NONE")
+    return nnfw::cker::FusedActivationFunctionType::kNone;
+  else if (act_name == "RELU")
+    return nnfw::cker::FusedActivationFunctionType::kRelu;
+  else if (act_name == "RELU6")
+    return nnfw::cker::FusedActivationFunctionType::kRelu6;
+  throw std::runtime_error{"Not support activation: " + act_name};
+}
+
+nnfw::cker::PaddingValues calculatePadding(const std::string &padding_name, int ifm_H, int ifm_W,
+                                           int ofm_H, int ofm_W, int vertical_stride,
+                                           int horizontal_stride, int ker_H, int ker_W)
+{
+  nnfw::cker::PaddingValues padding{};
+  if (padding_name == "SAME")
+  {
+    padding.height = std::max(0, (ofm_H - 1) * vertical_stride + ker_H - ifm_H) / 2;
+    padding.width = std::max(0, (ofm_W - 1) * horizontal_stride + ker_W - ifm_W) / 2;
+  }
+  return padding;
+}
+
+// Threads for kernels which take a ruy context, from NUM_THREADS like onert (default 1)
+ruy::Context *ruyContext()
+{
+  static ruy::Context context;
+  static bool initialized = false;
+  if (!initialized)
+  {
+    const char *num_threads = std::getenv("NUM_THREADS");
+    context.set_max_num_threads(num_threads ? std::max(1, std::atoi(num_threads)) : 1);
+    initialized = true;
+  }
+  return &context;
+}
+
+double sizeInBytes(const nnfw::cker::Shape &shape, size_t elem_size = sizeof(float))
+{
+  return static_cast<double>(shape.FlatSize()) * elem_size;
+}
+
+} // namespace cker_common
+} // namespace kernels
+} // namespace kbenchmark
+
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+inline kbenchmark::ThroughputRecorder &local_throughput_recorder()
+{
+  static kbenchmark::ThroughputRecorder recorder;
+  return recorder;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+#endif // __KBENCHMARK_KERNELS_CKER_COMMON_UTILS_H__
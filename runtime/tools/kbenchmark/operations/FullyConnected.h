@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+#define __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__
+
+#include "Operation.h"
+#include "Utils.h"
+
+namespace kbenchmark
+{
+namespace operation
+{
+
+class FullyConnected final : public Operation
+{
+public:
+  FullyConnected() = default;
+
+  nonius::parameters params(int layer_num, OperationInfo &info) override
+  {
+    nonius::parameters params;
+
+    params.insert({"LAYER", nonius::param{layer_num}});
+
+    auto _weights = get_key_dims({"input1"}, info);
+    params.insert({"OUT_SIZE", nonius::param{_weights[0]}});
+    params.insert({"IN_SIZE", nonius::param{_weights[1]}});
+
+    int _batch = 1;
+    for (auto d : get_key_dims({"input0"}, info))
+      _batch *= d;
+    params.insert({"BATCH", nonius::param{_batch / _weights[1]}});
+
+    auto _act = get_key_string({"fused_act"}, info, "NONE");
+    params.insert({"FUSED_ACT", nonius::param{_act}});
+
+    return params;
+  }
+};
+
+} // namespace operation
+} // namespace kbenchmark
+
+#endif // __KBENCHMARK_OPERATIONS_FULLY_CONNECTED_H__